@@ -6,6 +6,7 @@
 #include "esphome/core/entity_base.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
+#include "esphome/core/metrics.h"
 #include "esphome/core/version.h"
 
 #ifdef USE_DEEP_SLEEP
@@ -1079,6 +1080,26 @@ void APIConnection::alarm_control_panel_command(const AlarmControlPanelCommandRe
 }
 #endif
 
+#ifdef USE_RUNTIME_METRICS
+static RuntimeStatsEntry runtime_stats_entry(std::string name, const metrics::Histogram &histogram) {
+  RuntimeStatsEntry entry;
+  entry.name = std::move(name);
+  entry.count = histogram.get_count();
+  entry.total_us = histogram.get_sum();
+  entry.max_us = histogram.get_max();
+  entry.p99_us = histogram.get_percentile(0.99f);
+  return entry;
+}
+RuntimeStatsResponse APIConnection::get_runtime_stats(const RuntimeStatsRequest &msg) {
+  RuntimeStatsResponse resp;
+  for (const auto &it : metrics::global_metrics.get_components())
+    resp.components.push_back(runtime_stats_entry(it.describe(), it.loop_time));
+  for (const auto &it : metrics::global_metrics.get_scheduler_items())
+    resp.scheduler_items.push_back(runtime_stats_entry(it.describe(), it.run_time));
+  return resp;
+}
+#endif
+
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
@@ -1208,14 +1229,21 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
       if (message_type != 29) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
       }
+#ifdef USE_RUNTIME_METRICS
+      metrics::global_metrics.api_messages_dropped++;
+#endif
       delay(0);
       return false;
     }
   }
 
   APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
-  if (err == APIError::WOULD_BLOCK)
+  if (err == APIError::WOULD_BLOCK) {
+#ifdef USE_RUNTIME_METRICS
+    metrics::global_metrics.api_messages_dropped++;
+#endif
     return false;
+  }
   if (err != APIError::OK) {
     on_fatal_error();
     if (err == APIError::SOCKET_WRITE_FAILED && errno == ECONNRESET) {
@@ -1226,6 +1254,10 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
     return false;
   }
+#ifdef USE_RUNTIME_METRICS
+  metrics::global_metrics.api_messages_sent++;
+  metrics::global_metrics.api_bytes_sent += buffer.get_buffer()->size();
+#endif
   // Do not set last_traffic_ on send
   return true;
 }
@@ -137,6 +137,10 @@ class APIConnection : public APIServerConnection {
   void alarm_control_panel_command(const AlarmControlPanelCommandRequest &msg) override;
 #endif
 
+#ifdef USE_RUNTIME_METRICS
+  RuntimeStatsResponse get_runtime_stats(const RuntimeStatsRequest &msg) override;
+#endif
+
   void on_disconnect_response(const DisconnectResponse &value) override;
   void on_ping_response(const PingResponse &value) override {
     // we initiated ping
@@ -7184,6 +7184,119 @@ void TextCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+void RuntimeStatsRequest::encode(ProtoWriteBuffer buffer) const {}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void RuntimeStatsRequest::dump_to(std::string &out) const { out.append("RuntimeStatsRequest {}"); }
+#endif
+bool RuntimeStatsEntry::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2: {
+      this->count = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->total_us = value.as_uint64();
+      return true;
+    }
+    case 4: {
+      this->max_us = value.as_uint32();
+      return true;
+    }
+    case 5: {
+      this->p99_us = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool RuntimeStatsEntry::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->name = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void RuntimeStatsEntry::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_string(1, this->name);
+  buffer.encode_uint32(2, this->count);
+  buffer.encode_uint64(3, this->total_us);
+  buffer.encode_uint32(4, this->max_us);
+  buffer.encode_uint32(5, this->p99_us);
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void RuntimeStatsEntry::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("RuntimeStatsEntry {\n");
+  out.append("  name: ");
+  out.append("'").append(this->name).append("'");
+  out.append("\n");
+
+  out.append("  count: ");
+  sprintf(buffer, "%" PRIu32, this->count);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  total_us: ");
+  sprintf(buffer, "%llu", this->total_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  max_us: ");
+  sprintf(buffer, "%" PRIu32, this->max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  p99_us: ");
+  sprintf(buffer, "%" PRIu32, this->p99_us);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
+#endif
+bool RuntimeStatsResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->components.push_back(value.as_message<RuntimeStatsEntry>());
+      return true;
+    }
+    case 2: {
+      this->scheduler_items.push_back(value.as_message<RuntimeStatsEntry>());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void RuntimeStatsResponse::encode(ProtoWriteBuffer buffer) const {
+  for (auto &it : this->components) {
+    buffer.encode_message<RuntimeStatsEntry>(1, it, true);
+  }
+  for (auto &it : this->scheduler_items) {
+    buffer.encode_message<RuntimeStatsEntry>(2, it, true);
+  }
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void RuntimeStatsResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("RuntimeStatsResponse {\n");
+  for (const auto &it : this->components) {
+    out.append("  components: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+
+  for (const auto &it : this->scheduler_items) {
+    out.append("  scheduler_items: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+  out.append("}");
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
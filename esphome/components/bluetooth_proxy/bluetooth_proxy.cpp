@@ -1,5 +1,6 @@
 #include "bluetooth_proxy.h"
 
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 
@@ -39,26 +40,43 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr || !this->raw_advertisements_)
     return false;
 
-  api::BluetoothLERawAdvertisementsResponse resp;
+  if (this->raw_advertisements_buffer_.capacity() == 0)
+    this->raw_advertisements_buffer_.reserve(RAW_ADVERTISEMENTS_BATCH_SIZE * RAW_ADVERTISEMENT_MAX_ENCODED_SIZE);
   for (size_t i = 0; i < count; i++) {
-    auto &result = advertisements[i];
-    api::BluetoothLERawAdvertisement adv;
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
-    adv.rssi = result.rssi;
-    adv.address_type = result.ble_addr_type;
-
-    uint8_t length = result.adv_data_len + result.scan_rsp_len;
-    adv.data.reserve(length);
-    for (uint16_t i = 0; i < length; i++) {
-      adv.data.push_back(result.ble_adv[i]);
-    }
-
-    resp.advertisements.push_back(std::move(adv));
+    if (this->raw_advertisements_count_ == 0)
+      this->raw_advertisements_batch_start_ = millis();
+    this->encode_raw_advertisement_(advertisements[i]);
+    if (++this->raw_advertisements_count_ >= RAW_ADVERTISEMENTS_BATCH_SIZE)
+      this->flush_raw_advertisements_();
   }
-  ESP_LOGV(TAG, "Proxying %d packets", count);
-  this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
   return true;
 }
+
+void BluetoothProxy::encode_raw_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &result) {
+  // Encode without an intermediate BluetoothLERawAdvertisement to avoid allocating its data
+  api::ProtoWriteBuffer buffer(&this->raw_advertisements_buffer_);
+  // repeated BluetoothLERawAdvertisement advertisements = 1;
+  buffer.encode_field_raw(1, 2);
+  // The message is always shorter than 128 bytes, so its length is a single byte filled in afterwards
+  const size_t length_index = this->raw_advertisements_buffer_.size();
+  buffer.write(0);
+  buffer.encode_uint64(1, esp32_ble::ble_addr_to_uint64(result.bda));
+  buffer.encode_sint32(2, result.rssi);
+  buffer.encode_uint32(3, result.ble_addr_type);
+  buffer.encode_bytes(4, result.ble_adv, result.adv_data_len + result.scan_rsp_len);
+  this->raw_advertisements_buffer_[length_index] = this->raw_advertisements_buffer_.size() - length_index - 1;
+}
+
+void BluetoothProxy::flush_raw_advertisements_() {
+  if (this->raw_advertisements_count_ == 0)
+    return;
+  ESP_LOGV(TAG, "Proxying %u packets", this->raw_advertisements_count_);
+  // BluetoothLERawAdvertisementsResponse - 93
+  this->api_connection_->send_buffer(api::ProtoWriteBuffer(&this->raw_advertisements_buffer_), 93);
+  this->raw_advertisements_buffer_.clear();
+  this->raw_advertisements_count_ = 0;
+}
+
 void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device) {
   api::BluetoothLEAdvertisementResponse resp;
   resp.address = device.address_uint64();
@@ -110,8 +128,13 @@ void BluetoothProxy::loop() {
         connection->disconnect();
       }
     }
+    this->raw_advertisements_buffer_.clear();
+    this->raw_advertisements_count_ = 0;
     return;
   }
+  if (this->raw_advertisements_count_ != 0 &&
+      millis() - this->raw_advertisements_batch_start_ >= RAW_ADVERTISEMENTS_FLUSH_INTERVAL)
+    this->flush_raw_advertisements_();
   for (auto *connection : this->connections_) {
     if (connection->send_service_ == connection->service_count_) {
       connection->send_service_ = DONE_SENDING_SERVICES;
@@ -451,6 +474,8 @@ void BluetoothProxy::unsubscribe_api_connection(api::APIConnection *api_connecti
   }
   this->api_connection_ = nullptr;
   this->raw_advertisements_ = false;
+  this->raw_advertisements_buffer_.clear();
+  this->raw_advertisements_count_ = 0;
   this->parent_->recalculate_advertisement_parser_types();
 }
 
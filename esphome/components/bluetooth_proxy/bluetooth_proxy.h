@@ -44,6 +44,13 @@ enum BluetoothProxySubscriptionFlag : uint32_t {
   SUBSCRIPTION_RAW_ADVERTISEMENTS = 1 << 0,
 };
 
+// Raw advertisements are encoded straight into one preallocated BluetoothLERawAdvertisementsResponse, which is sent
+// when it holds this many advertisements or the oldest one waited for the flush interval (ms).
+static const uint8_t RAW_ADVERTISEMENTS_BATCH_SIZE = 16;
+static const uint32_t RAW_ADVERTISEMENTS_FLUSH_INTERVAL = 100;
+// Largest encoded advertisement: tag and length (2), address (8), rssi (3), address type (2), 62 data bytes (64)
+static const uint8_t RAW_ADVERTISEMENT_MAX_ENCODED_SIZE = 79;
+
 class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Component {
  public:
   BluetoothProxy();
@@ -116,6 +123,8 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
 
  protected:
   void send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device);
+  void encode_raw_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &result);
+  void flush_raw_advertisements_();
 
   BluetoothConnection *get_connection_(uint64_t address, bool reserve);
 
@@ -124,6 +133,10 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   std::vector<BluetoothConnection *> connections_{};
   api::APIConnection *api_connection_{nullptr};
   bool raw_advertisements_{false};
+  /// Encoded BluetoothLERawAdvertisementsResponse of the advertisements not sent yet.
+  std::vector<uint8_t> raw_advertisements_buffer_;
+  uint8_t raw_advertisements_count_{0};
+  uint32_t raw_advertisements_batch_start_{0};
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -13,6 +13,8 @@ CODEOWNERS = ["@OttoWinter"]
 DEPENDENCIES = ["logger"]
 
 CONF_DEBUG_ID = "debug_id"
+CONF_PROFILER = "profiler"
+CONF_LOG_INTERVAL = "log_interval"
 debug_ns = cg.esphome_ns.namespace("debug")
 DebugComponent = debug_ns.class_("DebugComponent", cg.PollingComponent)
 
@@ -36,6 +38,13 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LOOP_TIME): cv.invalid(
                 "The 'loop_time' option has been moved to the 'debug' sensor component"
             ),
+            cv.Optional(CONF_PROFILER): cv.Schema(
+                {
+                    cv.Optional(
+                        CONF_LOG_INTERVAL, default="60s"
+                    ): cv.positive_time_period_milliseconds,
+                }
+            ),
         }
     ).extend(cv.polling_component_schema("60s")),
 )
@@ -44,3 +53,9 @@ CONFIG_SCHEMA = cv.All(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+
+    if CONF_PROFILER in config:
+        cg.add_define("USE_RUNTIME_METRICS")
+        cg.add(
+            var.set_profiler_log_interval(config[CONF_PROFILER][CONF_LOG_INTERVAL])
+        )
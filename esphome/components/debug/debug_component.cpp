@@ -4,6 +4,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/metrics.h"
 #include "esphome/core/version.h"
 #include <cinttypes>
 
@@ -72,6 +73,10 @@ void DebugComponent::dump_config() {
   LOG_SENSOR("  ", "Heap fragmentation", this->fragmentation_sensor_);
 #endif  // defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
 #endif  // USE_SENSOR
+#ifdef USE_RUNTIME_METRICS
+  if (this->profiler_log_interval_ != 0)
+    ESP_LOGCONFIG(TAG, "  Profiler log interval: %.1fs", this->profiler_log_interval_ / 1000.0f);
+#endif
 
   ESP_LOGD(TAG, "ESPHome version %s", ESPHOME_VERSION);
   device_info += ESPHOME_VERSION;
@@ -385,6 +390,49 @@ void DebugComponent::dump_config() {
 #endif  // USE_TEXT_SENSOR
 }
 
+#ifdef USE_RUNTIME_METRICS
+static const uint8_t PROFILER_LOG_TOP = 10;
+
+void DebugComponent::setup() {
+  if (this->profiler_log_interval_ != 0)
+    this->set_interval("profiler", this->profiler_log_interval_, [this]() { this->log_profile_(); });
+}
+
+template<typename T>
+static void log_profile_top(const char *title, const std::vector<T> &items, metrics::Histogram T::*histogram) {
+  uint64_t total = 0;
+  std::vector<const T *> sorted;
+  sorted.reserve(items.size());
+  for (const auto &item : items) {
+    total += (item.*histogram).get_sum();
+    sorted.push_back(&item);
+  }
+  size_t count = std::min<size_t>(sorted.size(), PROFILER_LOG_TOP);
+  std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(), [histogram](const T *a, const T *b) {
+    return (a->*histogram).get_sum() > (b->*histogram).get_sum();
+  });
+
+  ESP_LOGD(TAG, "%s (total %.1f ms):", title, total / 1e3f);
+  for (size_t i = 0; i < count; i++) {
+    const metrics::Histogram &h = sorted[i]->*histogram;
+    ESP_LOGD(TAG, "  %-32s %8" PRIu32 " calls, total %9.1f ms (%4.1f%%), max %7.2f ms, p99 <= %7.2f ms",
+             sorted[i]->describe().c_str(), h.get_count(), h.get_sum() / 1e3f,
+             total == 0 ? 0.0f : h.get_sum() * 100.0f / total, h.get_max() / 1e3f, h.get_percentile(0.99f) / 1e3f);
+  }
+}
+
+void DebugComponent::log_profile_() {
+  log_profile_top("Component loop() time since boot", metrics::global_metrics.get_components(),
+                  &metrics::ComponentMetrics::loop_time);
+  log_profile_top("Scheduler item time since boot", metrics::global_metrics.get_scheduler_items(),
+                  &metrics::SchedulerItemMetrics::run_time);
+  if (metrics::global_metrics.scheduler_items_untracked != 0) {
+    ESP_LOGD(TAG, "  %" PRIu32 " scheduler items were not tracked, table is full",
+             metrics::global_metrics.scheduler_items_untracked);
+  }
+}
+#endif  // USE_RUNTIME_METRICS
+
 void DebugComponent::loop() {
   // log when free heap space has halved
   uint32_t new_free_heap = get_free_heap();
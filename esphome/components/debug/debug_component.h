@@ -17,6 +17,9 @@ namespace debug {
 
 class DebugComponent : public PollingComponent {
  public:
+#ifdef USE_RUNTIME_METRICS
+  void setup() override;
+#endif
   void loop() override;
   void update() override;
   float get_setup_priority() const override;
@@ -37,9 +40,21 @@ class DebugComponent : public PollingComponent {
   void set_psram_sensor(sensor::Sensor *psram_sensor) { this->psram_sensor_ = psram_sensor; }
 #endif  // USE_ESP32
 #endif  // USE_SENSOR
+#ifdef USE_RUNTIME_METRICS
+  void set_profiler_log_interval(uint32_t profiler_log_interval) {
+    this->profiler_log_interval_ = profiler_log_interval;
+  }
+#endif
  protected:
   uint32_t free_heap_{};
 
+#ifdef USE_RUNTIME_METRICS
+  /// Log the components and scheduler items that spent the most time since boot
+  void log_profile_();
+
+  uint32_t profiler_log_interval_{0};
+#endif
+
 #ifdef USE_SENSOR
   uint32_t last_loop_timetag_{0};
   uint32_t max_loop_time_{0};
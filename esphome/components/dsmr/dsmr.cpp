@@ -1,19 +1,21 @@
 #ifdef USE_ARDUINO
 
 #include "dsmr.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
-#include <AES.h>
-#include <Crypto.h>
-#include <GCM.h>
+#include <algorithm>
+#include <cstring>
 
 namespace esphome {
 namespace dsmr {
 
 static const char *const TAG = "dsmr";
 
+// Size of the authentication tag at the end of an encrypted telegram
+static const size_t GCM_TAG_SIZE = 12;
+
 void Dsmr::setup() {
-  this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
   if (this->request_pin_ != nullptr) {
     this->request_pin_->setup();
   }
@@ -127,150 +129,223 @@ void Dsmr::stop_requesting_data_() {
 void Dsmr::reset_telegram_() {
   this->header_found_ = false;
   this->footer_found_ = false;
+  this->telegram_started_ = false;
+  this->line_complete_ = false;
+  this->line_.clear();
   this->bytes_read_ = 0;
   this->crypt_bytes_read_ = 0;
   this->crypt_telegram_len_ = 0;
-  this->last_read_time_ = 0;
 }
 
 void Dsmr::receive_telegram_() {
+  uint8_t buf[uart::READ_CHUNK_SIZE];
   while (this->available_within_timeout_()) {
-    const char c = this->read();
-
-    // Find a new telegram header, i.e. forward slash.
-    if (c == '/') {
-      ESP_LOGV(TAG, "Header of telegram found");
+    size_t len = this->read_array_available(buf, sizeof(buf));
+    for (size_t i = 0; i < len; i++) {
+      if (!this->receive_byte_(buf[i]))
+        continue;
+      if (this->footer_found_) {
+        this->stop_requesting_data_();
+        this->reset_telegram_();
+        return;
+      }
+      // The telegram was dropped, the rest of the chunk might hold the header of the next one.
       this->reset_telegram_();
-      this->header_found_ = true;
     }
-    if (!this->header_found_)
-      continue;
+  }
+}
 
-    // Check for buffer overflow.
-    if (this->bytes_read_ >= this->max_telegram_len_) {
-      this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
-      return;
+bool Dsmr::receive_byte_(char c) {
+  // Find a new telegram header, i.e. forward slash.
+  if (c == '/') {
+    ESP_LOGV(TAG, "Header of telegram found");
+    this->header_found_ = true;
+    this->telegram_started_ = true;
+    this->footer_found_ = false;
+    this->line_complete_ = false;
+    this->identification_parsed_ = false;
+    this->line_.clear();
+    this->bytes_read_ = 0;
+    this->crc_ = 0;
+    this->data_ = MyData();
+  }
+  if (!this->telegram_started_)
+    return false;
+
+  // Check for buffer overflow.
+  if (++this->bytes_read_ > this->max_telegram_len_) {
+    ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+    this->telegram_started_ = false;
+    return true;
+  }
+
+  // After the footer, collect the hex checksum up to the newline.
+  if (this->footer_found_) {
+    if (c == '\n') {
+      this->finish_telegram_();
+      this->telegram_started_ = false;
+      return true;
     }
+    if (c != '\r')
+      this->line_ += c;
+    return false;
+  }
 
+  // The CRC covers everything from the header up to and including the footer.
+  this->crc_ = crc16(reinterpret_cast<const uint8_t *>(&c), 1, this->crc_);
+  if (c == '/')
+    return false;
+  if (c == '\r' || c == '\n') {
+    this->line_complete_ = !this->line_.empty();
+    return false;
+  }
+  if (this->line_complete_) {
+    this->line_complete_ = false;
     // Some v2.2 or v3 meters will send a new value which starts with '('
-    // in a new line, while the value belongs to the previous ObisId. For
-    // proper parsing, remove these new line characters.
-    if (c == '(') {
-      while (true) {
-        auto previous_char = this->telegram_[this->bytes_read_ - 1];
-        if (previous_char == '\n' || previous_char == '\r') {
-          this->bytes_read_--;
-        } else {
-          break;
-        }
+    // in a new line, while the value belongs to the previous ObisId. So a
+    // line is only parsed once the next one doesn't start with '('.
+    if (c != '(') {
+      if (!this->parse_line_()) {
+        this->telegram_started_ = false;
+        return true;
       }
+      this->line_.clear();
     }
+  }
 
-    // Store the byte in the buffer.
-    this->telegram_[this->bytes_read_] = c;
-    this->bytes_read_++;
+  // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
+  if (c == '!') {
+    ESP_LOGV(TAG, "Footer of telegram found");
+    this->footer_found_ = true;
+    if (!this->line_.empty() && !this->parse_line_()) {
+      this->telegram_started_ = false;
+      return true;
+    }
+    this->line_.clear();
+    return false;
+  }
 
-    // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
-    if (c == '!') {
-      ESP_LOGV(TAG, "Footer of telegram found");
-      this->footer_found_ = true;
-      continue;
+  this->line_ += c;
+  return false;
+}
+
+bool Dsmr::parse_line_() {
+  // Without CRC check every line is published right away, otherwise the values are kept until the CRC is verified.
+  if (this->crc_check_)
+    return this->parse_line_into_(&this->data_);
+  MyData data;
+  if (!this->parse_line_into_(&data))
+    return false;
+  this->publish_sensors(data);
+  return true;
+}
+
+bool Dsmr::parse_line_into_(MyData *data) {
+  const char *start = this->line_.data();
+  const char *end = start + this->line_.size();
+  ::dsmr::ParseResult<void> res;
+  if (!this->identification_parsed_) {
+    // The identification line is offered to the fields with the all-ones OBIS id, like the dsmr library does.
+    this->identification_parsed_ = true;
+    res = data->parse_line(::dsmr::ObisId(255, 255, 255, 255, 255, 255), start, end);
+  } else {
+    // Ignore unknown values.
+    res = ::dsmr::P1Parser::parse_line(data, start, end, false);
+  }
+  if (res.err) {
+    // Parsing error, show it
+    auto err_str = res.fullError(start, end);
+    ESP_LOGE(TAG, "%s", err_str.c_str());
+    return false;
+  }
+  return true;
+}
+
+void Dsmr::finish_telegram_() {
+  ESP_LOGV(TAG, "End of telegram found");
+  if (this->crc_check_) {
+    auto crc = parse_hex<uint16_t>(this->line_.c_str(), this->line_.size());
+    if (this->line_.size() != 4 || !crc.has_value()) {
+      ESP_LOGE(TAG, "Invalid checksum '%s'", this->line_.c_str());
+      return;
     }
-    // Check for the end of the hex checksum, i.e. a newline.
-    if (this->footer_found_ && c == '\n') {
-      // Parse the telegram and publish sensor values.
-      this->parse_telegram();
-      this->reset_telegram_();
+    if (*crc != this->crc_) {
+      ESP_LOGE(TAG, "Checksum mismatch, received %04X, calculated %04X", *crc, this->crc_);
       return;
     }
+    this->publish_sensors(this->data_);
   }
+  this->status_clear_warning();
 }
 
 void Dsmr::receive_encrypted_telegram_() {
+  uint8_t ciphertext[uart::READ_CHUNK_SIZE];
+  uint8_t plaintext[uart::READ_CHUNK_SIZE];
   while (this->available_within_timeout_()) {
-    const char c = this->read();
+    if (this->crypt_bytes_read_ < CRYPT_HEADER_SIZE) {
+      const uint8_t c = this->read();
 
-    // Find a new telegram start byte.
-    if (!this->header_found_) {
-      if ((uint8_t) c != 0xDB) {
-        continue;
+      // Find a new telegram start byte.
+      if (!this->header_found_) {
+        if (c != 0xDB) {
+          continue;
+        }
+        ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
+        this->reset_telegram_();
+        this->header_found_ = true;
       }
-      ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
-      this->reset_telegram_();
-      this->header_found_ = true;
-    }
-
-    // Check for buffer overflow.
-    if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
-      this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
-      return;
-    }
 
-    // Store the byte in the buffer.
-    this->crypt_telegram_[this->crypt_bytes_read_] = c;
-    this->crypt_bytes_read_++;
+      this->crypt_header_[this->crypt_bytes_read_++] = c;
+      if (this->crypt_bytes_read_ < CRYPT_HEADER_SIZE)
+        continue;
 
-    // Read the length of the incoming encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
-      // Complete header + data bytes
-      this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
+      // Complete header, read the length of the incoming encrypted telegram.
+      this->crypt_telegram_len_ = 13 + encode_uint16(this->crypt_header_[11], this->crypt_header_[12]);
       ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
+      if (this->crypt_telegram_len_ > this->max_telegram_len_) {
+        ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+        this->reset_telegram_();
+        return;
+      }
+      if (this->crypt_telegram_len_ < CRYPT_HEADER_SIZE + GCM_TAG_SIZE) {
+        ESP_LOGE(TAG, "Error: invalid encrypted telegram length (%d bytes)", this->crypt_telegram_len_);
+        this->reset_telegram_();
+        return;
+      }
+      // the iv is 8 bytes of the system title + 4 bytes frame counter
+      // system title is at byte 2 and frame counter at byte 14
+      uint8_t iv[12];
+      memcpy(iv, &this->crypt_header_[2], 8);
+      memcpy(iv + 8, &this->crypt_header_[14], 4);
+      this->gcmaes128_->setIV(iv, sizeof(iv));
+      continue;
     }
 
-    // Check for the end of the encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
+    // Decrypt the ciphertext in chunks as it comes in and feed it to the telegram parser.
+    const size_t ciphertext_end = this->crypt_telegram_len_ - GCM_TAG_SIZE;
+    if (this->crypt_bytes_read_ < ciphertext_end) {
+      size_t max_len = std::min(ciphertext_end - this->crypt_bytes_read_, sizeof(ciphertext));
+      size_t len = this->read_array_available(ciphertext, max_len);
+      this->crypt_bytes_read_ += len;
+      this->gcmaes128_->decrypt(plaintext, ciphertext, len);
+      for (size_t i = 0; i < len; i++)
+        this->receive_byte_(plaintext[i]);
       continue;
     }
-    ESP_LOGV(TAG, "End of encrypted telegram found");
 
-    // Decrypt the encrypted telegram.
-    GCM<AES128> *gcmaes128{new GCM<AES128>()};
-    gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
-    // the iv is 8 bytes of the system title + 4 bytes frame counter
-    // system title is at byte 2 and frame counter at byte 15
-    for (int i = 10; i < 14; i++)
-      this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
-    constexpr uint16_t iv_size{12};
-    gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
-    delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
-
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
-    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
-
-    // Parse the decrypted telegram and publish sensor values.
-    this->parse_telegram();
+    // The authentication tag isn't checked, skip it.
+    this->read();
+    if (++this->crypt_bytes_read_ < this->crypt_telegram_len_)
+      continue;
+    ESP_LOGV(TAG, "End of encrypted telegram found");
+    if (this->telegram_started_)
+      ESP_LOGW(TAG, "Decrypted telegram is incomplete");
+    this->stop_requesting_data_();
     this->reset_telegram_();
     return;
   }
 }
 
-bool Dsmr::parse_telegram() {
-  MyData data;
-  ESP_LOGV(TAG, "Trying to parse telegram");
-  this->stop_requesting_data_();
-  ::dsmr::ParseResult<void> res =
-      ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
-                              this->crc_check_);  // Parse telegram according to data definition. Ignore unknown values.
-  if (res.err) {
-    // Parsing error, show it
-    auto err_str = res.fullError(this->telegram_, this->telegram_ + this->bytes_read_);
-    ESP_LOGE(TAG, "%s", err_str.c_str());
-    return false;
-  } else {
-    this->status_clear_warning();
-    this->publish_sensors(data);
-    return true;
-  }
-}
-
 void Dsmr::dump_config() {
   ESP_LOGCONFIG(TAG, "DSMR:");
   ESP_LOGCONFIG(TAG, "  Max telegram length: %d", this->max_telegram_len_);
@@ -293,9 +368,9 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
   if (decryption_key.length() == 0) {
     ESP_LOGI(TAG, "Disabling decryption");
     this->decryption_key_.clear();
-    if (this->crypt_telegram_ != nullptr) {
-      delete[] this->crypt_telegram_;
-      this->crypt_telegram_ = nullptr;
+    if (this->gcmaes128_ != nullptr) {
+      delete this->gcmaes128_;  // NOLINT(cppcoreguidelines-owning-memory)
+      this->gcmaes128_ = nullptr;
     }
     return;
   }
@@ -316,9 +391,10 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
     this->decryption_key_.push_back(std::strtoul(temp, nullptr, 16));
   }
 
-  if (this->crypt_telegram_ == nullptr) {
-    this->crypt_telegram_ = new uint8_t[this->max_telegram_len_];  // NOLINT
+  if (this->gcmaes128_ == nullptr) {
+    this->gcmaes128_ = new GCM<AES128>();  // NOLINT(cppcoreguidelines-owning-memory)
   }
+  this->gcmaes128_->setKey(this->decryption_key_.data(), this->gcmaes128_->keySize());
 }
 
 }  // namespace dsmr
@@ -13,6 +13,11 @@
 #include <dsmr/parser.h>
 #include <dsmr/fields.h>
 
+#include <AES.h>
+#include <Crypto.h>
+#include <GCM.h>
+
+#include <string>
 #include <vector>
 
 namespace esphome {
@@ -54,8 +59,6 @@ class Dsmr : public Component, public uart::UARTDevice {
   void setup() override;
   void loop() override;
 
-  bool parse_telegram();
-
   void publish_sensors(MyData &data) {
 #define DSMR_PUBLISH_SENSOR(s) \
   if (data.s##_present && this->s_##s##_ != nullptr) \
@@ -90,6 +93,16 @@ class Dsmr : public Component, public uart::UARTDevice {
   void receive_encrypted_telegram_();
   void reset_telegram_();
 
+  /// Handle the next byte of a (decrypted) telegram. Lines are parsed as soon as they are complete and the CRC is
+  /// updated along the way, so there's no need to hold the whole telegram. Returns true when the telegram ended,
+  /// either after the checksum line or because it was dropped.
+  bool receive_byte_(char c);
+  /// Parse the complete line in line_, returns false if the telegram has to be dropped.
+  bool parse_line_();
+  bool parse_line_into_(MyData *data);
+  /// Check the CRC and publish the values of a telegram whose checksum line has been received.
+  void finish_telegram_();
+
   /// Wait for UART data to become available within the read timeout.
   ///
   /// The smart meter might provide data in chunks, causing available() to
@@ -115,15 +128,29 @@ class Dsmr : public Component, public uart::UARTDevice {
   uint32_t receive_timeout_;
   bool receive_timeout_reached_();
   size_t max_telegram_len_;
-  char *telegram_{nullptr};
   size_t bytes_read_{0};
-  uint8_t *crypt_telegram_{nullptr};
-  size_t crypt_telegram_len_{0};
-  size_t crypt_bytes_read_{0};
   uint32_t last_read_time_{0};
   bool header_found_{false};
   bool footer_found_{false};
 
+  // Incremental parser
+  /// The line being received, or the checksum after the footer
+  std::string line_;
+  /// Whether a CR/LF ended the line, it's parsed when the next line doesn't turn out to be a continuation of it
+  bool line_complete_{false};
+  bool telegram_started_{false};
+  bool identification_parsed_{false};
+  uint16_t crc_{0};
+  /// Values of the lines parsed so far, published when the CRC of the telegram has been checked
+  MyData data_;
+
+  // Encrypted telegram
+  static const size_t CRYPT_HEADER_SIZE = 18;
+  GCM<AES128> *gcmaes128_{nullptr};
+  uint8_t crypt_header_[CRYPT_HEADER_SIZE];
+  size_t crypt_telegram_len_{0};
+  size_t crypt_bytes_read_{0};
+
 // Sensor member pointers
 #define DSMR_DECLARE_SENSOR(s) sensor::Sensor *s_##s##_{nullptr};
   DSMR_SENSOR_LIST(DSMR_DECLARE_SENSOR, )
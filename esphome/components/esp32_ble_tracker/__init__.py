@@ -30,6 +30,7 @@ CONF_SCAN_PARAMETERS = "scan_parameters"
 CONF_WINDOW = "window"
 CONF_CONTINUOUS = "continuous"
 CONF_ON_SCAN_END = "on_scan_end"
+CONF_DEDUP_INTERVAL = "dedup_interval"
 esp32_ble_tracker_ns = cg.esphome_ns.namespace("esp32_ble_tracker")
 ESP32BLETracker = esp32_ble_tracker_ns.class_(
     "ESP32BLETracker",
@@ -167,6 +168,9 @@ CONFIG_SCHEMA = cv.Schema(
             ),
             validate_scan_parameters,
         ),
+        cv.Optional(
+            CONF_DEDUP_INTERVAL, default="0ms"
+        ): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_ON_BLE_ADVERTISE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ESPBTAdvertiseTrigger),
@@ -224,6 +228,7 @@ async def to_code(config):
     cg.add(var.set_scan_window(int(params[CONF_WINDOW].total_milliseconds / 0.625)))
     cg.add(var.set_scan_active(params[CONF_ACTIVE]))
     cg.add(var.set_scan_continuous(params[CONF_CONTINUOUS]))
+    cg.add(var.set_dedup_interval(config[CONF_DEDUP_INTERVAL]))
     for conf in config.get(CONF_ON_BLE_ADVERTISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         if CONF_MAC_ADDRESS in conf:
@@ -323,6 +328,9 @@ async def esp32_ble_tracker_stop_scan_action_to_code(
 async def register_ble_device(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_listener(var))
+    # Devices are matched by their MAC address, let the tracker only pass those to the listener
+    if CONF_MAC_ADDRESS in config:
+        cg.add(var.add_address_filter(config[CONF_MAC_ADDRESS].as_hex))
     return var
 
 
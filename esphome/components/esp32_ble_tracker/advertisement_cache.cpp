@@ -0,0 +1,47 @@
+#include "advertisement_cache.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+AdvertisementCache::Entry *AdvertisementCache::find_or_insert(uint64_t address) {
+  if (!this->entries_) {
+    this->entries_.reset(new Entry[CAPACITY]);  // NOLINT(cppcoreguidelines-owning-memory)
+    this->clear();
+  }
+  // The lower bits of random addresses are random, mix in the upper ones for public addresses of one vendor
+  uint32_t index = uint32_t(address ^ (address >> 24)) & (CAPACITY - 1);
+  for (uint16_t probe = 0; probe < CAPACITY; probe++) {
+    Entry &entry = this->entries_[index];
+    if (entry.address == address)
+      return &entry;
+    if (entry.address == 0) {
+      if (this->size_ >= MAX_DEVICES)
+        return nullptr;
+      this->size_++;
+      entry.address = address;
+      return &entry;
+    }
+    index = (index + 1) & (CAPACITY - 1);
+  }
+  return nullptr;
+}
+
+void AdvertisementCache::clear() {
+  if (this->entries_)
+    memset(this->entries_.get(), 0, CAPACITY * sizeof(Entry));
+  this->size_ = 0;
+}
+
+uint32_t AdvertisementCache::payload_hash(const uint8_t *data, size_t len) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+/** Fixed-size open-addressing hash table of the BLE devices seen during the current scan.
+ *
+ * Each entry keeps the hash of the last advertisement payload of a device, so that byte-identical advertisements
+ * can be recognized without parsing them, and whether the device has been printed already. Entries are never removed
+ * individually, the whole table is cleared when a scan ends. The table is allocated on first use.
+ */
+class AdvertisementCache {
+ public:
+  /// Number of slots, must be a power of two. 16 KiB, which leaves room for a few hundred devices.
+  static const uint16_t CAPACITY = 512;
+  /// Maximum number of devices stored, to keep the probe sequences short.
+  static const uint16_t MAX_DEVICES = CAPACITY * 3 / 4;
+
+  /// Payload kinds tracked separately, as active scans alternate between advertisements and scan responses.
+  enum PayloadKind : uint8_t { ADVERTISEMENT = 0, SCAN_RESPONSE = 1 };
+
+  struct Entry {
+    /// The device's address, 0 for an empty slot.
+    uint64_t address;
+    uint32_t payload_hash[2];
+    /// millis() when the last payload of each kind was passed on to the listeners.
+    uint32_t last_dispatch[2];
+    /// Bit mask of the payload kinds seen so far.
+    uint8_t has_payload;
+    bool printed;
+  };
+
+  /// Find the entry of a device, inserting it if it's new. Returns nullptr if the table is full.
+  Entry *find_or_insert(uint64_t address);
+  void clear();
+  uint16_t size() const { return this->size_; }
+
+  /// FNV-1a hash of an advertisement payload.
+  static uint32_t payload_hash(const uint8_t *data, size_t len);
+
+ protected:
+  std::unique_ptr<Entry[]> entries_;
+  uint16_t size_{0};
+};
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
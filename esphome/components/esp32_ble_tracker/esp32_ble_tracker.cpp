@@ -15,6 +15,7 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cinttypes>
 
 #ifdef USE_OTA
@@ -120,15 +121,15 @@ void ESP32BLETracker::loop() {
       }
 
       if (this->parse_advertisements_) {
+        const uint32_t now = millis();
         for (size_t i = 0; i < index; i++) {
+          if (this->dedup_interval_ != 0 && this->is_duplicate_advertisement_(this->scan_result_buffer_[i], now))
+            continue;
+
           ESPBTDevice device;
           device.parse_scan_rst(this->scan_result_buffer_[i]);
 
-          bool found = false;
-          for (auto *listener : this->listeners_) {
-            if (listener->parse_device(device))
-              found = true;
-          }
+          bool found = this->dispatch_device_(device);
 
           for (auto *client : this->clients_) {
             if (client->parse_device(device)) {
@@ -268,6 +269,7 @@ void ESP32BLETracker::start_scan_(bool first) {
     for (auto *listener : this->listeners_)
       listener->on_scan_end();
   }
+  this->advertisement_cache_.clear();
   this->already_discovered_.clear();
   this->scan_params_.scan_type = this->scan_active_ ? BLE_SCAN_TYPE_ACTIVE : BLE_SCAN_TYPE_PASSIVE;
   this->scan_params_.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
@@ -302,6 +304,7 @@ void ESP32BLETracker::end_of_scan_() {
 
   ESP_LOGD(TAG, "End of scan.");
   this->scanner_idle_ = true;
+  this->advertisement_cache_.clear();
   this->already_discovered_.clear();
   xSemaphoreGive(this->scan_end_lock_);
   this->cancel_timeout("scan");
@@ -322,6 +325,80 @@ void ESP32BLETracker::register_listener(ESPBTDeviceListener *listener) {
   this->recalculate_advertisement_parser_types();
 }
 
+void ESP32BLETracker::compile_listener_filters_() {
+  this->address_listeners_.clear();
+  this->service_data_listeners_.clear();
+  this->manufacturer_data_listeners_.clear();
+  this->unfiltered_listeners_.clear();
+  for (auto *listener : this->listeners_) {
+    if (listener->get_advertisement_parser_type() != AdvertisementParserType::PARSED_ADVERTISEMENTS)
+      continue;
+    if (!listener->get_address_filters().empty()) {
+      for (uint64_t address : listener->get_address_filters())
+        this->address_listeners_.emplace_back(address, listener);
+    } else if (listener->get_service_data_uuid_filter().has_value()) {
+      this->service_data_listeners_.push_back(listener);
+    } else if (listener->get_manufacturer_id_filter().has_value()) {
+      this->manufacturer_data_listeners_.push_back(listener);
+    } else {
+      this->unfiltered_listeners_.push_back(listener);
+    }
+  }
+  // Sorted by address for binary search, stable to keep the registration order for listeners of the same device
+  std::stable_sort(this->address_listeners_.begin(), this->address_listeners_.end(),
+                   [](const std::pair<uint64_t, ESPBTDeviceListener *> &a,
+                      const std::pair<uint64_t, ESPBTDeviceListener *> &b) { return a.first < b.first; });
+  this->listener_filters_compiled_ = true;
+  ESP_LOGV(TAG, "Listeners: %zu by address, %zu by service data, %zu by manufacturer data, %zu unfiltered",
+           this->address_listeners_.size(), this->service_data_listeners_.size(),
+           this->manufacturer_data_listeners_.size(), this->unfiltered_listeners_.size());
+}
+
+bool ESP32BLETracker::dispatch_device_(const ESPBTDevice &device) {
+  if (!this->listener_filters_compiled_)
+    this->compile_listener_filters_();
+
+  bool found = false;
+  for (auto *listener : this->unfiltered_listeners_) {
+    if (listener->parse_device(device))
+      found = true;
+  }
+
+  const uint64_t address = device.address_uint64();
+  auto it = std::lower_bound(
+      this->address_listeners_.begin(), this->address_listeners_.end(), address,
+      [](const std::pair<uint64_t, ESPBTDeviceListener *> &entry, uint64_t value) { return entry.first < value; });
+  for (; it != this->address_listeners_.end() && it->first == address; ++it) {
+    if (it->second->parse_device(device))
+      found = true;
+  }
+
+  if (!this->service_data_listeners_.empty()) {
+    for (auto *listener : this->service_data_listeners_) {
+      for (auto &service_data : device.get_service_datas()) {
+        if (service_data.uuid == *listener->get_service_data_uuid_filter()) {
+          if (listener->parse_device(device))
+            found = true;
+          break;
+        }
+      }
+    }
+  }
+
+  if (!this->manufacturer_data_listeners_.empty()) {
+    for (auto *listener : this->manufacturer_data_listeners_) {
+      for (auto &manufacturer_data : device.get_manufacturer_datas()) {
+        if (manufacturer_data.uuid == *listener->get_manufacturer_id_filter()) {
+          if (listener->parse_device(device))
+            found = true;
+          break;
+        }
+      }
+    }
+  }
+  return found;
+}
+
 void ESP32BLETracker::recalculate_advertisement_parser_types() {
   this->raw_advertisements_ = false;
   this->parse_advertisements_ = false;
@@ -332,6 +409,8 @@ void ESP32BLETracker::recalculate_advertisement_parser_types() {
       this->raw_advertisements_ = true;
     }
   }
+  // Only listeners of parsed advertisements are in the lookup tables, which changes with the parser type
+  this->listener_filters_compiled_ = false;
   for (auto *client : this->clients_) {
     if (client->get_advertisement_parser_type() == AdvertisementParserType::PARSED_ADVERTISEMENTS) {
       this->parse_advertisements_ = true;
@@ -394,6 +473,29 @@ void ESP32BLETracker::gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_re
   }
 }
 
+bool ESP32BLETracker::is_duplicate_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param,
+                                                  uint32_t now) {
+  auto *entry = this->advertisement_cache_.find_or_insert(esp32_ble::ble_addr_to_uint64(param.bda));
+  if (entry == nullptr) {
+    if (!this->advertisement_cache_full_logged_) {
+      ESP_LOGW(TAG, "More than %u devices in range, advertisements of the others are passed on unfiltered",
+               AdvertisementCache::MAX_DEVICES);
+      this->advertisement_cache_full_logged_ = true;
+    }
+    return false;
+  }
+  const uint8_t kind = param.ble_evt_type == ESP_BLE_EVT_SCAN_RSP ? AdvertisementCache::SCAN_RESPONSE
+                                                                   : AdvertisementCache::ADVERTISEMENT;
+  const uint32_t hash = AdvertisementCache::payload_hash(param.ble_adv, param.adv_data_len + param.scan_rsp_len);
+  if ((entry->has_payload & (1 << kind)) && entry->payload_hash[kind] == hash &&
+      now - entry->last_dispatch[kind] < this->dedup_interval_)
+    return true;
+  entry->has_payload |= 1 << kind;
+  entry->payload_hash[kind] = hash;
+  entry->last_dispatch[kind] = now;
+  return false;
+}
+
 void ESP32BLETracker::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
                                           esp_ble_gattc_cb_param_t *param) {
   for (auto *client : this->clients_) {
@@ -401,6 +503,24 @@ void ESP32BLETracker::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_i
   }
 }
 
+void ESPBTDeviceListener::add_address_filter(uint64_t address) {
+  this->address_filters_.push_back(address);
+  if (this->parent_ != nullptr)
+    this->parent_->invalidate_listener_filters();
+}
+
+void ESPBTDeviceListener::set_service_data_uuid_filter(ESPBTUUID uuid) {
+  this->service_data_uuid_filter_ = uuid;
+  if (this->parent_ != nullptr)
+    this->parent_->invalidate_listener_filters();
+}
+
+void ESPBTDeviceListener::set_manufacturer_id_filter(ESPBTUUID id) {
+  this->manufacturer_id_filter_ = id;
+  if (this->parent_ != nullptr)
+    this->parent_->invalidate_listener_filters();
+}
+
 ESPBLEiBeacon::ESPBLEiBeacon(const uint8_t *data) { memcpy(&this->beacon_data_, data, sizeof(beacon_data_)); }
 optional<ESPBLEiBeacon> ESPBLEiBeacon::from_manufacturer_data(const ServiceData &data) {
   if (!data.uuid.contains(0x4C, 0x00))
@@ -648,15 +768,27 @@ void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "  Scan Window: %.1f ms", this->scan_window_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Type: %s", this->scan_active_ ? "ACTIVE" : "PASSIVE");
   ESP_LOGCONFIG(TAG, "  Continuous Scanning: %s", this->scan_continuous_ ? "True" : "False");
+  if (this->dedup_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Skip Unchanged Advertisements For: %" PRIu32 " ms", this->dedup_interval_);
+  }
 }
 
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
-  const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
+  if (this->dedup_interval_ != 0) {
+    auto *entry = this->advertisement_cache_.find_or_insert(device.address_uint64());
+    if (entry != nullptr) {
+      if (entry->printed)
+        return;
+      entry->printed = true;
+    }
+  } else {
+    const uint64_t address = device.address_uint64();
+    for (auto &disc : this->already_discovered_) {
+      if (disc == address)
+        return;
+    }
+    this->already_discovered_.push_back(address);
   }
-  this->already_discovered_.push_back(address);
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
@@ -20,6 +20,8 @@
 #include "esphome/components/esp32_ble/ble.h"
 #include "esphome/components/esp32_ble/ble_uuid.h"
 
+#include "advertisement_cache.h"
+
 namespace esphome {
 namespace esp32_ble_tracker {
 
@@ -126,8 +128,27 @@ class ESPBTDeviceListener {
   };
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
+  /** Only pass devices with one of the filtered addresses to parse_device().
+   *
+   * The tracker compiles the filters of all listeners into lookup tables, so that a device is only passed to the
+   * listeners interested in it. Listeners without filters get all devices. If addresses are filtered, the UUID
+   * filters are not used. parse_device() still has to check the device, filters only reduce the number of calls.
+   */
+  void add_address_filter(uint64_t address);
+  /// Only pass devices with service data for this UUID to parse_device().
+  void set_service_data_uuid_filter(ESPBTUUID uuid);
+  /// Only pass devices with manufacturer data for this ID to parse_device().
+  void set_manufacturer_id_filter(ESPBTUUID id);
+
+  const std::vector<uint64_t> &get_address_filters() const { return this->address_filters_; }
+  const optional<ESPBTUUID> &get_service_data_uuid_filter() const { return this->service_data_uuid_filter_; }
+  const optional<ESPBTUUID> &get_manufacturer_id_filter() const { return this->manufacturer_id_filter_; }
+
  protected:
   ESP32BLETracker *parent_{nullptr};
+  std::vector<uint64_t> address_filters_;
+  optional<ESPBTUUID> service_data_uuid_filter_;
+  optional<ESPBTUUID> manufacturer_id_filter_;
 };
 
 enum class ClientState {
@@ -188,6 +209,11 @@ class ESP32BLETracker : public Component,
   void set_scan_window(uint32_t scan_window) { scan_window_ = scan_window; }
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+  /** Set for how long in ms advertisements identical to the last one of a device are skipped, 0 to never skip them.
+   *
+   * Skipped advertisements are neither parsed nor passed on to the listeners and clients.
+   */
+  void set_dedup_interval(uint32_t dedup_interval) { dedup_interval_ = dedup_interval; }
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -197,6 +223,8 @@ class ESP32BLETracker : public Component,
   void loop() override;
 
   void register_listener(ESPBTDeviceListener *listener);
+  /// Recompile the listener lookup tables before the next dispatch, called when the filters of a listener change.
+  void invalidate_listener_filters() { this->listener_filters_compiled_ = false; }
   void register_client(ESPBTClient *client);
   void recalculate_advertisement_parser_types();
 
@@ -224,12 +252,30 @@ class ESP32BLETracker : public Component,
   void gap_scan_start_complete_(const esp_ble_gap_cb_param_t::ble_scan_start_cmpl_evt_param &param);
   /// Called when a `ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT` event is received.
   void gap_scan_stop_complete_(const esp_ble_gap_cb_param_t::ble_scan_stop_cmpl_evt_param &param);
+  /// Sort the listeners into lookup tables by their filters.
+  void compile_listener_filters_();
+  /// Pass a device to the listeners whose filters match it. Returns true if one of them handled it.
+  bool dispatch_device_(const ESPBTDevice &device);
+  /// Whether the advertisement is identical to the last one of its device, which was dispatched recently.
+  bool is_duplicate_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param, uint32_t now);
 
   int app_id_;
 
-  /// Vector of addresses that have already been printed in print_bt_device_info
+  /// Devices seen during the current scan, with their last payload and whether they were printed. Only used, and
+  /// allocated, when dedup_interval_ is set.
+  AdvertisementCache advertisement_cache_;
+  uint32_t dedup_interval_{0};
+  /// Whether it has been logged that the cache ran out of slots
+  bool advertisement_cache_full_logged_{false};
+  /// Vector of addresses that have already been printed in print_bt_device_info, without dedup_interval_
   std::vector<uint64_t> already_discovered_;
   std::vector<ESPBTDeviceListener *> listeners_;
+  /// Listeners by filter, compiled from listeners_ on first use after a listener was registered.
+  std::vector<std::pair<uint64_t, ESPBTDeviceListener *>> address_listeners_;
+  std::vector<ESPBTDeviceListener *> service_data_listeners_;
+  std::vector<ESPBTDeviceListener *> manufacturer_data_listeners_;
+  std::vector<ESPBTDeviceListener *> unfiltered_listeners_;
+  bool listener_filters_compiled_{false};
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
   /// A structure holding the ESP BLE scan parameters.
@@ -10,7 +10,9 @@ extern "C" {
 #include "esphome/core/log.h"
 #include "esphome/core/preferences.h"
 #include "preferences.h"
+#include <Esp.h>
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -34,6 +36,16 @@ static const uint32_t ESP8266_FLASH_STORAGE_SIZE = 128;
 static const uint32_t ESP8266_FLASH_STORAGE_SIZE = 64;
 #endif
 
+// Preferences in flash are appended to a log that rotates over these sectors, ending with the legacy sector
+static const uint32_t ESP8266_FLASH_LOG_SECTORS = 4;
+static const uint32_t SECTOR_WORDS = SPI_FLASH_SEC_SIZE / 4;
+static const uint32_t LOG_MAGIC = 0x4C505345;  // "ESPL"
+// Magic, sequence number and CRC, written after the snapshot the sector starts with
+static const uint32_t LOG_HEADER_WORDS = 3;
+// Type, info (length in words and ordinal) and CRC around the data of each record
+static const uint32_t RECORD_OVERHEAD_WORDS = 3;
+static const uint32_t ERASED_WORD = 0xFFFFFFFF;
+
 static inline bool esp_rtc_user_mem_read(uint32_t index, uint32_t *dest) {
   if (index >= ESP_RTC_USER_MEM_SIZE_WORDS) {
     return false;
@@ -55,18 +67,54 @@ static inline bool esp_rtc_user_mem_write(uint32_t index, uint32_t value) {
   return true;
 }
 
-extern "C" uint32_t _SPIFFS_end;  // NOLINT
+extern "C" uint32_t _SPIFFS_start;  // NOLINT
+extern "C" uint32_t _SPIFFS_end;    // NOLINT
 
-static uint32_t get_esp8266_flash_sector() {
+static uint32_t flash_symbol_sector(uint32_t *symbol) {
   union {
     uint32_t *ptr;
     uint32_t uint;
   } data{};
-  data.ptr = &_SPIFFS_end;
+  data.ptr = symbol;
   return (data.uint - 0x40200000) / SPI_FLASH_SEC_SIZE;
 }
+static uint32_t get_esp8266_flash_sector() { return flash_symbol_sector(&_SPIFFS_end); }
 static uint32_t get_esp8266_flash_address() { return get_esp8266_flash_sector() * SPI_FLASH_SEC_SIZE; }
 
+static bool read_flash(uint32_t address, uint32_t *data, size_t len) {
+  InterruptLock lock;
+  return spi_flash_read(address, data, len * 4) == SPI_FLASH_RESULT_OK;
+}
+
+static bool write_flash(uint32_t address, const uint32_t *data, size_t len) {
+  InterruptLock lock;
+  return spi_flash_write(address, const_cast<uint32_t *>(data), len * 4) == SPI_FLASH_RESULT_OK;
+}
+
+static bool erase_flash(uint32_t sector) {
+  InterruptLock lock;
+  return spi_flash_erase_sector(sector) == SPI_FLASH_RESULT_OK;
+}
+
+static uint32_t log_crc(const uint32_t *data, size_t len) {
+  const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len * 4; i++) {
+    crc ^= bytes[i];
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+static void append_record(std::vector<uint32_t> &buffer, uint32_t type, uint32_t info, const uint32_t *data) {
+  size_t start = buffer.size();
+  buffer.push_back(type);
+  buffer.push_back(info);
+  buffer.insert(buffer.end(), data, data + (info & 0xFFFF));
+  buffer.push_back(log_crc(&buffer[start], buffer.size() - start));
+}
+
 template<class It> uint32_t calculate_crc(It first, It last, uint32_t type) {
   uint32_t crc = type;
   while (first != last) {
@@ -75,15 +123,17 @@ template<class It> uint32_t calculate_crc(It first, It last, uint32_t type) {
   return crc;
 }
 
-static bool save_to_flash(size_t offset, const uint32_t *data, size_t len) {
+static bool save_to_flash(size_t offset, const uint32_t *data, size_t len, bool *changed) {
   for (uint32_t i = 0; i < len; i++) {
     uint32_t j = offset + i;
     if (j >= ESP8266_FLASH_STORAGE_SIZE)
       return false;
     uint32_t v = data[i];
     uint32_t *ptr = &s_flash_storage[j];
-    if (*ptr != v)
+    if (*ptr != v) {
       s_flash_dirty = true;
+      *changed = true;
+    }
     *ptr = v;
   }
   return true;
@@ -121,6 +171,10 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
   uint32_t type = 0;
   bool in_flash = false;
   size_t length_words = 0;
+  // Key of the log records next to the type: the length and the ordinal among preferences of the same type
+  uint32_t info = 0;
+  // Changed since it was last written to the log
+  bool dirty = false;
 
   bool save(const uint8_t *data, size_t len) override {
     if ((len + 3) / 4 != length_words) {
@@ -132,7 +186,7 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
     buffer[buffer.size() - 1] = calculate_crc(buffer.begin(), buffer.end() - 1, type);
 
     if (in_flash) {
-      return save_to_flash(offset, buffer.data(), buffer.size());
+      return save_to_flash(offset, buffer.data(), buffer.size(), &this->dirty);
     } else {
       return save_to_rtc(offset, buffer.data(), buffer.size());
     }
@@ -162,6 +216,18 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
   }
 };
 
+/// A record of the log that no preference was made for (yet), kept when the log is compacted.
+struct LogEntry {
+  uint32_t type;
+  uint32_t info;
+  uint16_t offset;  // of the data in the active sector, in words
+};
+
+/** Preferences in flash are kept in RAM and written to a log: each sync appends records for the preferences that
+ * changed, so flash is only erased when a sector fills up. The log then continues in the next sector, starting with
+ * a snapshot of all preferences. Its header is written last, so until the snapshot is complete the previous sector
+ * stays the valid one, and records cut short by a power loss fail their CRC.
+ */
 class ESP8266Preferences : public ESPPreferences {
  public:
   uint32_t current_offset = 0;
@@ -171,10 +237,31 @@ class ESP8266Preferences : public ESPPreferences {
     s_flash_storage = new uint32_t[ESP8266_FLASH_STORAGE_SIZE];  // NOLINT
     ESP_LOGVV(TAG, "Loading preferences from flash...");
 
-    {
-      InterruptLock lock;
-      spi_flash_read(get_esp8266_flash_address(), s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
+    // The log must stay clear of the firmware below it, and of a filesystem. The linker script places that right
+    // below the legacy sector, so with one there's only the legacy sector.
+    const uint32_t sector = get_esp8266_flash_sector();
+    const uint32_t sketch_size = ESP.getSketchSize();  // NOLINT(readability-static-accessed-through-instance)
+    uint32_t first_free = (sketch_size + SPI_FLASH_SEC_SIZE - 1) / SPI_FLASH_SEC_SIZE;
+    if (flash_symbol_sector(&_SPIFFS_start) != sector)
+      first_free = std::max(first_free, sector);
+    this->sectors_ = sector >= first_free ? std::min(sector - first_free + 1, ESP8266_FLASH_LOG_SECTORS) : 1;
+
+    for (uint32_t i = 0; i < this->sectors_; i++) {
+      uint32_t header[LOG_HEADER_WORDS];
+      if (!read_flash(this->sector_address_(i), header, LOG_HEADER_WORDS) || header[0] != LOG_MAGIC ||
+          header[2] != log_crc(header, 2))
+        continue;
+      if (this->active_ < 0 || header[1] > this->sequence_) {
+        this->active_ = i;
+        this->sequence_ = header[1];
+      }
+    }
+    if (this->active_ < 0) {
+      // Written by versions without the log, at fixed offsets of the last sector
+      read_flash(get_esp8266_flash_address(), s_flash_storage, ESP8266_FLASH_STORAGE_SIZE);
+      return;
     }
+    this->replay_();
   }
 
   ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
@@ -189,6 +276,15 @@ class ESP8266Preferences : public ESPPreferences {
       pref->type = type;
       pref->length_words = length_words;
       pref->in_flash = true;
+      uint32_t ordinal = 0;
+      for (auto *other : this->flash_prefs_) {
+        if (other->type == type && other->length_words == length_words)
+          ordinal++;
+      }
+      pref->info = length_words | ordinal << 16;
+      if (this->active_ >= 0)
+        this->restore_(pref);
+      this->flash_prefs_.push_back(pref);
       current_flash_offset = end;
       return {pref};
     }
@@ -236,51 +332,180 @@ class ESP8266Preferences : public ESPPreferences {
       return false;
 
     ESP_LOGD(TAG, "Saving preferences to flash...");
-    SpiFlashOpResult erase_res, write_res = SPI_FLASH_RESULT_OK;
-    {
-      InterruptLock lock;
-      erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
-      if (erase_res == SPI_FLASH_RESULT_OK) {
-        write_res = spi_flash_write(get_esp8266_flash_address(), s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
+    if (this->active_ >= 0 && !this->needs_compaction_ && this->append_dirty_())
+      return true;
+    return this->compact_into_(this->next_sector_());
+  }
+
+  bool reset() override {
+    ESP_LOGD(TAG, "Cleaning up preferences in flash...");
+    for (uint32_t i = 0; i < this->sectors_; i++) {
+      if (!erase_flash(this->sector_address_(i) / SPI_FLASH_SEC_SIZE)) {
+        ESP_LOGE(TAG, "Erase ESP8266 flash failed!");
+        return false;
       }
     }
-    if (erase_res != SPI_FLASH_RESULT_OK) {
-      ESP_LOGE(TAG, "Erase ESP8266 flash failed!");
-      return false;
+
+    // Protect flash from writing till restart
+    s_prevent_write = true;
+    return true;
+  }
+
+  /// Move the log to the last sector, the others are overwritten by the image of an OTA update.
+  void move_log_to_last_sector() {
+    if (s_prevent_write)
+      return;
+    // Compact into the last sector also when it's full, the next one would be overwritten
+    const uint32_t last = this->sectors_ - 1;
+    if (this->active_ != (int) last || this->needs_compaction_ || !this->append_dirty_())
+      this->compact_into_(last);
+  }
+
+ protected:
+  uint32_t sector_address_(uint32_t index) const {
+    return (get_esp8266_flash_sector() + 1 - this->sectors_ + index) * SPI_FLASH_SEC_SIZE;
+  }
+  uint32_t next_sector_() const { return this->active_ < 0 ? 0 : (this->active_ + 1) % this->sectors_; }
+
+  /// Append records for the changed preferences to the active sector, false if they don't fit or writing failed.
+  bool append_dirty_() {
+    std::vector<uint32_t> buffer;
+    for (auto *pref : this->flash_prefs_) {
+      if (pref->dirty)
+        append_record(buffer, pref->type, pref->info, &s_flash_storage[pref->offset]);
     }
-    if (write_res != SPI_FLASH_RESULT_OK) {
+    if (this->write_offset_ + buffer.size() > SECTOR_WORDS)
+      return false;
+    if (!buffer.empty() &&
+        !write_flash(this->sector_address_(this->active_) + this->write_offset_ * 4, buffer.data(), buffer.size())) {
       ESP_LOGE(TAG, "Write ESP8266 flash failed!");
+      // Records may be partly written, start over in another sector
+      this->needs_compaction_ = true;
       return false;
     }
-
-    s_flash_dirty = false;
+    this->write_offset_ += buffer.size();
+    this->clear_dirty_();
     return true;
   }
 
-  bool reset() override {
-    ESP_LOGD(TAG, "Cleaning up preferences in flash...");
-    SpiFlashOpResult erase_res;
-    {
-      InterruptLock lock;
-      erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
+  void replay_() {
+    const uint32_t address = this->sector_address_(this->active_);
+    uint32_t offset = LOG_HEADER_WORDS;
+    std::vector<uint32_t> record;
+    while (offset + RECORD_OVERHEAD_WORDS <= SECTOR_WORDS) {
+      uint32_t key[2];
+      if (!read_flash(address + offset * 4, key, 2) || (key[0] == ERASED_WORD && key[1] == ERASED_WORD))
+        break;
+      const uint32_t size = (key[1] & 0xFFFF) + RECORD_OVERHEAD_WORDS;
+      bool valid = size <= ESP8266_FLASH_STORAGE_SIZE + RECORD_OVERHEAD_WORDS && offset + size <= SECTOR_WORDS;
+      if (valid) {
+        record.resize(size);
+        valid = read_flash(address + offset * 4, record.data(), size) &&
+                record[size - 1] == log_crc(record.data(), size - 1);
+      }
+      if (!valid) {
+        // Cut short by a power loss, nothing can be appended after it
+        this->needs_compaction_ = true;
+        break;
+      }
+      auto it = std::find_if(this->entries_.begin(), this->entries_.end(),
+                             [&key](const LogEntry &entry) { return entry.type == key[0] && entry.info == key[1]; });
+      if (it == this->entries_.end())
+        it = this->entries_.insert(it, LogEntry{key[0], key[1], 0});
+      it->offset = offset + 2;
+      offset += size;
+    }
+    this->write_offset_ = offset;
+  }
+
+  void restore_(ESP8266PreferenceBackend *pref) {
+    uint32_t *data = &s_flash_storage[pref->offset];
+    auto it = std::find_if(this->entries_.begin(), this->entries_.end(), [pref](const LogEntry &entry) {
+      return entry.type == pref->type && entry.info == pref->info;
+    });
+    if (it != this->entries_.end()) {
+      bool ok = read_flash(this->sector_address_(this->active_) + it->offset * 4, data, pref->length_words);
+      this->entries_.erase(it);
+      if (ok) {
+        data[pref->length_words] = calculate_crc(data, data + pref->length_words, pref->type);
+        return;
+      }
     }
-    if (erase_res != SPI_FLASH_RESULT_OK) {
+    // Not saved yet, loading fails
+    data[pref->length_words] = calculate_crc(data, data + pref->length_words, pref->type) + 1;
+  }
+
+  bool compact_into_(uint32_t sector) {
+    std::vector<uint32_t> buffer;
+    for (auto *pref : this->flash_prefs_) {
+      uint32_t *data = &s_flash_storage[pref->offset];
+      if (data[pref->length_words] == calculate_crc(data, data + pref->length_words, pref->type))
+        append_record(buffer, pref->type, pref->info, data);
+    }
+    // Keep the records of other firmware versions, as long as they fit in half a sector
+    std::vector<uint32_t> data;
+    for (auto it = this->entries_.begin(); it != this->entries_.end();) {
+      data.resize(it->info & 0xFFFF);
+      if (LOG_HEADER_WORDS + buffer.size() + data.size() + RECORD_OVERHEAD_WORDS > SECTOR_WORDS / 2 ||
+          !read_flash(this->sector_address_(this->active_) + it->offset * 4, data.data(), data.size())) {
+        it = this->entries_.erase(it);
+        continue;
+      }
+      it->offset = LOG_HEADER_WORDS + buffer.size() + 2;
+      append_record(buffer, it->type, it->info, data.data());
+      it++;
+    }
+
+    ESP_LOGD(TAG, "Compacting preferences into flash sector %u", sector);
+    const uint32_t address = this->sector_address_(sector);
+    uint32_t header[LOG_HEADER_WORDS] = {LOG_MAGIC, this->sequence_ + 1, 0};
+    header[2] = log_crc(header, 2);
+    if (!erase_flash(address / SPI_FLASH_SEC_SIZE)) {
       ESP_LOGE(TAG, "Erase ESP8266 flash failed!");
       return false;
     }
+    if ((!buffer.empty() && !write_flash(address + LOG_HEADER_WORDS * 4, buffer.data(), buffer.size())) ||
+        !write_flash(address, header, LOG_HEADER_WORDS)) {
+      ESP_LOGE(TAG, "Write ESP8266 flash failed!");
+      return false;
+    }
 
-    // Protect flash from writing till restart
-    s_prevent_write = true;
+    this->active_ = sector;
+    this->sequence_++;
+    this->write_offset_ = LOG_HEADER_WORDS + buffer.size();
+    this->needs_compaction_ = false;
+    this->clear_dirty_();
     return true;
   }
+
+  void clear_dirty_() {
+    for (auto *pref : this->flash_prefs_)
+      pref->dirty = false;
+    s_flash_dirty = false;
+  }
+
+  std::vector<ESP8266PreferenceBackend *> flash_prefs_;
+  std::vector<LogEntry> entries_;
+  uint32_t sectors_{1};
+  int active_{-1};  // index of the sector the log is appended to, none with the legacy layout
+  uint32_t sequence_{0};
+  uint32_t write_offset_{0};  // in words
+  bool needs_compaction_{false};
 };
 
+static ESP8266Preferences *s_preferences = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 void setup_preferences() {
   auto *pref = new ESP8266Preferences();  // NOLINT(cppcoreguidelines-owning-memory)
   pref->setup();
+  s_preferences = pref;
   global_preferences = pref;
 }
-void preferences_prevent_write(bool prevent) { s_prevent_write = prevent; }
+void preferences_prevent_write(bool prevent) {
+  if (prevent && s_preferences != nullptr)
+    s_preferences->move_log_to_last_sector();
+  s_prevent_write = prevent;
+}
 
 }  // namespace esp8266
 
@@ -1,7 +1,13 @@
 #ifdef USE_HOST
 
 #include "preferences.h"
+#include <cinttypes>
+#include <cstdio>
 #include <cstring>
+#include <map>
+#include <sys/stat.h>
+#include "esphome/components/preferences/keyed_preferences.h"
+#include "esphome/core/application.h"
 #include "esphome/core/preferences.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
@@ -12,14 +18,96 @@ namespace host {
 
 static const char *const TAG = "host.preferences";
 
-class HostPreferences : public ESPPreferences {
- public:
-  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override { return {}; }
+/// Preferences in a file under ~/.esphome/prefs, rewritten on every commit.
+class HostPreferences : public preferences::KeyedPreferences {
+ protected:
+  /// Preferences keep their length in 16 bits
+  static const uint32_t MAX_VALUE_LENGTH = 65535;
 
-  ESPPreferenceObject make_preference(size_t length, uint32_t type) override { return {}; }
+  bool read_(const char *key, uint8_t *data, size_t len) override {
+    this->open_();
+    auto it = this->values_.find(key);
+    if (it == this->values_.end() || it->second.size() != len)
+      return false;
+    memcpy(data, it->second.data(), len);
+    return true;
+  }
 
-  bool sync() override { return true; }
-  bool reset() override { return true; }
+  bool write_(const char *key, const uint8_t *data, size_t len) override {
+    if (this->erased_)
+      return false;
+    this->open_();
+    this->values_[key].assign(data, data + len);
+    return true;
+  }
+
+  bool commit_() override {
+    std::string dir = this->filename_.substr(0, this->filename_.rfind('/'));
+    mkdir(dir.substr(0, dir.rfind('/')).c_str(), 0755);
+    mkdir(dir.c_str(), 0755);
+    // Replace the file at once, a crash while writing leaves the previous one
+    std::string temp = this->filename_ + ".tmp";
+    FILE *file = fopen(temp.c_str(), "wb");
+    if (file == nullptr) {
+      ESP_LOGW(TAG, "Could not open %s for writing", temp.c_str());
+      return false;
+    }
+    bool ok = true;
+    for (const auto &value : this->values_) {
+      uint8_t key_len = value.first.size();
+      uint32_t len = value.second.size();
+      ok = ok && fwrite(&key_len, 1, 1, file) == 1 && fwrite(value.first.data(), 1, key_len, file) == key_len &&
+           fwrite(&len, sizeof(len), 1, file) == 1 && fwrite(value.second.data(), 1, len, file) == len;
+    }
+    ok = fclose(file) == 0 && ok;
+    if (!ok || rename(temp.c_str(), this->filename_.c_str()) != 0) {
+      ESP_LOGW(TAG, "Writing %s failed", this->filename_.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  void erase_() override {
+    this->open_();
+    this->values_.clear();
+    remove(this->filename_.c_str());
+    // Like on devices, nothing is saved until restart
+    this->erased_ = true;
+  }
+
+  void open_() {
+    if (!this->filename_.empty())
+      return;
+    // The name of the application is only known once setup() started
+    const char *home = getenv("HOME");  // NOLINT(concurrency-mt-unsafe)
+    this->filename_ = std::string(home != nullptr ? home : ".") + "/.esphome/prefs/" + App.get_name() + ".prefs";
+    FILE *file = fopen(this->filename_.c_str(), "rb");
+    if (file == nullptr)
+      return;
+    struct stat st;
+    long size = fstat(fileno(file), &st) == 0 ? st.st_size : 0;
+    uint8_t key_len;
+    while (fread(&key_len, 1, 1, file) == 1) {
+      std::string key(key_len, '\0');
+      uint32_t len;
+      if (fread(&key[0], 1, key_len, file) != key_len || fread(&len, sizeof(len), 1, file) != 1)
+        break;
+      // A corrupt length must not allocate more than the file holds
+      if (len > MAX_VALUE_LENGTH || len > size - ftell(file)) {
+        ESP_LOGW(TAG, "Invalid length %" PRIu32 " of %s in %s", len, key.c_str(), this->filename_.c_str());
+        break;
+      }
+      std::vector<uint8_t> data(len);
+      if (fread(data.data(), 1, len, file) != len)
+        break;
+      this->values_[key] = std::move(data);
+    }
+    fclose(file);
+  }
+
+  std::string filename_;
+  std::map<std::string, std::vector<uint8_t>> values_;
+  bool erased_{false};
 };
 
 void setup_preferences() {
@@ -10,11 +10,19 @@ from esphome.const import (
     CONF_TRIGGER_ID,
     CONF_URL,
     CONF_ESP8266_DISABLE_SSL_SUPPORT,
+    PLATFORM_ESP32,
+    PLATFORM_HOST,
 )
 from esphome.core import Lambda, CORE
 
 DEPENDENCIES = ["network"]
-AUTO_LOAD = ["json"]
+
+
+def AUTO_LOAD():
+    if _supports_async():
+        return ["json", "socket"]
+    return ["json"]
+
 
 http_request_ns = cg.esphome_ns.namespace("http_request")
 HttpRequestComponent = http_request_ns.class_("HttpRequestComponent", cg.Component)
@@ -33,6 +41,13 @@ CONF_VERIFY_SSL = "verify_ssl"
 CONF_ON_RESPONSE = "on_response"
 CONF_FOLLOW_REDIRECTS = "follow_redirects"
 CONF_REDIRECT_LIMIT = "redirect_limit"
+CONF_MAX_CONNECTIONS = "max_connections"
+
+
+def _supports_async():
+    # Plain HTTP requests are sent without blocking through the socket component, which
+    # can't open connections with the raw lwIP TCP implementation of the ESP8266
+    return CORE.is_esp32 or CORE.is_host
 
 
 def validate_url(value):
@@ -54,8 +69,23 @@ def validate_url(value):
     return urlparse.urlunparse(parsed)
 
 
+def _validate_framework(config):
+    if CORE.is_host:
+        return config
+    return cv.require_framework_version(
+        esp8266_arduino=cv.Version(2, 5, 1),
+        esp32_arduino=cv.Version(0, 0, 0),
+    )(config)
+
+
 def validate_secure_url(config):
     url_ = config[CONF_URL]
+    if (
+        CORE.is_host
+        and not isinstance(url_, Lambda)
+        and url_.lower().startswith("https:")
+    ):
+        raise cv.Invalid("HTTPS requests are not supported on the host platform.")
     if (
         config.get(CONF_VERIFY_SSL)
         and not isinstance(url_, Lambda)
@@ -81,12 +111,12 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(CONF_ESP8266_DISABLE_SSL_SUPPORT, esp8266=False): cv.All(
                 cv.only_on_esp8266, cv.boolean
             ),
+            cv.SplitDefault(CONF_MAX_CONNECTIONS, esp32=2, host=2): cv.All(
+                cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]), cv.int_range(min=1, max=8)
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
-    cv.require_framework_version(
-        esp8266_arduino=cv.Version(2, 5, 1),
-        esp32_arduino=cv.Version(0, 0, 0),
-    ),
+    _validate_framework,
 )
 
 
@@ -97,6 +127,10 @@ async def to_code(config):
     cg.add(var.set_follow_redirects(config[CONF_FOLLOW_REDIRECTS]))
     cg.add(var.set_redirect_limit(config[CONF_REDIRECT_LIMIT]))
 
+    if _supports_async():
+        cg.add_define("USE_HTTP_REQUEST_ASYNC")
+        cg.add(var.set_max_connections(config[CONF_MAX_CONNECTIONS]))
+
     if CORE.is_esp8266 and not config[CONF_ESP8266_DISABLE_SSL_SUPPORT]:
         cg.add_define("USE_HTTP_REQUEST_ESP8266_HTTPS")
 
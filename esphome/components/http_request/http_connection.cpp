@@ -0,0 +1,511 @@
+#include "http_connection.h"
+
+#ifdef USE_HTTP_REQUEST_ASYNC
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef USE_HOST
+#include <netdb.h>
+#endif
+
+namespace esphome {
+namespace http_request {
+
+static const char *const TAG = "http_request";
+
+// Header lines are only searched for a few short headers, the rest of longer lines is dropped
+static const size_t MAX_LINE_LENGTH = 512;
+static const size_t READ_BUFFER_SIZE = 1024;
+// Limits the time spent reading a fast response in one loop
+static const uint8_t MAX_READS_PER_LOOP = 4;
+static const uint16_t MAX_CAPTURED_BODY_SIZE = 16384;
+// Open connections unused for longer are closed, servers usually close them after 5-75s
+static const uint32_t KEEP_ALIVE_TIMEOUT = 30000;
+
+const char *http_error_to_string(int error) {
+  switch (error) {
+    case HTTP_ERROR_CONNECTION_REFUSED:
+      return "connection refused";
+    case HTTP_ERROR_SEND_FAILED:
+      return "send failed";
+    case HTTP_ERROR_NOT_CONNECTED:
+      return "not connected";
+    case HTTP_ERROR_CONNECTION_LOST:
+      return "connection lost";
+    case HTTP_ERROR_NO_HTTP_SERVER:
+      return "invalid response";
+    case HTTP_ERROR_QUEUE_FULL:
+      return "too many requests queued";
+    case HTTP_ERROR_READ_TIMEOUT:
+      return "read timeout";
+    default:
+      return "unknown error";
+  }
+}
+
+bool AsyncRequest::set_url(const std::string &url) {
+  if (url.size() < 8 || str_lower_case(url.substr(0, 7)) != "http://")
+    return false;
+  size_t host_start = 7;
+  size_t path_start = url.find_first_of("/?#", host_start);
+  if (path_start == std::string::npos)
+    path_start = url.size();
+  std::string authority = url.substr(host_start, path_start - host_start);
+  size_t colon = authority.rfind(':');
+  this->port = 80;
+  if (colon != std::string::npos) {
+    char *end;
+    unsigned long port = strtoul(authority.c_str() + colon + 1, &end, 10);  // NOLINT(google-runtime-int)
+    if (*end != '\0' || port == 0 || port > 65535)
+      return false;
+    this->port = port;
+    authority.resize(colon);
+  }
+  if (authority.empty())
+    return false;
+  this->host = authority;
+  this->path = url.substr(path_start, url.find('#', path_start) - path_start);
+  if (this->path.empty() || this->path[0] != '/')
+    this->path.insert(0, "/");
+  this->url = url;
+  return true;
+}
+
+void HttpConnection::send(std::unique_ptr<AsyncRequest> request) {
+  this->request_ = std::move(request);
+  const AsyncRequest &req = *this->request_;
+
+  std::string &tx = this->tx_buffer_;
+  tx = req.method + " " + req.path + " HTTP/1.1\r\nHost: " + req.host;
+  if (req.port != 80)
+    tx += ":" + to_string(req.port);
+  tx += "\r\nConnection: keep-alive\r\n";
+  if (this->useragent_ != nullptr)
+    tx += std::string("User-Agent: ") + this->useragent_ + "\r\n";
+  if (!req.body.empty() || (req.method != "GET" && req.method != "HEAD"))
+    tx += "Content-Length: " + to_string(req.body.size()) + "\r\n";
+  for (const auto &header : req.headers)
+    tx += header.first + ": " + header.second + "\r\n";
+  tx += "\r\n";
+  tx += req.body;
+
+  this->status_code_ = 0;
+  this->location_.clear();
+  this->received_ = false;
+  if (this->is_open_to(req.host, req.port)) {
+    ESP_LOGV(TAG, "Reusing the connection to %s:%u", this->host_.c_str(), this->port_);
+    this->reused_ = true;
+    this->start_sending_();
+    return;
+  }
+  this->close();
+  this->reused_ = false;
+  this->host_ = req.host;
+  this->port_ = req.port;
+  this->resolve_();
+}
+
+void HttpConnection::loop() {
+  switch (this->state_) {
+    case State::DISCONNECTED:
+    case State::FINISHED:
+      return;
+    case State::IDLE: {
+      // The server closes idle connections, or may send an error before doing so
+      uint8_t byte;
+      ssize_t len = this->socket_->read(&byte, 1);
+      if (len >= 0 || (errno != EWOULDBLOCK && errno != EAGAIN)) {
+        ESP_LOGV(TAG, "Connection to %s:%u closed by the server", this->host_.c_str(), this->port_);
+        this->close();
+      } else if (millis() - this->last_activity_ > KEEP_ALIVE_TIMEOUT) {
+        this->close();
+      }
+      return;
+    }
+    case State::RESOLVING:
+      if (this->dns_resolve_error_) {
+        ESP_LOGW(TAG, "Couldn't resolve IP address for '%s'", this->host_.c_str());
+        this->fail_(HTTP_ERROR_CONNECTION_REFUSED);
+        return;
+      }
+      if (this->dns_resolved_) {
+        this->connect_();
+        return;
+      }
+      break;
+    case State::CONNECTING:
+      this->check_connected_();
+      break;
+    case State::SENDING:
+      this->write_();
+      break;
+    default:
+      this->read_();
+      break;
+  }
+
+  if (this->state_ > State::DISCONNECTED && this->state_ < State::FINISHED &&
+      millis() - this->last_activity_ > this->timeout_) {
+    this->fail_(this->state_ <= State::CONNECTING ? HTTP_ERROR_CONNECTION_REFUSED : HTTP_ERROR_READ_TIMEOUT);
+  }
+}
+
+void HttpConnection::close() {
+  if (this->socket_ != nullptr) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+  if (this->state_ == State::IDLE)
+    this->set_state_(State::DISCONNECTED);
+}
+
+bool HttpConnection::is_redirect() const {
+  if (this->request_ == nullptr || this->request_->redirects_left == 0 || this->location_.empty())
+    return false;
+  // Redirects to other schemes are left to the caller, locations without a scheme are relative
+  size_t scheme_end = this->location_.find("://");
+  if (scheme_end != std::string::npos && scheme_end < this->location_.find_first_of("/?#") &&
+      str_lower_case(this->location_.substr(0, scheme_end)) != "http")
+    return false;
+  switch (this->status_code_) {
+    case 301:
+    case 302:
+    case 303:
+    case 307:
+    case 308:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::unique_ptr<AsyncRequest> HttpConnection::take_request() {
+  this->set_state_(this->socket_ != nullptr ? State::IDLE : State::DISCONNECTED);
+  this->tx_buffer_.clear();
+  this->tx_buffer_.shrink_to_fit();
+  return std::move(this->request_);
+}
+
+void HttpConnection::resolve_() {
+  this->set_state_(State::RESOLVING);
+  this->dns_resolved_ = false;
+  this->dns_resolve_error_ = false;
+#ifdef USE_HOST
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *result;
+  if (getaddrinfo(this->host_.c_str(), nullptr, &hints, &result) != 0) {
+    this->dns_resolve_error_ = true;
+    return;
+  }
+  this->ip_ = reinterpret_cast<struct sockaddr_in *>(result->ai_addr)->sin_addr.s_addr;
+  freeaddrinfo(result);
+  this->dns_resolved_ = true;
+#else
+  ip_addr_t addr;
+  err_t err = dns_gethostbyname_addrtype(this->host_.c_str(), &addr, HttpConnection::dns_found_callback, this,
+                                         LWIP_DNS_ADDRTYPE_IPV4);
+  if (err == ERR_OK) {
+    this->ip_ = ip4_addr_get_u32(ip_2_ip4(&addr));
+    this->dns_resolved_ = true;
+  } else if (err != ERR_INPROGRESS) {
+    this->dns_resolve_error_ = true;
+  }
+#endif
+}
+
+#ifndef USE_HOST
+void HttpConnection::dns_found_callback(const char *name, const ip_addr_t *ipaddr, void *callback_arg) {
+  auto *a_this = (HttpConnection *) callback_arg;
+  // A lookup of an earlier request that timed out may still complete
+  if (a_this->state_ != State::RESOLVING || a_this->host_ != name)
+    return;
+  if (ipaddr == nullptr) {
+    a_this->dns_resolve_error_ = true;
+  } else {
+    a_this->ip_ = ip4_addr_get_u32(ip_2_ip4(ipaddr));
+    a_this->dns_resolved_ = true;
+  }
+}
+#endif
+
+void HttpConnection::connect_() {
+  this->set_state_(State::CONNECTING);
+  this->socket_ = socket::socket(AF_INET, SOCK_STREAM, 0);
+  if (this->socket_ == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    this->fail_(HTTP_ERROR_CONNECTION_REFUSED);
+    return;
+  }
+  int enable = 1;
+  this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+  this->socket_->setblocking(false);
+
+  struct sockaddr_in server;
+  memset(&server, 0, sizeof(server));
+  server.sin_family = AF_INET;
+  server.sin_addr.s_addr = this->ip_;
+  server.sin_port = htons(this->port_);
+  if (this->socket_->connect(reinterpret_cast<struct sockaddr *>(&server), sizeof(server)) != 0 &&
+      errno != EINPROGRESS) {
+    ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.c_str(), this->port_, errno);
+    this->fail_(HTTP_ERROR_CONNECTION_REFUSED);
+  }
+}
+
+void HttpConnection::check_connected_() {
+  int err = 0;
+  socklen_t len = sizeof(err);
+  if (this->socket_->getsockopt(SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+    ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.c_str(), this->port_, err);
+    this->fail_(HTTP_ERROR_CONNECTION_REFUSED);
+    return;
+  }
+  struct sockaddr_storage peer;
+  len = sizeof(peer);
+  if (this->socket_->getpeername(reinterpret_cast<struct sockaddr *>(&peer), &len) == 0) {
+    ESP_LOGV(TAG, "Connected to %s:%u", this->host_.c_str(), this->port_);
+    this->start_sending_();
+  }
+}
+
+void HttpConnection::start_sending_() {
+  this->tx_sent_ = 0;
+  this->set_state_(State::SENDING);
+  this->write_();
+}
+
+void HttpConnection::write_() {
+  ssize_t written = this->socket_->write(this->tx_buffer_.data() + this->tx_sent_,
+                                         this->tx_buffer_.size() - this->tx_sent_);
+  if (written < 0) {
+    if (errno != EWOULDBLOCK && errno != EAGAIN)
+      this->fail_(HTTP_ERROR_SEND_FAILED);
+    return;
+  }
+  this->tx_sent_ += written;
+  this->last_activity_ = millis();
+  if (this->tx_sent_ == this->tx_buffer_.size()) {
+    this->line_.clear();
+    this->set_state_(State::STATUS_LINE);
+  }
+}
+
+void HttpConnection::read_() {
+  uint8_t buf[READ_BUFFER_SIZE];
+  for (uint8_t i = 0; i < MAX_READS_PER_LOOP && this->is_receiving_(); i++) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len < 0) {
+      if (errno != EWOULDBLOCK && errno != EAGAIN)
+        this->fail_(HTTP_ERROR_CONNECTION_LOST);
+      return;
+    }
+    if (len == 0) {
+      if (this->state_ == State::BODY && this->body_mode_ == BodyMode::UNTIL_CLOSE) {
+        this->finish_();
+      } else {
+        this->fail_(HTTP_ERROR_CONNECTION_LOST);
+      }
+      return;
+    }
+    this->received_ = true;
+    this->last_activity_ = millis();
+    this->parse_(buf, len);
+  }
+}
+
+void HttpConnection::parse_(const uint8_t *data, size_t len) {
+  size_t pos = 0;
+  while (pos < len && this->is_receiving_()) {
+    if (this->state_ == State::BODY || this->state_ == State::CHUNK_DATA) {
+      size_t count = len - pos;
+      if (this->body_mode_ != BodyMode::UNTIL_CLOSE)
+        count = std::min(count, this->remaining_);
+      this->deliver_(data + pos, count);
+      pos += count;
+      if (this->body_mode_ == BodyMode::UNTIL_CLOSE)
+        continue;
+      this->remaining_ -= count;
+      if (this->remaining_ == 0) {
+        if (this->state_ == State::BODY) {
+          this->finish_();
+        } else {
+          this->set_state_(State::CHUNK_END);
+        }
+      }
+      continue;
+    }
+
+    // Line based parts of the response
+    char c = data[pos++];
+    if (c == '\n') {
+      this->handle_line_();
+      this->line_.clear();
+    } else if (c != '\r' && this->line_.size() < MAX_LINE_LENGTH) {
+      this->line_ += c;
+    }
+  }
+}
+
+void HttpConnection::handle_line_() {
+  const std::string &line = this->line_;
+  switch (this->state_) {
+    case State::STATUS_LINE:
+      // HTTP/1.1 200 OK
+      if (line.compare(0, 5, "HTTP/") != 0 || line.size() < 12) {
+        this->fail_(HTTP_ERROR_NO_HTTP_SERVER);
+        return;
+      }
+      this->status_code_ = atoi(line.c_str() + 9);
+      this->keep_alive_ = line.compare(5, 3, "1.0") != 0;
+      this->chunked_ = false;
+      this->has_length_ = false;
+      this->remaining_ = 0;
+      this->location_.clear();
+      this->set_state_(State::HEADERS);
+      break;
+    case State::HEADERS: {
+      if (line.empty()) {
+        this->start_body_();
+        break;
+      }
+      size_t colon = line.find(':');
+      if (colon == std::string::npos)
+        break;
+      std::string name = str_lower_case(line.substr(0, colon));
+      size_t value_start = line.find_first_not_of(' ', colon + 1);
+      std::string value = value_start == std::string::npos ? "" : line.substr(value_start);
+      if (name == "content-length") {
+        this->remaining_ = strtoul(value.c_str(), nullptr, 10);
+        this->has_length_ = true;
+      } else if (name == "transfer-encoding") {
+        this->chunked_ = str_lower_case(value).find("chunked") != std::string::npos;
+      } else if (name == "connection") {
+        value = str_lower_case(value);
+        if (value.find("close") != std::string::npos) {
+          this->keep_alive_ = false;
+        } else if (value.find("keep-alive") != std::string::npos) {
+          this->keep_alive_ = true;
+        }
+      } else if (name == "location") {
+        this->location_ = value;
+      }
+      break;
+    }
+    case State::CHUNK_SIZE: {
+      // Chunk size in hex, optionally followed by extensions
+      char *end;
+      this->remaining_ = strtoul(line.c_str(), &end, 16);
+      if (end == line.c_str()) {
+        this->fail_(HTTP_ERROR_NO_HTTP_SERVER);
+      } else if (this->remaining_ == 0) {
+        this->set_state_(State::TRAILER);
+      } else {
+        this->set_state_(State::CHUNK_DATA);
+      }
+      break;
+    }
+    case State::CHUNK_END:
+      if (!line.empty()) {
+        this->fail_(HTTP_ERROR_NO_HTTP_SERVER);
+      } else {
+        this->set_state_(State::CHUNK_SIZE);
+      }
+      break;
+    case State::TRAILER:
+      if (line.empty())
+        this->finish_();
+      break;
+    default:
+      break;
+  }
+}
+
+void HttpConnection::start_body_() {
+  if (this->status_code_ >= 100 && this->status_code_ < 200) {
+    // Interim response, the final one follows
+    this->set_state_(State::STATUS_LINE);
+    return;
+  }
+  if (this->request_->method == "HEAD" || this->status_code_ == 204 || this->status_code_ == 304) {
+    this->body_mode_ = BodyMode::NONE;
+    this->finish_();
+  } else if (this->chunked_) {
+    this->body_mode_ = BodyMode::CHUNKED;
+    this->set_state_(State::CHUNK_SIZE);
+  } else if (this->has_length_) {
+    this->body_mode_ = BodyMode::LENGTH;
+    if (this->remaining_ == 0) {
+      this->finish_();
+    } else {
+      this->set_state_(State::BODY);
+    }
+  } else {
+    // The end of the body is marked by closing the connection
+    this->body_mode_ = BodyMode::UNTIL_CLOSE;
+    this->keep_alive_ = false;
+    this->set_state_(State::BODY);
+  }
+}
+
+void HttpConnection::deliver_(const uint8_t *data, size_t len) {
+  // The body of a redirect that will be followed isn't the response
+  if (len == 0 || this->is_redirect())
+    return;
+  AsyncRequest &req = *this->request_;
+  if (req.on_data)
+    req.on_data(data, len);
+  if (req.capture_body) {
+    size_t space = MAX_CAPTURED_BODY_SIZE - req.response_body.size();
+    if (len > space) {
+      if (space > 0)
+        ESP_LOGW(TAG, "Response of %s is larger than %u bytes, truncating it", req.url.c_str(), MAX_CAPTURED_BODY_SIZE);
+      len = space;
+    }
+    req.response_body.append(reinterpret_cast<const char *>(data), len);
+  }
+}
+
+void HttpConnection::finish_() {
+  if (!this->keep_alive_) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+  this->set_state_(State::FINISHED);
+}
+
+void HttpConnection::fail_(int error) {
+  // A connection left open may have been closed by the server just when it was reused
+  bool retry = this->reused_ && !this->received_ && error != HTTP_ERROR_READ_TIMEOUT;
+  if (this->socket_ != nullptr) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+  if (retry) {
+    ESP_LOGV(TAG, "Connection to %s:%u was closed, reconnecting", this->host_.c_str(), this->port_);
+    this->reused_ = false;
+    this->connect_();
+    return;
+  }
+  this->status_code_ = error;
+  this->set_state_(State::FINISHED);
+}
+
+void HttpConnection::set_state_(State state) {
+  this->state_ = state;
+  this->last_activity_ = millis();
+}
+
+}  // namespace http_request
+}  // namespace esphome
+
+#endif  // USE_HTTP_REQUEST_ASYNC
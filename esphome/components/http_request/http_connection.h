@@ -0,0 +1,165 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_HTTP_REQUEST_ASYNC
+
+#include "esphome/components/socket/socket.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef USE_HOST
+#include "lwip/dns.h"
+#endif
+
+namespace esphome {
+namespace http_request {
+
+// Errors reported instead of a status code, with the values of the Arduino HTTPClient where the meaning is the same
+static const int HTTP_ERROR_CONNECTION_REFUSED = -1;
+static const int HTTP_ERROR_SEND_FAILED = -2;
+static const int HTTP_ERROR_NOT_CONNECTED = -4;
+static const int HTTP_ERROR_CONNECTION_LOST = -5;
+static const int HTTP_ERROR_NO_HTTP_SERVER = -7;
+static const int HTTP_ERROR_QUEUE_FULL = -8;
+static const int HTTP_ERROR_READ_TIMEOUT = -11;
+
+const char *http_error_to_string(int error);
+
+/// A request sent by the asynchronous engine.
+struct AsyncRequest {
+  /// Split an http:// URL into host, port and path, returns false for other URLs.
+  bool set_url(const std::string &url);
+
+  std::string url;
+  std::string host;
+  uint16_t port{80};
+  std::string path;
+  std::string method;
+  std::string body;
+  std::vector<std::pair<std::string, std::string>> headers;
+
+  /// Called with each piece of the response body as it's received.
+  std::function<void(const uint8_t *data, size_t len)> on_data;
+  /// Called once the request is complete, with the status code or one of the HTTP_ERROR_* codes.
+  std::function<void(int status_code, uint32_t duration_ms)> on_complete;
+  /// Also collect the response body, for get_string() in the completion callback.
+  bool capture_body{false};
+  std::string response_body;
+
+  uint32_t start_time{0};
+  /// Number of redirects that may still be followed.
+  uint8_t redirects_left{0};
+};
+
+/** A connection to an HTTP server that is kept open between requests.
+ *
+ * Sends one request at a time, without blocking: the state machine is advanced by loop() with non-blocking socket
+ * operations, and the response body is passed on while it's received. Content-Length and chunked responses leave the
+ * connection open for the next request to the same server.
+ */
+class HttpConnection {
+ public:
+  HttpConnection(uint32_t timeout, const char *useragent) : timeout_(timeout), useragent_(useragent) {}
+
+  /// Start sending a request, reusing the open connection if it's to the same server.
+  void send(std::unique_ptr<AsyncRequest> request);
+  void loop();
+  void close();
+
+  /// Whether a request is being sent or waits to be taken with take_request().
+  bool is_busy() const { return this->request_ != nullptr; }
+  /// Whether the request is complete, successful or not.
+  bool is_finished() const { return this->state_ == State::FINISHED; }
+  /// Whether the connection is open and idle, to the given server.
+  bool is_open_to(const std::string &host, uint16_t port) const {
+    return this->state_ == State::IDLE && this->port_ == port && this->host_ == host;
+  }
+  bool is_open() const { return this->socket_ != nullptr; }
+  uint32_t get_last_used() const { return this->last_activity_; }
+
+  /// The status code of the finished request, or one of the HTTP_ERROR_* codes.
+  int get_status_code() const { return this->status_code_; }
+  /// Whether the finished request was redirected to a location that will be followed.
+  bool is_redirect() const;
+  const std::string &get_location() const { return this->location_; }
+  /// Hand back the finished request, the connection is then idle or closed.
+  std::unique_ptr<AsyncRequest> take_request();
+
+ protected:
+  enum class State : uint8_t {
+    DISCONNECTED,
+    RESOLVING,
+    CONNECTING,
+    SENDING,
+    STATUS_LINE,
+    HEADERS,
+    BODY,
+    CHUNK_SIZE,
+    CHUNK_DATA,
+    CHUNK_END,
+    TRAILER,
+    FINISHED,
+    IDLE,
+  };
+  enum class BodyMode : uint8_t { NONE, LENGTH, CHUNKED, UNTIL_CLOSE };
+
+  void resolve_();
+  void connect_();
+  void check_connected_();
+  void start_sending_();
+  void write_();
+  void read_();
+  void parse_(const uint8_t *data, size_t len);
+  void handle_line_();
+  void start_body_();
+  void deliver_(const uint8_t *data, size_t len);
+  void finish_();
+  void fail_(int error);
+  void set_state_(State state);
+  /// Whether the response is being received.
+  bool is_receiving_() const { return this->state_ >= State::STATUS_LINE && this->state_ <= State::TRAILER; }
+#ifndef USE_HOST
+  static void dns_found_callback(const char *name, const ip_addr_t *ipaddr, void *callback_arg);
+#endif
+
+  uint32_t timeout_;
+  const char *useragent_;
+
+  std::unique_ptr<socket::Socket> socket_;
+  std::string host_;
+  uint16_t port_{0};
+  /// Resolved IPv4 address of the server, in network byte order
+  uint32_t ip_{0};
+  bool dns_resolved_{false};
+  bool dns_resolve_error_{false};
+
+  State state_{State::DISCONNECTED};
+  uint32_t last_activity_{0};
+  std::unique_ptr<AsyncRequest> request_;
+  /// The request was started on a connection left open by the previous one
+  bool reused_{false};
+  /// Anything of the response was received
+  bool received_{false};
+
+  std::string tx_buffer_;
+  size_t tx_sent_{0};
+
+  std::string line_;
+  int status_code_{0};
+  std::string location_;
+  BodyMode body_mode_{BodyMode::NONE};
+  size_t remaining_{0};
+  bool chunked_{false};
+  bool has_length_{false};
+  bool keep_alive_{true};
+};
+
+}  // namespace http_request
+}  // namespace esphome
+
+#endif  // USE_HTTP_REQUEST_ASYNC
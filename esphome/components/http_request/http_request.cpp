@@ -1,10 +1,13 @@
-#ifdef USE_ARDUINO
-
 #include "http_request.h"
-#include "esphome/core/defines.h"
+
+#if defined(USE_ARDUINO) || defined(USE_HOST)
+
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/components/network/util.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace http_request {
 
@@ -16,20 +19,149 @@ void HttpRequestComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "  User-Agent: %s", this->useragent_);
   ESP_LOGCONFIG(TAG, "  Follow Redirects: %d", this->follow_redirects_);
   ESP_LOGCONFIG(TAG, "  Redirect limit: %d", this->redirect_limit_);
+#ifdef USE_HTTP_REQUEST_ASYNC
+  ESP_LOGCONFIG(TAG, "  Max connections: %u", this->max_connections_);
+#endif
+}
+
+#ifdef USE_HTTP_REQUEST_ASYNC
+// Requests waiting for a connection, more are rejected
+static const size_t MAX_QUEUED_REQUESTS = 16;
+
+void HttpRequestComponent::send_async(std::unique_ptr<AsyncRequest> request) {
+  request->start_time = millis();
+  if (this->follow_redirects_)
+    request->redirects_left = std::min<uint16_t>(this->redirect_limit_, 255);
+  if (this->queue_.size() >= MAX_QUEUED_REQUESTS) {
+    this->finish_request_(*request, HTTP_ERROR_QUEUE_FULL);
+    return;
+  }
+  this->queue_.push_back(std::move(request));
+}
+
+void HttpRequestComponent::loop() {
+  for (auto &connection : this->connections_) {
+    connection->loop();
+    if (connection->is_finished())
+      this->complete_(connection.get());
+  }
+
+  while (!this->queue_.empty()) {
+    if (!network::is_connected()) {
+      std::unique_ptr<AsyncRequest> request = std::move(this->queue_.front());
+      this->queue_.pop_front();
+      this->finish_request_(*request, HTTP_ERROR_NOT_CONNECTED);
+      continue;
+    }
+    HttpConnection *connection = this->find_connection_(*this->queue_.front());
+    if (connection == nullptr)
+      break;
+    connection->send(std::move(this->queue_.front()));
+    this->queue_.pop_front();
+  }
+}
+
+void HttpRequestComponent::on_shutdown() {
+  for (auto &connection : this->connections_)
+    connection->close();
+}
+
+HttpConnection *HttpRequestComponent::find_connection_(const AsyncRequest &request) {
+  HttpConnection *unused = nullptr;
+  for (auto &connection : this->connections_) {
+    if (connection->is_busy())
+      continue;
+    if (connection->is_open_to(request.host, request.port))
+      return connection.get();
+    // Prefer closed connections, then the one that was unused for the longest time
+    if (unused == nullptr || (unused->is_open() && !connection->is_open()) ||
+        (unused->is_open() == connection->is_open() &&
+         (int32_t) (connection->get_last_used() - unused->get_last_used()) < 0))
+      unused = connection.get();
+  }
+  if (unused != nullptr && !unused->is_open())
+    return unused;
+  if (this->connections_.size() < this->max_connections_) {
+    this->connections_.push_back(make_unique<HttpConnection>(this->timeout_, this->useragent_));
+    return this->connections_.back().get();
+  }
+  // Close a connection kept open for another server
+  return unused;
+}
+
+void HttpRequestComponent::complete_(HttpConnection *connection) {
+  int status_code = connection->get_status_code();
+  bool redirect = connection->is_redirect();
+  std::string location = connection->get_location();
+  std::unique_ptr<AsyncRequest> request = connection->take_request();
+
+  if (redirect && !location.empty()) {
+    std::string origin = "http://" + request->host;
+    if (request->port != 80)
+      origin += ":" + to_string(request->port);
+    if (location.compare(0, 2, "//") == 0) {
+      location.insert(0, "http:");
+    } else if (location[0] == '/') {
+      location.insert(0, origin);
+    } else if (str_lower_case(location.substr(0, 7)) != "http://") {
+      // Relative to the path of the request, without its query or its last segment
+      std::string base = request->path.substr(0, request->path.find('?'));
+      if (location[0] != '?')
+        base.resize(base.rfind('/') + 1);
+      location.insert(0, origin + base);
+    }
+    if (request->set_url(location)) {
+      ESP_LOGD(TAG, "HTTP Request redirected to %s", location.c_str());
+      request->redirects_left--;
+      if (status_code == 303) {
+        request->method = "GET";
+        request->body.clear();
+      }
+      this->queue_.push_front(std::move(request));
+      return;
+    }
+  }
+  this->finish_request_(*request, status_code);
 }
 
+void HttpRequestComponent::finish_request_(AsyncRequest &request, int status_code) {
+  uint32_t duration = millis() - request.start_time;
+  if (status_code < 0) {
+    ESP_LOGW(TAG, "HTTP Request failed; URL: %s; Error: %s; Duration: %u ms", request.url.c_str(),
+             http_error_to_string(status_code), duration);
+    this->status_set_warning();
+  } else if (status_code < 200 || status_code >= 300) {
+    ESP_LOGW(TAG, "HTTP Request failed; URL: %s; Code: %d; Duration: %u ms", request.url.c_str(), status_code,
+             duration);
+    this->status_set_warning();
+  } else {
+    this->status_clear_warning();
+    ESP_LOGD(TAG, "HTTP Request completed; URL: %s; Code: %d; Duration: %u ms", request.url.c_str(), status_code,
+             duration);
+  }
+
+  if (request.on_complete) {
+    this->response_body_ = &request.response_body;
+    request.on_complete(status_code, duration);
+    this->response_body_ = nullptr;
+  }
+}
+#endif  // USE_HTTP_REQUEST_ASYNC
+
 void HttpRequestComponent::set_url(std::string url) {
   this->url_ = std::move(url);
   this->secure_ = this->url_.compare(0, 6, "https:") == 0;
-
+#ifdef USE_ARDUINO
   if (!this->last_url_.empty() && this->url_ != this->last_url_) {
     // Close connection if url has been changed
     this->client_.setReuse(false);
     this->client_.end();
   }
   this->client_.setReuse(true);
+#endif
 }
 
+#ifdef USE_ARDUINO
 void HttpRequestComponent::send(const std::vector<HttpRequestResponseTrigger *> &response_triggers) {
   if (!network::is_connected()) {
     this->client_.end();
@@ -123,8 +255,23 @@ void HttpRequestComponent::close() {
   this->last_url_ = this->url_;
   this->client_.end();
 }
+#else
+void HttpRequestComponent::send(const std::vector<HttpRequestResponseTrigger *> &response_triggers) {
+  ESP_LOGW(TAG, "HTTP Request failed; URL: %s; Only http:// URLs are supported on this platform", this->url_.c_str());
+  this->status_set_warning();
+}
+
+void HttpRequestComponent::close() { this->last_url_ = this->url_; }
+#endif  // USE_ARDUINO
 
 const char *HttpRequestComponent::get_string() {
+#ifdef USE_HTTP_REQUEST_ASYNC
+  if (this->response_body_ != nullptr)
+    return this->response_body_->c_str();
+#endif
+#ifndef USE_ARDUINO
+  return "";
+#else
 #if defined(ESP32)
   // The static variable is here because HTTPClient::getString() returns a String on ESP32,
   // and we need something to keep a buffer alive.
@@ -136,9 +283,10 @@ const char *HttpRequestComponent::get_string() {
 #endif
   str = this->client_.getString();
   return str.c_str();
+#endif
 }
 
 }  // namespace http_request
 }  // namespace esphome
 
-#endif  // USE_ARDUINO
+#endif  // USE_ARDUINO || USE_HOST
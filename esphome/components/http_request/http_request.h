@@ -1,18 +1,25 @@
 #pragma once
 
-#ifdef USE_ARDUINO
+#include "esphome/core/defines.h"
+
+#if defined(USE_ARDUINO) || defined(USE_HOST)
 
 #include "esphome/components/json/json_util.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
-#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
 
+#include <deque>
 #include <list>
 #include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#ifdef USE_HTTP_REQUEST_ASYNC
+#include "http_connection.h"
+#endif
+
 #ifdef USE_ESP32
 #include <HTTPClient.h>
 #endif
@@ -40,6 +47,10 @@ class HttpRequestComponent : public Component {
  public:
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+#ifdef USE_HTTP_REQUEST_ASYNC
+  void loop() override;
+  void on_shutdown() override;
+#endif
 
   void set_url(std::string url);
   void set_method(const char *method) { this->method_ = method; }
@@ -49,12 +60,35 @@ class HttpRequestComponent : public Component {
   void set_redirect_limit(uint16_t limit) { this->redirect_limit_ = limit; }
   void set_body(const std::string &body) { this->body_ = body; }
   void set_headers(std::list<Header> headers) { this->headers_ = std::move(headers); }
+  /// Send the request set up with the setters, blocking until the response is received.
   void send(const std::vector<HttpRequestResponseTrigger *> &response_triggers);
   void close();
   const char *get_string();
 
+#ifdef USE_HTTP_REQUEST_ASYNC
+  void set_max_connections(uint8_t max_connections) { this->max_connections_ = max_connections; }
+  /// Whether requests to the URL can be sent with send_async(), which is the case for plain http:// URLs.
+  static bool is_async_url(const std::string &url) { return str_lower_case(url.substr(0, 7)) == "http://"; }
+  /// Queue a request, it's sent by loop() without blocking and its callbacks are called from there.
+  void send_async(std::unique_ptr<AsyncRequest> request);
+#endif
+
  protected:
+#ifdef USE_HTTP_REQUEST_ASYNC
+  /// Idle connection for the request, preferring one that is still open to its server.
+  HttpConnection *find_connection_(const AsyncRequest &request);
+  void complete_(HttpConnection *connection);
+  void finish_request_(AsyncRequest &request, int status_code);
+
+  std::vector<std::unique_ptr<HttpConnection>> connections_;
+  std::deque<std::unique_ptr<AsyncRequest>> queue_;
+  uint8_t max_connections_{2};
+  /// Body of the response whose callback is running, returned by get_string()
+  const std::string *response_body_{nullptr};
+#endif
+#ifdef USE_ARDUINO
   HTTPClient client_{};
+#endif
   std::string url_;
   std::string last_url_;
   const char *method_;
@@ -89,20 +123,72 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
 
   void register_response_trigger(HttpRequestResponseTrigger *trigger) { this->response_triggers_.push_back(trigger); }
 
-  void play(Ts... x) override {
-    this->parent_->set_url(this->url_.value(x...));
-    this->parent_->set_method(this->method_.value(x...));
-    if (this->body_.has_value()) {
-      this->parent_->set_body(this->body_.value(x...));
+  void play_complex(Ts... x) override {
+    this->num_running_++;
+    std::string url = this->url_.value(x...);
+#ifdef USE_HTTP_REQUEST_ASYNC
+    if (HttpRequestComponent::is_async_url(url)) {
+      // The following actions run once the response is received
+      this->send_async_(url, x...);
+      return;
+    }
+#endif
+    this->send_(url, x...);
+    this->play_next_(x...);
+  }
+
+  void play(Ts... x) override { /* ignore - see play_complex */
+  }
+
+#ifdef USE_HTTP_REQUEST_ASYNC
+  /// Responses of requests sent before the action was stopped don't run the following actions anymore.
+  void stop() override { this->generation_++; }
+#endif
+
+ protected:
+#ifdef USE_HTTP_REQUEST_ASYNC
+  void send_async_(const std::string &url, Ts... x) {
+    auto request = make_unique<AsyncRequest>();
+    request->set_url(url);
+    request->method = this->method_.value(x...);
+    request->body = this->build_body_(x...);
+    for (const auto &item : this->headers_) {
+      auto val = item.second;
+      request->headers.emplace_back(item.first, val.value(x...));
     }
+    // Also for the following actions, which may call get_string() without an on_response trigger
+    request->capture_body = true;
+    auto next = std::bind(&HttpRequestSendAction<Ts...>::play_next_, this, x...);
+    uint32_t generation = this->generation_;
+    request->on_complete = [this, next, generation](int status_code, uint32_t duration_ms) {
+      if (generation != this->generation_)
+        return;
+      for (auto *trigger : this->response_triggers_)
+        trigger->process(status_code, duration_ms);
+      next();
+    };
+    this->parent_->send_async(std::move(request));
+  }
+#endif
+
+  std::string build_body_(Ts... x) {
     if (!this->json_.empty()) {
       auto f = std::bind(&HttpRequestSendAction<Ts...>::encode_json_, this, x..., std::placeholders::_1);
-      this->parent_->set_body(json::build_json(f));
+      return json::build_json(f);
     }
     if (this->json_func_ != nullptr) {
       auto f = std::bind(&HttpRequestSendAction<Ts...>::encode_json_func_, this, x..., std::placeholders::_1);
-      this->parent_->set_body(json::build_json(f));
+      return json::build_json(f);
     }
+    if (this->body_.has_value())
+      return this->body_.value(x...);
+    return "";
+  }
+
+  void send_(const std::string &url, Ts... x) {
+    this->parent_->set_url(url);
+    this->parent_->set_method(this->method_.value(x...));
+    this->parent_->set_body(this->build_body_(x...));
     std::list<Header> headers;
     for (const auto &item : this->headers_) {
       auto val = item.second;
@@ -117,7 +203,6 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
     this->parent_->set_body("");
   }
 
- protected:
   void encode_json_(Ts... x, JsonObject root) {
     for (const auto &item : this->json_) {
       auto val = item.second;
@@ -130,9 +215,12 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
   std::map<const char *, TemplatableValue<std::string, Ts...>> json_{};
   std::function<void(Ts..., JsonObject)> json_func_{nullptr};
   std::vector<HttpRequestResponseTrigger *> response_triggers_;
+#ifdef USE_HTTP_REQUEST_ASYNC
+  uint32_t generation_{0};
+#endif
 };
 
 }  // namespace http_request
 }  // namespace esphome
 
-#endif  // USE_ARDUINO
+#endif  // USE_ARDUINO || USE_HOST
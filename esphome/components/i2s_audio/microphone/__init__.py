@@ -23,6 +23,8 @@ CONF_PDM = "pdm"
 CONF_SAMPLE_RATE = "sample_rate"
 CONF_BITS_PER_SAMPLE = "bits_per_sample"
 CONF_USE_APLL = "use_apll"
+CONF_GAIN_FACTOR = "gain_factor"
+CONF_CORRECT_DC_OFFSET = "correct_dc_offset"
 
 I2SAudioMicrophone = i2s_audio_ns.class_(
     "I2SAudioMicrophone", I2SAudioIn, microphone.Microphone, cg.Component
@@ -69,6 +71,8 @@ BASE_SCHEMA = microphone.MICROPHONE_SCHEMA.extend(
             _validate_bits, cv.enum(BITS_PER_SAMPLE)
         ),
         cv.Optional(CONF_USE_APLL, default=False): cv.boolean,
+        cv.Optional(CONF_GAIN_FACTOR, default=1): cv.int_range(min=1, max=64),
+        cv.Optional(CONF_CORRECT_DC_OFFSET, default=False): cv.boolean,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -112,5 +116,7 @@ async def to_code(config):
     cg.add(var.set_sample_rate(config[CONF_SAMPLE_RATE]))
     cg.add(var.set_bits_per_sample(config[CONF_BITS_PER_SAMPLE]))
     cg.add(var.set_use_apll(config[CONF_USE_APLL]))
+    cg.add(var.set_gain_factor(config[CONF_GAIN_FACTOR]))
+    cg.add(var.set_correct_dc_offset(config[CONF_CORRECT_DC_OFFSET]))
 
     await microphone.register_microphone(var, config)
@@ -81,6 +81,10 @@ void I2SAudioMicrophone::start_() {
 
     i2s_set_pin(this->parent_->get_port(), &pin_config);
   }
+  this->conversion_.bits_per_sample = this->bits_per_sample_;
+  // 32-bit microphones put their (usually 18 to 24) significant bits at the top of the slot
+  this->conversion_.shift = this->bits_per_sample_ == I2S_BITS_PER_SAMPLE_32BIT ? 14 : 0;
+  this->dc_offset_ = 0;
   this->state_ = microphone::STATE_RUNNING;
   this->high_freq_.start();
 }
@@ -116,30 +120,20 @@ size_t I2SAudioMicrophone::read(int16_t *buf, size_t len) {
     return 0;
   }
   this->status_clear_warning();
-  if (this->bits_per_sample_ == I2S_BITS_PER_SAMPLE_16BIT) {
-    return bytes_read;
-  } else if (this->bits_per_sample_ == I2S_BITS_PER_SAMPLE_32BIT) {
-    std::vector<int16_t> samples;
-    size_t samples_read = bytes_read / sizeof(int32_t);
-    samples.resize(samples_read);
-    for (size_t i = 0; i < samples_read; i++) {
-      int32_t temp = reinterpret_cast<int32_t *>(buf)[i] >> 14;
-      samples[i] = clamp<int16_t>(temp, INT16_MIN, INT16_MAX);
-    }
-    memcpy(buf, samples.data(), samples_read * sizeof(int16_t));
-    return samples_read * sizeof(int16_t);
-  } else {
+  if (this->bits_per_sample_ != I2S_BITS_PER_SAMPLE_16BIT && this->bits_per_sample_ != I2S_BITS_PER_SAMPLE_32BIT) {
     ESP_LOGE(TAG, "Unsupported bits per sample: %d", this->bits_per_sample_);
     return 0;
   }
+  // Converted in place, 32-bit samples take half the space afterwards
+  return convert_samples(this->conversion_, &this->dc_offset_, buf, bytes_read);
 }
 
 void I2SAudioMicrophone::read_() {
-  std::vector<int16_t> samples;
-  samples.resize(BUFFER_SIZE);
-  size_t bytes_read = this->read(samples.data(), BUFFER_SIZE / sizeof(int16_t));
-  samples.resize(bytes_read / sizeof(int16_t));
-  this->data_callbacks_.call(samples);
+  // The capacity is kept between calls, so this only allocates the first time
+  this->samples_.resize(BUFFER_SIZE);
+  size_t bytes_read = this->read(this->samples_.data(), BUFFER_SIZE / sizeof(int16_t));
+  this->samples_.resize(bytes_read / sizeof(int16_t));
+  this->data_callbacks_.call(this->samples_);
 }
 
 void I2SAudioMicrophone::loop() {
@@ -3,10 +3,13 @@
 #ifdef USE_ESP32
 
 #include "../i2s_audio.h"
+#include "sample_conversion.h"
 
 #include "esphome/components/microphone/microphone.h"
 #include "esphome/core/component.h"
 
+#include <vector>
+
 namespace esphome {
 namespace i2s_audio {
 
@@ -34,6 +37,8 @@ class I2SAudioMicrophone : public I2SAudioIn, public microphone::Microphone, pub
   void set_sample_rate(uint32_t sample_rate) { this->sample_rate_ = sample_rate; }
   void set_bits_per_sample(i2s_bits_per_sample_t bits_per_sample) { this->bits_per_sample_ = bits_per_sample; }
   void set_use_apll(uint32_t use_apll) { this->use_apll_ = use_apll; }
+  void set_gain_factor(int32_t gain_factor) { this->conversion_.gain_factor = gain_factor; }
+  void set_correct_dc_offset(bool correct_dc_offset) { this->conversion_.correct_dc_offset = correct_dc_offset; }
 
  protected:
   void start_();
@@ -51,6 +56,11 @@ class I2SAudioMicrophone : public I2SAudioIn, public microphone::Microphone, pub
   i2s_bits_per_sample_t bits_per_sample_;
   bool use_apll_;
 
+  SampleConversion conversion_;
+  int64_t dc_offset_{0};
+  /// Passed to the data callbacks
+  std::vector<int16_t> samples_;
+
   HighFrequencyLoopRequester high_freq_;
 };
 
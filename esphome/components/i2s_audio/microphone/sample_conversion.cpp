@@ -0,0 +1,87 @@
+#include "sample_conversion.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace i2s_audio {
+
+// The running average of the DC offset correction is dc_offset >> DC_OFFSET_SHIFT
+static const uint8_t DC_OFFSET_SHIFT = 10;
+
+// Separate loops per sample width, accumulator width and for the DC offset correction keep the per sample work
+// branch-free. Acc is int32_t when the samples can't overflow it, the common case and a lot cheaper than int64_t.
+template<typename T, typename Acc, bool CorrectDcOffset>
+static void convert(const SampleConversion &conversion, int64_t *dc_offset, const T *in, int16_t *out,
+                    size_t frames) {
+  const uint8_t shift = conversion.shift;
+  const Acc gain_factor = conversion.gain_factor;
+  const size_t stride = conversion.channels;
+  in += conversion.channel;
+  Acc dc = static_cast<Acc>(*dc_offset);
+  // out never gets ahead of in, so converting in place is safe
+  for (size_t i = 0; i < frames; i++) {
+    Acc sample = static_cast<Acc>(in[i * stride] >> shift);
+    if (CorrectDcOffset) {
+      Acc average = dc >> DC_OFFSET_SHIFT;
+      dc += sample - average;
+      sample -= average;
+    }
+    out[i] = static_cast<int16_t>(std::max<Acc>(std::min<Acc>(sample * gain_factor, INT16_MAX), INT16_MIN));
+  }
+  *dc_offset = dc;
+}
+
+template<typename T, typename Acc>
+static void convert(const SampleConversion &conversion, int64_t *dc_offset, const T *in, int16_t *out,
+                    size_t frames) {
+  if (conversion.correct_dc_offset) {
+    convert<T, Acc, true>(conversion, dc_offset, in, out, frames);
+  } else {
+    convert<T, Acc, false>(conversion, dc_offset, in, out, frames);
+  }
+}
+
+template<typename T>
+static void convert(const SampleConversion &conversion, int64_t *dc_offset, const T *in, int16_t *out,
+                    size_t frames) {
+  // Bits of the shifted samples including the sign, plus one for subtracting the DC offset
+  uint8_t bits = sizeof(T) * 8 - conversion.shift + 1;
+  uint8_t gain_bits = 0;
+  while (gain_bits < 32 && (int64_t(1) << gain_bits) < conversion.gain_factor)
+    gain_bits++;
+  if (bits + gain_bits <= 31 && (!conversion.correct_dc_offset || bits + DC_OFFSET_SHIFT <= 31)) {
+    convert<T, int32_t>(conversion, dc_offset, in, out, frames);
+  } else {
+    convert<T, int64_t>(conversion, dc_offset, in, out, frames);
+  }
+}
+
+size_t convert_samples(const SampleConversion &conversion, int64_t *dc_offset, void *buf, size_t len) {
+  const size_t sample_size = conversion.bits_per_sample / 8;
+  if (sample_size != sizeof(int16_t) && sample_size != sizeof(int32_t))
+    return 0;
+  const size_t channels = std::max<size_t>(conversion.channels, 1);
+  const size_t frames = len / (sample_size * channels);
+  if (sample_size == sizeof(int16_t) && channels == 1 && conversion.shift == 0 && conversion.gain_factor == 1 &&
+      !conversion.correct_dc_offset) {
+    // Already what's needed
+    return frames * sizeof(int16_t);
+  }
+
+  SampleConversion checked = conversion;
+  checked.channels = channels;
+  checked.channel = std::min<size_t>(conversion.channel, channels - 1);
+  // A shift by the sample width or more is undefined
+  checked.shift = std::min<uint8_t>(conversion.shift, 31);
+  int16_t *out = static_cast<int16_t *>(buf);
+  if (sample_size == sizeof(int32_t)) {
+    convert(checked, dc_offset, static_cast<const int32_t *>(buf), out, frames);
+  } else {
+    checked.shift = std::min<uint8_t>(checked.shift, 15);
+    convert(checked, dc_offset, static_cast<const int16_t *>(buf), out, frames);
+  }
+  return frames * sizeof(int16_t);
+}
+
+}  // namespace i2s_audio
+}  // namespace esphome
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace i2s_audio {
+
+/// How the frames read from I2S are turned into 16-bit mono samples.
+struct SampleConversion {
+  /// Width of the samples read from I2S, 16 or 32
+  uint8_t bits_per_sample{16};
+  /// Right shift applied to every sample, moves the significant bits of a 32-bit slot into the 16-bit range
+  uint8_t shift{0};
+  /// Factor the samples are multiplied with after the shift, the result is clamped to 16 bit
+  int32_t gain_factor{1};
+  /// Number of interleaved channels in the frames and the one to keep
+  uint8_t channels{1};
+  uint8_t channel{0};
+  /// Remove the DC offset with a running average over about 1024 samples
+  bool correct_dc_offset{false};
+};
+
+/** Convert the I2S frames in buf to 16-bit mono samples in place.
+ *
+ * Doesn't allocate and doesn't depend on the I2S driver. dc_offset holds the running average between calls when
+ * correct_dc_offset is set, it has to start at 0 for every new stream.
+ * @param len Number of bytes in buf, partial frames at the end are dropped
+ * @return Number of bytes of 16-bit samples at the start of buf
+ */
+size_t convert_samples(const SampleConversion &conversion, int64_t *dc_offset, void *buf, size_t len);
+
+}  // namespace i2s_audio
+}  // namespace esphome
@@ -0,0 +1,81 @@
+#include "audio_buffer_pool.h"
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace i2s_audio {
+
+bool AudioBufferPool::IndexQueue::push(uint8_t index) {
+  size_t tail = this->tail_.load(std::memory_order_relaxed);
+  size_t next = tail + 1 == this->slots_.size() ? 0 : tail + 1;
+  if (next == this->head_.load(std::memory_order_acquire))
+    return false;  // full
+  this->slots_[tail] = index;
+  this->tail_.store(next, std::memory_order_release);
+  return true;
+}
+
+bool AudioBufferPool::IndexQueue::pop(uint8_t *index) {
+  size_t head = this->head_.load(std::memory_order_relaxed);
+  if (head == this->tail_.load(std::memory_order_acquire))
+    return false;  // empty
+  *index = this->slots_[head];
+  this->head_.store(head + 1 == this->slots_.size() ? 0 : head + 1, std::memory_order_release);
+  return true;
+}
+
+size_t AudioBufferPool::IndexQueue::size() const {
+  size_t head = this->head_.load(std::memory_order_acquire);
+  size_t tail = this->tail_.load(std::memory_order_acquire);
+  return tail >= head ? tail - head : tail + this->slots_.size() - head;
+}
+
+bool AudioBufferPool::init(size_t count, size_t buffer_size) {
+  // Indices travel as uint8_t
+  if (count == 0 || count > 255)
+    return false;
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  uint8_t *storage = allocator.allocate(count * buffer_size);
+  if (storage == nullptr)
+    return false;
+  this->buffer_size_ = buffer_size;
+  this->buffers_.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    this->buffers_[i] = {storage + i * buffer_size, 0};
+  }
+  this->free_.init(count);
+  this->filled_.init(count);
+  this->reset();
+  return true;
+}
+
+AudioBufferPool::Buffer *AudioBufferPool::acquire() {
+  uint8_t index;
+  if (!this->free_.pop(&index))
+    return nullptr;
+  Buffer *buffer = &this->buffers_[index];
+  buffer->len = 0;
+  return buffer;
+}
+
+void AudioBufferPool::submit(Buffer *buffer) { this->filled_.push(buffer - this->buffers_.data()); }
+
+AudioBufferPool::Buffer *AudioBufferPool::receive() {
+  uint8_t index;
+  if (!this->filled_.pop(&index))
+    return nullptr;
+  return &this->buffers_[index];
+}
+
+void AudioBufferPool::release(Buffer *buffer) { this->free_.push(buffer - this->buffers_.data()); }
+
+void AudioBufferPool::reset() {
+  this->free_.clear();
+  this->filled_.clear();
+  for (size_t i = 0; i < this->buffers_.size(); i++) {
+    this->free_.push(i);
+  }
+}
+
+}  // namespace i2s_audio
+}  // namespace esphome
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace i2s_audio {
+
+/** Preallocated audio buffers handed from a producer to a consumer task without copying them.
+ *
+ * The producer acquires a free buffer, fills it and submits it. The consumer receives the submitted buffers in order
+ * and releases them back to the pool once they have been played. Only the buffer indices travel through the two
+ * single-producer single-consumer queues, which need no locks and don't depend on FreeRTOS.
+ */
+class AudioBufferPool {
+ public:
+  struct Buffer {
+    uint8_t *data;
+    size_t len;
+  };
+
+  /// Allocate count buffers of buffer_size bytes each, returns false if the memory isn't available.
+  bool init(size_t count, size_t buffer_size);
+
+  /// Producer side: get a free buffer, nullptr if all are in use.
+  Buffer *acquire();
+  /// Producer side: hand a filled buffer to the consumer.
+  void submit(Buffer *buffer);
+
+  /// Consumer side: get the oldest submitted buffer, nullptr if there is none.
+  Buffer *receive();
+  /// Consumer side: give a buffer back once it has been played.
+  void release(Buffer *buffer);
+
+  /// Number of buffers submitted or being played, i.e. not back in the pool yet.
+  size_t in_use() const { return this->buffers_.size() - this->free_.size(); }
+  size_t get_buffer_size() const { return this->buffer_size_; }
+
+  /// Put all buffers back into the pool. Neither side may use the pool at the same time.
+  void reset();
+
+ protected:
+  /// Single-producer single-consumer queue of buffer indices, one slot larger than the number of buffers.
+  class IndexQueue {
+   public:
+    void init(size_t count) { this->slots_.resize(count + 1); }
+    bool push(uint8_t index);
+    bool pop(uint8_t *index);
+    size_t size() const;
+    void clear() {
+      this->head_.store(0, std::memory_order_relaxed);
+      this->tail_.store(0, std::memory_order_release);
+    }
+
+   protected:
+    std::vector<uint8_t> slots_;
+    /// Read position, owned by the consumer of the queue
+    std::atomic<size_t> head_{0};
+    /// Write position, owned by the producer of the queue
+    std::atomic<size_t> tail_{0};
+  };
+
+  std::vector<Buffer> buffers_;
+  size_t buffer_size_{0};
+  /// Free buffers, pushed by the consumer and popped by the producer
+  IndexQueue free_;
+  /// Filled buffers, pushed by the producer and popped by the consumer
+  IndexQueue filled_;
+};
+
+}  // namespace i2s_audio
+}  // namespace esphome
@@ -18,7 +18,11 @@ static const char *const TAG = "i2s_audio.speaker";
 void I2SAudioSpeaker::setup() {
   ESP_LOGCONFIG(TAG, "Setting up I2S Audio Speaker...");
 
-  this->buffer_queue_ = xQueueCreate(BUFFER_COUNT, sizeof(DataEvent));
+  if (!this->buffer_pool_.init(BUFFER_COUNT, BUFFER_SIZE)) {
+    ESP_LOGE(TAG, "Could not allocate the audio buffers");
+    this->mark_failed();
+    return;
+  }
   this->event_queue_ = xQueueCreate(BUFFER_COUNT, sizeof(TaskEvent));
 }
 
@@ -28,6 +32,7 @@ void I2SAudioSpeaker::start_() {
     return;  // Waiting for another i2s component to return lock
   }
   this->state_ = speaker::STATE_RUNNING;
+  this->stop_requested_ = false;
 
   xTaskCreate(I2SAudioSpeaker::player_task, "speaker_task", 8192, (void *) this, 1, &this->player_task_handle_);
 }
@@ -85,40 +90,42 @@ void I2SAudioSpeaker::player_task(void *params) {
   }
 #endif
 
-  DataEvent data_event;
-
   event.type = TaskEventType::STARTED;
   xQueueSend(this_speaker->event_queue_, &event, portMAX_DELAY);
 
-  int16_t buffer[BUFFER_SIZE / 2];
+  // The mono samples are duplicated into both channels of 32-bit frames and written to I2S in one go
+  uint32_t frames[BUFFER_SIZE / sizeof(int16_t)];
 
-  while (true) {
-    if (xQueueReceive(this_speaker->buffer_queue_, &data_event, 100 / portTICK_PERIOD_MS) != pdTRUE) {
-      break;  // End of audio from main thread
-    }
-    if (data_event.stop) {
-      // Stop signal from main thread
-      xQueueReset(this_speaker->buffer_queue_);  // Flush queue
-      break;
+  while (!this_speaker->stop_requested_) {
+    AudioBufferPool::Buffer *buffer = this_speaker->buffer_pool_.receive();
+    if (buffer == nullptr) {
+      // Wait for play() or stop()
+      if (ulTaskNotifyTake(pdTRUE, 100 / portTICK_PERIOD_MS) == 0 && this_speaker->buffer_pool_.in_use() == 0) {
+        break;  // End of audio from main thread
+      }
+      continue;
     }
-    size_t bytes_written;
-
-    memmove(buffer, data_event.data, data_event.len);
-    size_t remaining = data_event.len / 2;
-    size_t current = 0;
-
-    while (remaining > 0) {
-      uint32_t sample = (buffer[current] << 16) | (buffer[current] & 0xFFFF);
 
-      esp_err_t err = i2s_write(this_speaker->parent_->get_port(), &sample, sizeof(sample), &bytes_written,
-                                (10 / portTICK_PERIOD_MS));
+    // The pool's buffers are aligned for 16-bit samples
+    const uint16_t *samples = reinterpret_cast<const uint16_t *>(buffer->data);
+    size_t sample_count = buffer->len / sizeof(int16_t);
+    for (size_t i = 0; i < sample_count; i++) {
+      frames[i] = (static_cast<uint32_t>(samples[i]) << 16) | samples[i];
+    }
+    // The samples have been copied out, the buffer can be filled again
+    this_speaker->buffer_pool_.release(buffer);
+
+    size_t bytes = sample_count * sizeof(uint32_t);
+    size_t offset = 0;
+    while (offset < bytes && !this_speaker->stop_requested_) {
+      size_t bytes_written = 0;
+      esp_err_t err = i2s_write(this_speaker->parent_->get_port(), reinterpret_cast<uint8_t *>(frames) + offset,
+                                bytes - offset, &bytes_written, (10 / portTICK_PERIOD_MS));
+      offset += bytes_written;
       if (err != ESP_OK) {
         event = {.type = TaskEventType::WARNING, .err = err};
         xQueueSend(this_speaker->event_queue_, &event, portMAX_DELAY);
-        continue;
       }
-      remaining--;
-      current++;
     }
 
     event.type = TaskEventType::PLAYING;
@@ -148,9 +155,9 @@ void I2SAudioSpeaker::stop() {
     return;
   }
   this->state_ = speaker::STATE_STOPPING;
-  DataEvent data;
-  data.stop = true;
-  xQueueSendToFront(this->buffer_queue_, &data, portMAX_DELAY);
+  this->stop_requested_ = true;
+  if (this->player_task_handle_ != nullptr)
+    xTaskNotifyGive(this->player_task_handle_);
 }
 
 void I2SAudioSpeaker::watch_() {
@@ -174,7 +181,8 @@ void I2SAudioSpeaker::watch_() {
         vTaskDelete(this->player_task_handle_);
         this->player_task_handle_ = nullptr;
         this->parent_->unlock();
-        xQueueReset(this->buffer_queue_);
+        // Drops what hasn't been played, the task is gone so nothing else uses the pool
+        this->buffer_pool_.reset();
         ESP_LOGD(TAG, "Stopped I2S Audio Speaker");
         break;
       case TaskEventType::WARNING:
@@ -206,21 +214,23 @@ size_t I2SAudioSpeaker::play(const uint8_t *data, size_t length) {
   size_t remaining = length;
   size_t index = 0;
   while (remaining > 0) {
-    DataEvent event;
-    event.stop = false;
-    size_t to_send_length = std::min(remaining, BUFFER_SIZE);
-    event.len = to_send_length;
-    memcpy(event.data, data + index, to_send_length);
-    if (xQueueSend(this->buffer_queue_, &event, 0) != pdTRUE) {
-      return index;
+    AudioBufferPool::Buffer *buffer = this->buffer_pool_.acquire();
+    if (buffer == nullptr) {
+      break;  // All buffers are queued, the caller retries with the rest
     }
+    size_t to_send_length = std::min(remaining, BUFFER_SIZE);
+    memcpy(buffer->data, data + index, to_send_length);
+    buffer->len = to_send_length;
+    this->buffer_pool_.submit(buffer);
     remaining -= to_send_length;
     index += to_send_length;
   }
+  if (index > 0 && this->player_task_handle_ != nullptr)
+    xTaskNotifyGive(this->player_task_handle_);
   return index;
 }
 
-bool I2SAudioSpeaker::has_buffered_data() const { return uxQueueMessagesWaiting(this->buffer_queue_) > 0; }
+bool I2SAudioSpeaker::has_buffered_data() const { return this->buffer_pool_.in_use() > 0; }
 
 }  // namespace i2s_audio
 }  // namespace esphome
@@ -3,11 +3,14 @@
 #ifdef USE_ESP32
 
 #include "../i2s_audio.h"
+#include "audio_buffer_pool.h"
 
 #include <driver/i2s.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
 
+#include <atomic>
+
 #include "esphome/components/speaker/speaker.h"
 #include "esphome/core/component.h"
 #include "esphome/core/gpio.h"
@@ -32,12 +35,6 @@ struct TaskEvent {
   esp_err_t err;
 };
 
-struct DataEvent {
-  bool stop;
-  size_t len;
-  uint8_t data[BUFFER_SIZE];
-};
-
 class I2SAudioSpeaker : public Component, public speaker::Speaker, public I2SAudioOut {
  public:
   float get_setup_priority() const override { return esphome::setup_priority::LATE; }
@@ -66,7 +63,9 @@ class I2SAudioSpeaker : public Component, public speaker::Speaker, public I2SAud
   static void player_task(void *params);
 
   TaskHandle_t player_task_handle_{nullptr};
-  QueueHandle_t buffer_queue_;
+  /// Audio passed from play() to the player task, which is notified when buffers are submitted
+  AudioBufferPool buffer_pool_;
+  std::atomic<bool> stop_requested_{false};
   QueueHandle_t event_queue_;
 
   uint8_t dout_pin_{0};
@@ -0,0 +1,118 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import http_request, sensor, time
+from esphome.const import (
+    CONF_BUFFER_SIZE,
+    CONF_ID,
+    CONF_RAW,
+    CONF_SENSOR_ID,
+    CONF_SENSORS,
+    CONF_TIME_ID,
+    CONF_URL,
+    PLATFORM_ESP32,
+    PLATFORM_HOST,
+)
+
+DEPENDENCIES = ["http_request"]
+
+influxdb_ns = cg.esphome_ns.namespace("influxdb")
+InfluxDBWriter = influxdb_ns.class_("InfluxDBWriter", cg.PollingComponent)
+
+CONF_HTTP_REQUEST_ID = "http_request_id"
+CONF_HEADERS = "headers"
+CONF_TAGS = "tags"
+CONF_MEASUREMENT = "measurement"
+CONF_FIELD = "field"
+CONF_MAX_BATCH_SIZE = "max_batch_size"
+
+
+def validate_http_url(value):
+    value = http_request.validate_url(value)
+    if not value.lower().startswith("http:"):
+        raise cv.Invalid("Only http:// URLs are supported")
+    return value
+
+
+def _escape(value, special):
+    for char in "\\" + special:
+        value = value.replace(char, f"\\{char}")
+    return value
+
+
+def _series(config, sensor_config):
+    """The line protocol of a sensor's samples up to the field value."""
+    measurement = sensor_config.get(CONF_MEASUREMENT, sensor_config[CONF_SENSOR_ID].id)
+    tags = {**config[CONF_TAGS], **sensor_config[CONF_TAGS]}
+    series = _escape(measurement, ", ")
+    # Sorted tags are the fastest for the server to process
+    for key, value in sorted(tags.items()):
+        series += f",{_escape(key, ',= ')}={_escape(value, ',= ')}"
+    return f"{series} {_escape(sensor_config[CONF_FIELD], ',= ')}="
+
+
+def validate_batch_size(config):
+    if config[CONF_MAX_BATCH_SIZE] > config[CONF_BUFFER_SIZE]:
+        raise cv.Invalid(
+            f"{CONF_MAX_BATCH_SIZE} can't be larger than {CONF_BUFFER_SIZE}"
+        )
+    return config
+
+
+TAGS_SCHEMA = cv.Schema({cv.string_strict: cv.string_strict})
+
+SENSOR_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_SENSOR_ID): cv.use_id(sensor.Sensor),
+        cv.Optional(CONF_MEASUREMENT): cv.string_strict,
+        cv.Optional(CONF_FIELD, default="value"): cv.string_strict,
+        cv.Optional(CONF_TAGS, default={}): TAGS_SCHEMA,
+        cv.Optional(CONF_RAW, default=False): cv.boolean,
+    }
+)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(InfluxDBWriter),
+            cv.GenerateID(CONF_HTTP_REQUEST_ID): cv.use_id(
+                http_request.HttpRequestComponent
+            ),
+            cv.GenerateID(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
+            cv.Required(CONF_URL): validate_http_url,
+            cv.Optional(CONF_HEADERS, default={}): cv.Schema({cv.string: cv.string}),
+            cv.Optional(CONF_TAGS, default={}): TAGS_SCHEMA,
+            cv.Optional(CONF_BUFFER_SIZE, default=512): cv.int_range(
+                min=1, max=65535
+            ),
+            cv.Optional(CONF_MAX_BATCH_SIZE, default=100): cv.int_range(
+                min=1, max=1000
+            ),
+            cv.Required(CONF_SENSORS): cv.All(
+                cv.ensure_list(SENSOR_SCHEMA), cv.Length(min=1)
+            ),
+        }
+    ).extend(cv.polling_component_schema("10s")),
+    validate_batch_size,
+    # Batches are sent by the asynchronous engine of http_request
+    cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]),
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_HTTP_REQUEST_ID])
+    time_ = await cg.get_variable(config[CONF_TIME_ID])
+    var = cg.new_Pvariable(config[CONF_ID], parent, time_)
+    await cg.register_component(var, config)
+
+    cg.add(var.set_url(config[CONF_URL]))
+    for name, value in config[CONF_HEADERS].items():
+        cg.add(var.add_header(name, value))
+    cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    cg.add(var.set_max_batch_size(config[CONF_MAX_BATCH_SIZE]))
+    for sensor_config in config[CONF_SENSORS]:
+        sens = await cg.get_variable(sensor_config[CONF_SENSOR_ID])
+        cg.add(
+            var.add_sensor(
+                sens, _series(config, sensor_config), sensor_config[CONF_RAW]
+            )
+        )
@@ -0,0 +1,178 @@
+#include "influxdb.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+
+namespace esphome {
+namespace influxdb {
+
+static const char *const TAG = "influxdb";
+
+static const uint32_t MAX_BACKOFF = 300000;
+// The clock is aligned again this often, to follow the drift of millis()
+static const uint32_t TIME_ANCHOR_INTERVAL = 600000;
+
+void InfluxDBWriter::setup() {
+  // Timestamps are sent in milliseconds
+  this->url_ += this->url_.find('?') == std::string::npos ? "?precision=ms" : "&precision=ms";
+  if (!http_request::AsyncRequest().set_url(this->url_)) {
+    ESP_LOGE(TAG, "Only http:// URLs are supported");
+    this->mark_failed();
+    return;
+  }
+  ExternalRAMAllocator<Sample> allocator(ExternalRAMAllocator<Sample>::ALLOW_FAILURE);
+  this->samples_ = allocator.allocate(this->buffer_size_);
+  if (this->samples_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate the sample buffer");
+    this->mark_failed();
+  }
+}
+
+void InfluxDBWriter::add_sensor(sensor::Sensor *sensor, const char *series, bool raw) {
+  uint16_t index = this->series_.size();
+  this->series_.push_back(series);
+  auto callback = [this, index](float value) { this->add_sample_(index, value); };
+  if (raw) {
+    sensor->add_on_raw_state_callback(callback);
+  } else {
+    sensor->add_on_state_callback(callback);
+  }
+}
+
+void InfluxDBWriter::add_sample_(uint16_t series, float value) {
+  // The line protocol has no representation for NaN or infinity
+  if (this->samples_ == nullptr || !std::isfinite(value))
+    return;
+  if (this->count_ == this->buffer_size_) {
+    // Samples of the batch being sent may be dropped too, they're the oldest
+    if (this->batch_count_ != 0)
+      this->batch_count_--;
+    this->pop_(1);
+    this->dropped_++;
+  }
+  this->samples_[(this->head_ + this->count_) % this->buffer_size_] = Sample{millis(), value, series};
+  this->count_++;
+}
+
+void InfluxDBWriter::pop_(uint16_t count) {
+  this->head_ = (this->head_ + count) % this->buffer_size_;
+  this->count_ -= count;
+}
+
+void InfluxDBWriter::update() {
+  if (this->dropped_ != 0) {
+    ESP_LOGW(TAG, "Dropped the %" PRIu32 " oldest samples, the buffer is full", this->dropped_);
+    this->dropped_ = 0;
+  }
+  this->flush_requested_ = true;
+}
+
+void InfluxDBWriter::loop() {
+  this->update_time_anchor_();
+
+  if (this->sending_ || this->count_ == 0)
+    return;
+  if (this->backoff_ != 0) {
+    if ((int32_t) (millis() - this->retry_at_) < 0)
+      return;
+  } else if (!this->flush_requested_ && this->count_ < this->max_batch_size_) {
+    return;
+  }
+  this->send_batch_();
+}
+
+void InfluxDBWriter::update_time_anchor_() {
+  const uint32_t now = millis();
+  if (this->anchored_ && now - this->anchor_millis_ < TIME_ANCHOR_INTERVAL)
+    return;
+  time_t epoch = this->time_->timestamp_now();
+  // The second just changed if it differs from the previous look, which is at most one loop ago
+  bool changed = this->last_epoch_valid_ && epoch != this->last_epoch_;
+  this->last_epoch_ = epoch;
+  this->last_epoch_valid_ = true;
+  if (!changed || !this->time_->utcnow().is_valid())
+    return;
+  this->anchor_epoch_ = epoch;
+  this->anchor_millis_ = now;
+  this->anchored_ = true;
+  // The clock isn't looked at until the next interval, start over then
+  this->last_epoch_valid_ = false;
+}
+
+void InfluxDBWriter::send_batch_() {
+  if (!this->anchored_) {
+    ESP_LOGV(TAG, "Waiting for the time to be set");
+    return;
+  }
+  const uint16_t count = std::min(this->count_, this->max_batch_size_);
+
+  auto request = make_unique<http_request::AsyncRequest>();
+  request->set_url(this->url_);
+  request->method = "POST";
+  request->headers = this->headers_;
+  request->headers.emplace_back("Content-Type", "text/plain; charset=utf-8");
+  std::string &body = request->body;
+  body.reserve(count * 64);
+  char value[48];
+  for (uint16_t i = 0; i < count; i++) {
+    const Sample &sample = this->samples_[(this->head_ + i) % this->buffer_size_];
+    int64_t timestamp = (int64_t) this->anchor_epoch_ * 1000 + (int32_t) (sample.time - this->anchor_millis_);
+    snprintf(value, sizeof(value), "%.7g %" PRId64 "\n", sample.value, timestamp);
+    body += this->series_[sample.series];
+    body += value;
+  }
+
+  this->batch_count_ = count;
+  this->sending_ = true;
+  ESP_LOGV(TAG, "Sending %u samples, %zu bytes", count, body.size());
+  request->on_complete = [this](int status_code, uint32_t duration_ms) {
+    this->on_response_(status_code, duration_ms);
+  };
+  this->parent_->send_async(std::move(request));
+}
+
+void InfluxDBWriter::on_response_(int status_code, uint32_t duration_ms) {
+  this->sending_ = false;
+  const uint16_t sent = this->batch_count_;
+  this->batch_count_ = 0;
+
+  if (status_code >= 200 && status_code < 300) {
+    ESP_LOGD(TAG, "Wrote %u samples in %" PRIu32 " ms", sent, duration_ms);
+    this->pop_(sent);
+    this->backoff_ = 0;
+    if (this->count_ == 0)
+      this->flush_requested_ = false;
+    this->status_clear_warning();
+    return;
+  }
+  if (status_code >= 400 && status_code < 500 && status_code != 408 && status_code != 429) {
+    // Retrying the same data would fail again
+    ESP_LOGW(TAG, "Server rejected the samples with status %d, dropping %u samples", status_code, sent);
+    this->pop_(sent);
+    this->backoff_ = 0;
+    this->status_set_warning();
+    return;
+  }
+
+  this->backoff_ = std::min(this->backoff_ == 0 ? this->get_update_interval() : this->backoff_ * 2, MAX_BACKOFF);
+  this->retry_at_ = millis() + this->backoff_;
+  ESP_LOGW(TAG, "Writing samples failed with status %d, retrying in %" PRIu32 " ms", status_code, this->backoff_);
+  this->status_set_warning();
+}
+
+void InfluxDBWriter::dump_config() {
+  ESP_LOGCONFIG(TAG, "InfluxDB:");
+  ESP_LOGCONFIG(TAG, "  URL: %s", this->url_.c_str());
+  ESP_LOGCONFIG(TAG, "  Series: %zu", this->series_.size());
+  ESP_LOGCONFIG(TAG, "  Buffer Size: %u samples", this->buffer_size_);
+  ESP_LOGCONFIG(TAG, "  Max Batch Size: %u samples", this->max_batch_size_);
+  LOG_UPDATE_INTERVAL(this);
+}
+
+}  // namespace influxdb
+}  // namespace esphome
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "esphome/components/http_request/http_request.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/time/real_time_clock.h"
+#include "esphome/core/component.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+namespace influxdb {
+
+/** Pushes sensor samples to an InfluxDB compatible server, in batches written with the line protocol.
+ *
+ * Each value is stored with the time it arrived in a fixed size ring of samples, the oldest ones are dropped when it
+ * is full. The samples are sent every update interval, or as soon as a batch is full, over the connection the
+ * http_request component keeps open. A failed batch is kept and retried with exponential backoff.
+ */
+class InfluxDBWriter : public PollingComponent {
+ public:
+  InfluxDBWriter(http_request::HttpRequestComponent *parent, time::RealTimeClock *time)
+      : parent_(parent), time_(time) {}
+
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
+
+  void set_url(const std::string &url) { this->url_ = url; }
+  void add_header(const std::string &name, const std::string &value) { this->headers_.emplace_back(name, value); }
+  void set_buffer_size(uint16_t buffer_size) { this->buffer_size_ = buffer_size; }
+  void set_max_batch_size(uint16_t max_batch_size) { this->max_batch_size_ = max_batch_size; }
+  /// Add a sensor whose values are written to the series, the line protocol up to the field value like
+  /// `temperature,room=kitchen value=`.
+  void add_sensor(sensor::Sensor *sensor, const char *series, bool raw);
+
+ protected:
+  struct Sample {
+    uint32_t time;  ///< millis() when the value arrived
+    float value;
+    uint16_t series;
+  };
+
+  void add_sample_(uint16_t series, float value);
+  /// Remove the oldest samples.
+  void pop_(uint16_t count);
+  /// Align millis() with the wall clock, at the moment the second of the real time clock changes.
+  void update_time_anchor_();
+  void send_batch_();
+  void on_response_(int status_code, uint32_t duration_ms);
+
+  http_request::HttpRequestComponent *parent_;
+  time::RealTimeClock *time_;
+  std::string url_;
+  std::vector<std::pair<std::string, std::string>> headers_;
+  std::vector<const char *> series_;
+  uint16_t buffer_size_{512};
+  uint16_t max_batch_size_{100};
+
+  Sample *samples_{nullptr};
+  uint16_t head_{0};  ///< Index of the oldest sample
+  uint16_t count_{0};
+  /// Number of the oldest samples that are being sent
+  uint16_t batch_count_{0};
+  bool sending_{false};
+  bool flush_requested_{false};
+  uint32_t dropped_{0};
+
+  uint32_t backoff_{0};
+  uint32_t retry_at_{0};
+
+  bool anchored_{false};
+  time_t anchor_epoch_{0};
+  uint32_t anchor_millis_{0};
+  time_t last_epoch_{0};
+  bool last_epoch_valid_{false};
+};
+
+}  // namespace influxdb
+}  // namespace esphome
@@ -111,8 +111,11 @@ void LD2410Component::loop() {
   const int max_line_length = 80;
   static uint8_t buffer[max_line_length];
 
-  while (available()) {
-    this->readline_(read(), buffer, max_line_length);
+  uint8_t buf[uart::READ_CHUNK_SIZE];
+  size_t len;
+  while ((len = this->read_array_available(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < len; i++)
+      this->readline_(buf[i], buffer, max_line_length);
   }
 }
 
@@ -232,10 +232,11 @@ void LD2420Component::loop() {
     if (!available())
       return;
     static uint8_t buffer[2048];
-    static uint8_t rx_data;
-    while (available()) {
-      rx_data = read();
-      this->readline_(rx_data, buffer, sizeof(buffer));
+    uint8_t buf[uart::READ_CHUNK_SIZE];
+    size_t len;
+    while ((len = this->read_array_available(buf, sizeof(buf))) > 0) {
+      for (size_t i = 0; i < len; i++)
+        this->readline_(buf[i], buffer, sizeof(buffer));
     }
   }
 }
@@ -535,8 +536,11 @@ int LD2420Component::send_cmd_from_array(CmdFrameT frame) {
     }
 
     while (!this->cmd_reply_.ack) {
-      while (available()) {
-        this->readline_(read(), ack_buffer, sizeof(ack_buffer));
+      uint8_t buf[uart::READ_CHUNK_SIZE];
+      size_t len;
+      while ((len = this->read_array_available(buf, sizeof(buf))) > 0) {
+        for (size_t i = 0; i < len; i++)
+          this->readline_(buf[i], ack_buffer, sizeof(ack_buffer));
       }
       delay_microseconds_safe(250);
       if (loop_count <= 0) {
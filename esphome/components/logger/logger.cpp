@@ -3,6 +3,7 @@
 
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
+#include "esphome/core/metrics.h"
 
 namespace esphome {
 namespace logger {
@@ -106,6 +107,10 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
 
   const char *msg = this->tx_buffer_ + offset;
 
+#ifdef USE_RUNTIME_METRICS
+  metrics::global_metrics.log_lines.fetch_add(1, std::memory_order_relaxed);
+#endif
+
   if (this->baud_rate_ > 0) {
     this->write_msg_(msg);
   }
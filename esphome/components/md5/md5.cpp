@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include "md5.h"
@@ -39,6 +40,96 @@ void MD5Digest::add(const uint8_t *data, size_t len) { br_md5_update(&this->ctx_
 void MD5Digest::calculate() { br_md5_out(&this->ctx_, this->digest_); }
 #endif  // USE_RP2040
 
+#ifdef USE_HOST
+static const uint32_t MD5_K[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+};
+static const uint8_t MD5_SHIFT[16] = {7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
+
+static void md5_transform(uint32_t state[4], const uint8_t block[64]) {
+  uint32_t m[16];
+  for (uint8_t i = 0; i < 16; i++) {
+    m[i] = encode_uint32(block[i * 4 + 3], block[i * 4 + 2], block[i * 4 + 1], block[i * 4]);
+  }
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+  for (uint8_t i = 0; i < 64; i++) {
+    uint32_t f;
+    uint8_t g;
+    if (i < 16) {
+      f = (b & c) | (~b & d);
+      g = i;
+    } else if (i < 32) {
+      f = (d & b) | (~d & c);
+      g = (5 * i + 1) % 16;
+    } else if (i < 48) {
+      f = b ^ c ^ d;
+      g = (3 * i + 5) % 16;
+    } else {
+      f = c ^ (b | ~d);
+      g = (7 * i) % 16;
+    }
+    uint8_t shift = MD5_SHIFT[(i / 16) * 4 + i % 4];
+    f += a + MD5_K[i] + m[g];
+    a = d;
+    d = c;
+    c = b;
+    b += (f << shift) | (f >> (32 - shift));
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+}
+
+void MD5Digest::init() {
+  memset(this->digest_, 0, 16);
+  this->ctx_.state[0] = 0x67452301;
+  this->ctx_.state[1] = 0xefcdab89;
+  this->ctx_.state[2] = 0x98badcfe;
+  this->ctx_.state[3] = 0x10325476;
+  this->ctx_.length = 0;
+}
+
+void MD5Digest::add(const uint8_t *data, size_t len) {
+  size_t used = this->ctx_.length % 64;
+  this->ctx_.length += len;
+  if (used != 0) {
+    size_t fill = std::min(len, 64 - used);
+    memcpy(this->ctx_.buffer + used, data, fill);
+    data += fill;
+    len -= fill;
+    if (used + fill < 64)
+      return;
+    md5_transform(this->ctx_.state, this->ctx_.buffer);
+  }
+  for (; len >= 64; data += 64, len -= 64) {
+    md5_transform(this->ctx_.state, data);
+  }
+  memcpy(this->ctx_.buffer, data, len);
+}
+
+void MD5Digest::calculate() {
+  uint64_t bits = this->ctx_.length * 8;
+  uint8_t padding[72] = {0x80};
+  size_t used = this->ctx_.length % 64;
+  size_t pad_len = (used < 56 ? 56 : 120) - used;
+  for (uint8_t i = 0; i < 8; i++) {
+    padding[pad_len + i] = bits >> (8 * i);
+  }
+  this->add(padding, pad_len + 8);
+  for (uint8_t i = 0; i < 16; i++) {
+    this->digest_[i] = this->ctx_.state[i / 4] >> (8 * (i % 4));
+  }
+}
+#endif  // USE_HOST
+
 void MD5Digest::get_bytes(uint8_t *output) { memcpy(output, this->digest_, 16); }
 
 void MD5Digest::get_hex(char *output) {
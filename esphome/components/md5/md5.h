@@ -27,6 +27,22 @@
 #define MD5_CTX_TYPE LT_MD5_CTX_T
 #endif
 
+#ifdef USE_HOST
+#include <cstddef>
+#include <cstdint>
+namespace esphome {
+namespace md5 {
+/// State of the portable RFC 1321 implementation used on the host
+struct HostMD5Context {
+  uint32_t state[4];
+  uint64_t length;  ///< Number of bytes added so far
+  uint8_t buffer[64];
+};
+}  // namespace md5
+}  // namespace esphome
+#define MD5_CTX_TYPE esphome::md5::HostMD5Context
+#endif
+
 namespace esphome {
 namespace md5 {
 
@@ -44,6 +44,7 @@ DOMAIN = "micro_wake_word"
 CONF_PROBABILITY_CUTOFF = "probability_cutoff"
 CONF_SLIDING_WINDOW_AVERAGE_SIZE = "sliding_window_average_size"
 CONF_ON_WAKE_WORD_DETECTED = "on_wake_word_detected"
+CONF_MODELS = "models"
 
 TYPE_HTTP = "http"
 
@@ -104,6 +105,7 @@ KEY_WEBSITE = "website"
 KEY_VERSION = "version"
 KEY_MICRO = "micro"
 KEY_MINIMUM_ESPHOME_VERSION = "minimum_esphome_version"
+KEY_TENSOR_ARENA_SIZE = "tensor_arena_size"
 
 MANIFEST_SCHEMA_V1 = cv.Schema(
     {
@@ -120,6 +122,7 @@ MANIFEST_SCHEMA_V1 = cv.Schema(
                 cv.Optional(KEY_MINIMUM_ESPHOME_VERSION): cv.All(
                     cv.version_number, cv.validate_esphome_version
                 ),
+                cv.Optional(KEY_TENSOR_ARENA_SIZE): cv.positive_not_null_int,
             }
         ),
     }
@@ -260,20 +263,59 @@ MODEL_SOURCE_SCHEMA = cv.Any(
     msg="Not a valid model name, local path, http(s) url, or github shorthand",
 )
 
+MODEL_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_MODEL): MODEL_SOURCE_SCHEMA,
+        cv.Optional(CONF_PROBABILITY_CUTOFF): cv.percentage,
+        cv.Optional(CONF_SLIDING_WINDOW_AVERAGE_SIZE): cv.positive_not_null_int,
+        cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+    }
+)
+
+
+def _convert_single_model(config):
+    """Move the settings of a single `model:` into the `models:` list."""
+    model_keys = (CONF_PROBABILITY_CUTOFF, CONF_SLIDING_WINDOW_AVERAGE_SIZE)
+    if CONF_MODEL not in config:
+        for key in model_keys:
+            if key in config:
+                raise cv.Invalid(
+                    f"'{key}' has to be set per model when using '{CONF_MODELS}'",
+                    path=[key],
+                )
+        config.pop(CONF_RAW_DATA_ID, None)
+        return config
+
+    model = {
+        CONF_MODEL: config.pop(CONF_MODEL),
+        CONF_RAW_DATA_ID: config.pop(CONF_RAW_DATA_ID),
+    }
+    for key in model_keys:
+        if key in config:
+            model[key] = config.pop(key)
+    config[CONF_MODELS] = [model]
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(MicroWakeWord),
             cv.GenerateID(CONF_MICROPHONE): cv.use_id(microphone.Microphone),
             cv.Optional(CONF_PROBABILITY_CUTOFF): cv.percentage,
-            cv.Optional(CONF_SLIDING_WINDOW_AVERAGE_SIZE): cv.positive_int,
+            cv.Optional(CONF_SLIDING_WINDOW_AVERAGE_SIZE): cv.positive_not_null_int,
             cv.Optional(CONF_ON_WAKE_WORD_DETECTED): automation.validate_automation(
                 single=True
             ),
-            cv.Required(CONF_MODEL): MODEL_SOURCE_SCHEMA,
+            cv.Optional(CONF_MODEL): MODEL_SOURCE_SCHEMA,
+            cv.Optional(CONF_MODELS): cv.All(
+                cv.ensure_list(MODEL_SCHEMA), cv.Length(min=1)
+            ),
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         }
     ).extend(cv.COMPONENT_SCHEMA),
+    cv.has_exactly_one_key(CONF_MODEL, CONF_MODELS),
+    _convert_single_model,
     cv.only_with_esp_idf,
 )
 
@@ -295,6 +337,43 @@ def _load_model_data(manifest_path: Path):
     return manifest, model
 
 
+def _model_to_code(model_config):
+    source_config = model_config[CONF_MODEL]
+    if source_config[CONF_TYPE] == TYPE_GIT:
+        # compute path to model file
+        key = f"{source_config[CONF_URL]}@{source_config.get(CONF_REF)}"
+        base_dir = Path(CORE.data_dir) / DOMAIN
+        h = hashlib.new("sha256")
+        h.update(key.encode())
+        file: Path = base_dir / h.hexdigest()[:8] / source_config[CONF_FILE]
+
+    elif source_config[CONF_TYPE] == TYPE_LOCAL:
+        file = source_config[CONF_PATH]
+
+    elif source_config[CONF_TYPE] == TYPE_HTTP:
+        file = _compute_local_file_path(source_config) / "manifest.json"
+
+    manifest, data = _load_model_data(file)
+
+    rhs = [HexInt(x) for x in data]
+    prog_arr = cg.progmem_array(model_config[CONF_RAW_DATA_ID], rhs)
+    return manifest, prog_arr
+
+
+def _model_settings(model_config, manifest):
+    micro = manifest[KEY_MICRO]
+    probability_cutoff = model_config.get(
+        CONF_PROBABILITY_CUTOFF, micro[CONF_PROBABILITY_CUTOFF]
+    )
+    sliding_window_size = model_config.get(
+        CONF_SLIDING_WINDOW_AVERAGE_SIZE, micro[CONF_SLIDING_WINDOW_AVERAGE_SIZE]
+    )
+    tensor_arena_size = micro.get(
+        KEY_TENSOR_ARENA_SIZE, micro_wake_word_ns.STREAMING_MODEL_ARENA_SIZE
+    )
+    return probability_cutoff, sliding_window_size, tensor_arena_size
+
+
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
@@ -318,39 +397,20 @@ async def to_code(config):
     cg.add_build_flag("-DTF_LITE_DISABLE_X86_NEON")
     cg.add_build_flag("-DESP_NN")
 
-    model_config = config.get(CONF_MODEL)
-    data = []
-    if model_config[CONF_TYPE] == TYPE_GIT:
-        # compute path to model file
-        key = f"{model_config[CONF_URL]}@{model_config.get(CONF_REF)}"
-        base_dir = Path(CORE.data_dir) / DOMAIN
-        h = hashlib.new("sha256")
-        h.update(key.encode())
-        file: Path = base_dir / h.hexdigest()[:8] / model_config[CONF_FILE]
-
-    elif model_config[CONF_TYPE] == TYPE_LOCAL:
-        file = model_config[CONF_PATH]
-
-    elif model_config[CONF_TYPE] == TYPE_HTTP:
-        file = _compute_local_file_path(model_config) / "manifest.json"
-
-    manifest, data = _load_model_data(file)
-
-    rhs = [HexInt(x) for x in data]
-    prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
-    cg.add(var.set_model_start(prog_arr))
-
-    probability_cutoff = config.get(
-        CONF_PROBABILITY_CUTOFF, manifest[KEY_MICRO][CONF_PROBABILITY_CUTOFF]
-    )
-    cg.add(var.set_probability_cutoff(probability_cutoff))
-    sliding_window_average_size = config.get(
-        CONF_SLIDING_WINDOW_AVERAGE_SIZE,
-        manifest[KEY_MICRO][CONF_SLIDING_WINDOW_AVERAGE_SIZE],
-    )
-    cg.add(var.set_sliding_window_average_size(sliding_window_average_size))
-
-    cg.add(var.set_wake_word(manifest[KEY_WAKE_WORD]))
+    for model_config in config[CONF_MODELS]:
+        manifest, prog_arr = _model_to_code(model_config)
+        probability_cutoff, sliding_window_size, tensor_arena_size = _model_settings(
+            model_config, manifest
+        )
+        cg.add(
+            var.add_wake_word_model(
+                prog_arr,
+                probability_cutoff,
+                sliding_window_size,
+                manifest[KEY_WAKE_WORD],
+                tensor_arena_size,
+            )
+        )
 
 
 MICRO_WAKE_WORD_ACTION_SCHEMA = cv.Schema({cv.GenerateID(): cv.use_id(MicroWakeWord)})
@@ -1,6 +1,6 @@
 #pragma once
 
-#ifdef USE_ESP_IDF
+#if defined(USE_ESP_IDF) || defined(USE_HOST)
 
 // Converted audio_preprocessor_int8.tflite
 // From https://github.com/tensorflow/tflite-micro/tree/main/tensorflow/lite/micro/examples/micro_speech/models accessed
@@ -490,4 +490,4 @@ const unsigned char G_AUDIO_PREPROCESSOR_INT8_TFLITE[] = {
 }  // namespace micro_wake_word
 }  // namespace esphome
 
-#endif  // USE_ESP_IDF
+#endif  // USE_ESP_IDF || USE_HOST
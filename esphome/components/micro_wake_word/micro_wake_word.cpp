@@ -8,7 +8,7 @@
 //
 #ifndef CLANG_TIDY
 
-#ifdef USE_ESP_IDF
+#if defined(USE_ESP_IDF) || defined(USE_HOST)
 
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
@@ -20,8 +20,6 @@
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
 
-#include <cmath>
-
 namespace esphome {
 namespace micro_wake_word {
 
@@ -55,9 +53,12 @@ static const LogString *micro_wake_word_state_to_string(State state) {
 
 void MicroWakeWord::dump_config() {
   ESP_LOGCONFIG(TAG, "microWakeWord:");
-  ESP_LOGCONFIG(TAG, "  Wake Word: %s", this->get_wake_word().c_str());
-  ESP_LOGCONFIG(TAG, "  Probability cutoff: %.3f", this->probability_cutoff_);
-  ESP_LOGCONFIG(TAG, "  Sliding window size: %d", this->sliding_window_average_size_);
+  ESP_LOGCONFIG(TAG, "  models:");
+  for (auto *model : this->wake_word_models_) {
+    ESP_LOGCONFIG(TAG, "    - Wake Word: %s", model->get_wake_word().c_str());
+    ESP_LOGCONFIG(TAG, "      Probability cutoff: %.3f", model->get_probability_cutoff());
+    ESP_LOGCONFIG(TAG, "      Sliding window size: %d", model->get_sliding_window_size());
+  }
 }
 
 void MicroWakeWord::setup() {
@@ -69,14 +70,6 @@ void MicroWakeWord::setup() {
     return;
   }
 
-  ExternalRAMAllocator<int16_t> allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
-  this->input_buffer_ = allocator.allocate(INPUT_BUFFER_SIZE * sizeof(int16_t));
-  if (this->input_buffer_ == nullptr) {
-    ESP_LOGW(TAG, "Could not allocate input buffer");
-    this->mark_failed();
-    return;
-  }
-
   this->ring_buffer_ = RingBuffer::create(BUFFER_SIZE * sizeof(int16_t));
   if (this->ring_buffer_ == nullptr) {
     ESP_LOGW(TAG, "Could not allocate ring buffer");
@@ -88,16 +81,28 @@ void MicroWakeWord::setup() {
 }
 
 int MicroWakeWord::read_microphone_() {
-  size_t bytes_read = this->microphone_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-  if (bytes_read == 0) {
-    return 0;
-  }
-
-  size_t bytes_written = this->ring_buffer_->write((void *) this->input_buffer_, bytes_read);
-  if (bytes_written != bytes_read) {
-    ESP_LOGW(TAG, "Failed to write some data to ring buffer (written=%d, expected=%d)", bytes_written, bytes_read);
+  size_t to_read = INPUT_BUFFER_SIZE * sizeof(int16_t);
+  if (this->ring_buffer_->free() < to_read) {
+    // Detection fell behind. Read into the preprocessor's audio buffer first, which is unused outside of
+    // detect_wake_word_(), so that only as much of the oldest audio is dropped as was read.
+    size_t bytes_read =
+        this->microphone_->read(this->preprocessor_audio_buffer_, SAMPLE_DURATION_COUNT * sizeof(int16_t));
+    this->ring_buffer_->write(this->preprocessor_audio_buffer_, bytes_read);
+    return bytes_read;
+  }
+  // There's room for all of it, read straight into the ring buffer. The second read continues at its start if the
+  // region wrapped.
+  size_t bytes_read = 0;
+  while (to_read > 0) {
+    RingBuffer::Span span = this->ring_buffer_->acquire_write(to_read);
+    size_t len = this->microphone_->read(reinterpret_cast<int16_t *>(span.data), span.len);
+    this->ring_buffer_->commit(len);
+    bytes_read += len;
+    to_read -= len;
+    if (len < span.len)
+      break;
   }
-  return bytes_written;
+  return bytes_read;
 }
 
 void MicroWakeWord::loop() {
@@ -112,13 +117,14 @@ void MicroWakeWord::loop() {
       break;
     case State::STARTING_MICROPHONE:
       if (this->microphone_->is_running()) {
+        this->reset_models_();
         this->set_state_(State::DETECTING_WAKE_WORD);
       }
       break;
     case State::DETECTING_WAKE_WORD:
       this->read_microphone_();
       if (this->detect_wake_word_()) {
-        ESP_LOGD(TAG, "Wake Word Detected");
+        ESP_LOGD(TAG, "Wake Word '%s' Detected", this->detected_wake_word_.c_str());
         this->detected_ = true;
         this->set_state_(State::STOP_MICROPHONE);
       }
@@ -134,7 +140,7 @@ void MicroWakeWord::loop() {
         this->set_state_(State::IDLE);
         if (this->detected_) {
           this->detected_ = false;
-          this->wake_word_detected_trigger_->trigger(this->wake_word_);
+          this->wake_word_detected_trigger_->trigger(this->detected_wake_word_);
         }
       }
       break;
@@ -176,18 +182,6 @@ bool MicroWakeWord::initialize_models() {
   ExternalRAMAllocator<int8_t> features_allocator(ExternalRAMAllocator<int8_t>::ALLOW_FAILURE);
   ExternalRAMAllocator<int16_t> audio_samples_allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
 
-  this->streaming_tensor_arena_ = arena_allocator.allocate(STREAMING_MODEL_ARENA_SIZE);
-  if (this->streaming_tensor_arena_ == nullptr) {
-    ESP_LOGE(TAG, "Could not allocate the streaming model's tensor arena.");
-    return false;
-  }
-
-  this->streaming_var_arena_ = arena_allocator.allocate(STREAMING_MODEL_VARIABLE_ARENA_SIZE);
-  if (this->streaming_var_arena_ == nullptr) {
-    ESP_LOGE(TAG, "Could not allocate the streaming model variable's tensor arena.");
-    return false;
-  }
-
   this->preprocessor_tensor_arena_ = arena_allocator.allocate(PREPROCESSOR_ARENA_SIZE);
   if (this->preprocessor_tensor_arena_ == nullptr) {
     ESP_LOGE(TAG, "Could not allocate the audio preprocessor model's tensor arena.");
@@ -206,85 +200,49 @@ bool MicroWakeWord::initialize_models() {
     return false;
   }
 
-  this->preprocessor_stride_buffer_ = audio_samples_allocator.allocate(HISTORY_SAMPLES_TO_KEEP);
-  if (this->preprocessor_stride_buffer_ == nullptr) {
-    ESP_LOGE(TAG, "Could not allocate the audio preprocessor's stride buffer.");
-    return false;
-  }
-
   this->preprocessor_model_ = tflite::GetModel(G_AUDIO_PREPROCESSOR_INT8_TFLITE);
   if (this->preprocessor_model_->version() != TFLITE_SCHEMA_VERSION) {
     ESP_LOGE(TAG, "Wake word's audio preprocessor model's schema is not supported");
     return false;
   }
 
-  this->streaming_model_ = tflite::GetModel(this->model_start_);
-  if (this->streaming_model_->version() != TFLITE_SCHEMA_VERSION) {
-    ESP_LOGE(TAG, "Wake word's streaming model's schema is not supported");
-    return false;
-  }
-
   static tflite::MicroMutableOpResolver<18> preprocessor_op_resolver;
-  static tflite::MicroMutableOpResolver<14> streaming_op_resolver;
+  static StreamingOpResolver streaming_op_resolver;
 
   if (!this->register_preprocessor_ops_(preprocessor_op_resolver))
     return false;
   if (!this->register_streaming_ops_(streaming_op_resolver))
     return false;
 
-  tflite::MicroAllocator *ma =
-      tflite::MicroAllocator::Create(this->streaming_var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
-  this->mrv_ = tflite::MicroResourceVariables::Create(ma, 15);
-
   static tflite::MicroInterpreter static_preprocessor_interpreter(
       this->preprocessor_model_, preprocessor_op_resolver, this->preprocessor_tensor_arena_, PREPROCESSOR_ARENA_SIZE);
 
-  static tflite::MicroInterpreter static_streaming_interpreter(this->streaming_model_, streaming_op_resolver,
-                                                               this->streaming_tensor_arena_,
-                                                               STREAMING_MODEL_ARENA_SIZE, this->mrv_);
-
   this->preprocessor_interperter_ = &static_preprocessor_interpreter;
-  this->streaming_interpreter_ = &static_streaming_interpreter;
 
-  // Allocate tensors for each models.
   if (this->preprocessor_interperter_->AllocateTensors() != kTfLiteOk) {
     ESP_LOGE(TAG, "Failed to allocate tensors for the audio preprocessor");
     return false;
   }
-  if (this->streaming_interpreter_->AllocateTensors() != kTfLiteOk) {
-    ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model");
-    return false;
-  }
-
-  // Verify input tensor matches expected values
-  TfLiteTensor *input = this->streaming_interpreter_->input(0);
-  if ((input->dims->size != 3) || (input->dims->data[0] != 1) || (input->dims->data[0] != 1) ||
-      (input->dims->data[1] != 1) || (input->dims->data[2] != PREPROCESSOR_FEATURE_SIZE)) {
-    ESP_LOGE(TAG, "Wake word detection model tensor input dimensions is not 1x1x%u", input->dims->data[2]);
-    return false;
-  }
-
-  if (input->type != kTfLiteInt8) {
-    ESP_LOGE(TAG, "Wake word detection model tensor input is not int8.");
-    return false;
-  }
-
-  // Verify output tensor matches expected values
-  TfLiteTensor *output = this->streaming_interpreter_->output(0);
-  if ((output->dims->size != 2) || (output->dims->data[0] != 1) || (output->dims->data[1] != 1)) {
-    ESP_LOGE(TAG, "Wake word detection model tensor output dimensions is not 1x1.");
-  }
 
-  if (output->type != kTfLiteUInt8) {
-    ESP_LOGE(TAG, "Wake word detection model tensor input is not uint8.");
-    return false;
+  // The streaming models share the op resolver, each has its own arenas
+  for (auto *model : this->wake_word_models_) {
+    if (!model->load(streaming_op_resolver)) {
+      ESP_LOGE(TAG, "Failed to load the model for wake word '%s'", model->get_wake_word().c_str());
+      return false;
+    }
   }
 
-  this->recent_streaming_probabilities_.resize(this->sliding_window_average_size_, 0.0);
-
   return true;
 }
 
+void MicroWakeWord::add_wake_word_model(const uint8_t *model_start, float probability_cutoff,
+                                        size_t sliding_window_average_size, const std::string &wake_word,
+                                        size_t tensor_arena_size) {
+  // The models live as long as the component
+  this->wake_word_models_.push_back(
+      new WakeWordModel(model_start, probability_cutoff, sliding_window_average_size, wake_word, tensor_arena_size));
+}
+
 bool MicroWakeWord::update_features_() {
   // Retrieve strided audio samples
   int16_t *audio_samples = nullptr;
@@ -293,79 +251,42 @@ bool MicroWakeWord::update_features_() {
   }
 
   // Compute the features for the newest audio samples
-  if (!this->generate_single_feature_(audio_samples, SAMPLE_DURATION_COUNT, this->new_features_data_)) {
-    return false;
-  }
+  bool generated = this->generate_single_feature_(audio_samples, SAMPLE_DURATION_COUNT, this->new_features_data_);
 
-  return true;
-}
+  // Drop the samples that aren't part of the next window, the last 10 ms stay in the ring buffer as its history
+  this->ring_buffer_->consume(NEW_SAMPLES_TO_GET * sizeof(int16_t));
 
-float MicroWakeWord::perform_streaming_inference_() {
-  TfLiteTensor *input = this->streaming_interpreter_->input(0);
-
-  size_t bytes_to_copy = input->bytes;
-
-  memcpy((void *) (tflite::GetTensorData<int8_t>(input)), (const void *) (this->new_features_data_), bytes_to_copy);
-
-  uint32_t prior_invoke = millis();
+  return generated;
+}
 
-  TfLiteStatus invoke_status = this->streaming_interpreter_->Invoke();
-  if (invoke_status != kTfLiteOk) {
-    ESP_LOGW(TAG, "Streaming Interpreter Invoke failed");
-    return false;
+void MicroWakeWord::reset_models_() {
+  for (auto *model : this->wake_word_models_) {
+    model->reset_probabilities();
   }
-
-  ESP_LOGV(TAG, "Streaming Inference Latency=%u ms", (millis() - prior_invoke));
-
-  TfLiteTensor *output = this->streaming_interpreter_->output(0);
-
-  return static_cast<float>(output->data.uint8[0]) / 255.0;
 }
 
 bool MicroWakeWord::detect_wake_word_() {
-  // Preprocess the newest audio samples into features
+  // Preprocess the newest audio samples into features, shared by all models
   if (!this->update_features_()) {
     return false;
   }
 
-  // Perform inference
-  uint32_t streaming_size = micros();
-  float streaming_prob = this->perform_streaming_inference_();
-
-  // Add the most recent probability to the sliding window
-  this->recent_streaming_probabilities_[this->last_n_index_] = streaming_prob;
-  ++this->last_n_index_;
-  if (this->last_n_index_ == this->sliding_window_average_size_)
-    this->last_n_index_ = 0;
-
-  float sum = 0.0;
-  for (auto &prob : this->recent_streaming_probabilities_) {
-    sum += prob;
+  // Run every model on the slice so their streaming state stays current, the first detection wins
+  WakeWordModel *detected_model = nullptr;
+  for (auto *model : this->wake_word_models_) {
+    model->perform_streaming_inference(this->new_features_data_);
+    if (model->determine_detected() && detected_model == nullptr) {
+      detected_model = model;
+    }
   }
 
-  float sliding_window_average = sum / static_cast<float>(this->sliding_window_average_size_);
-
-  // Ensure we have enough samples since the last positive detection
-  this->ignore_windows_ = std::min(this->ignore_windows_ + 1, 0);
-  if (this->ignore_windows_ < 0) {
+  if (detected_model == nullptr) {
     return false;
   }
 
-  // Detect the wake word if the sliding window average is above the cutoff
-  if (sliding_window_average > this->probability_cutoff_) {
-    this->ignore_windows_ = -MIN_SLICES_BEFORE_DETECTION;
-    for (auto &prob : this->recent_streaming_probabilities_) {
-      prob = 0;
-    }
-    return true;
-  }
-
-  return false;
-}
-
-void MicroWakeWord::set_sliding_window_average_size(size_t size) {
-  this->sliding_window_average_size_ = size;
-  this->recent_streaming_probabilities_.resize(this->sliding_window_average_size_, 0.0);
+  this->detected_wake_word_ = detected_model->get_wake_word();
+  this->reset_models_();
+  return true;
 }
 
 bool MicroWakeWord::slice_available_() {
@@ -388,7 +309,7 @@ bool MicroWakeWord::slice_available_() {
     );
   }
 
-  return available > (NEW_SAMPLES_TO_GET * sizeof(int16_t));
+  return available >= (SAMPLE_DURATION_COUNT * sizeof(int16_t));
 }
 
 bool MicroWakeWord::stride_audio_samples_(int16_t **audio_samples) {
@@ -396,30 +317,17 @@ bool MicroWakeWord::stride_audio_samples_(int16_t **audio_samples) {
     return false;
   }
 
-  // Copy 320 bytes (160 samples over 10 ms) into preprocessor_audio_buffer_ from history in
-  // preprocessor_stride_buffer_
-  memcpy((void *) (this->preprocessor_audio_buffer_), (void *) (this->preprocessor_stride_buffer_),
-         HISTORY_SAMPLES_TO_KEEP * sizeof(int16_t));
-
-  // Copy 640 bytes (320 samples over 20 ms) from the ring buffer
-  // The first 320 bytes (160 samples over 10 ms) will be from history
-  size_t bytes_read = this->ring_buffer_->read((void *) (this->preprocessor_audio_buffer_ + HISTORY_SAMPLES_TO_KEEP),
-                                               NEW_SAMPLES_TO_GET * sizeof(int16_t), pdMS_TO_TICKS(200));
-
-  if (bytes_read == 0) {
-    ESP_LOGE(TAG, "Could not read data from Ring Buffer");
-  } else if (bytes_read < NEW_SAMPLES_TO_GET * sizeof(int16_t)) {
-    ESP_LOGD(TAG, "Partial Read of Data by Model");
-    ESP_LOGD(TAG, "Could only read %d bytes when required %d bytes ", bytes_read,
-             (int) (NEW_SAMPLES_TO_GET * sizeof(int16_t)));
-    return false;
+  // The window of 960 bytes (480 samples over 30 ms) starts with the 10 ms of history kept in the ring buffer
+  const size_t window_bytes = SAMPLE_DURATION_COUNT * sizeof(int16_t);
+  RingBuffer::Span span = this->ring_buffer_->peek_read(window_bytes);
+  if (span.len == window_bytes) {
+    // Feed the preprocessor straight from the ring buffer
+    *audio_samples = reinterpret_cast<int16_t *>(span.data);
+    return true;
   }
 
-  // Copy the last 320 bytes (160 samples over 10 ms) from the audio buffer into history stride buffer for the next
-  // iteration
-  memcpy((void *) (this->preprocessor_stride_buffer_), (void *) (this->preprocessor_audio_buffer_ + NEW_SAMPLES_TO_GET),
-         HISTORY_SAMPLES_TO_KEEP * sizeof(int16_t));
-
+  // The window wraps around the end of the ring buffer
+  this->ring_buffer_->peek(this->preprocessor_audio_buffer_, window_bytes);
   *audio_samples = this->preprocessor_audio_buffer_;
   return true;
 }
@@ -480,7 +388,7 @@ bool MicroWakeWord::register_preprocessor_ops_(tflite::MicroMutableOpResolver<18
   return true;
 }
 
-bool MicroWakeWord::register_streaming_ops_(tflite::MicroMutableOpResolver<14> &op_resolver) {
+bool MicroWakeWord::register_streaming_ops_(StreamingOpResolver &op_resolver) {
   if (op_resolver.AddCallOnce() != kTfLiteOk)
     return false;
   if (op_resolver.AddVarHandle() != kTfLiteOk)
@@ -516,6 +424,6 @@ bool MicroWakeWord::register_streaming_ops_(tflite::MicroMutableOpResolver<14> &
 }  // namespace micro_wake_word
 }  // namespace esphome
 
-#endif  // USE_ESP_IDF
+#endif  // USE_ESP_IDF || USE_HOST
 
 #endif  // CLANG_TIDY
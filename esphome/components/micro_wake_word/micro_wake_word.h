@@ -8,7 +8,7 @@
 //
 #ifndef CLANG_TIDY
 
-#ifdef USE_ESP_IDF
+#if defined(USE_ESP_IDF) || defined(USE_HOST)
 
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
@@ -16,6 +16,8 @@
 
 #include "esphome/components/microphone/microphone.h"
 
+#include "streaming_model.h"
+
 #include <tensorflow/lite/core/c/common.h>
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
@@ -23,10 +25,8 @@
 namespace esphome {
 namespace micro_wake_word {
 
-// The following are dictated by the preprocessor model
+// The following are dictated by the preprocessor model, PREPROCESSOR_FEATURE_SIZE is in streaming_model.h
 //
-// The number of features the audio preprocessor generates per slice
-static const uint8_t PREPROCESSOR_FEATURE_SIZE = 40;
 // How frequently the preprocessor generates a new set of features
 static const uint8_t FEATURE_STRIDE_MS = 20;
 // Duration of each slice used as input into the preprocessor
@@ -43,15 +43,6 @@ static const uint16_t SAMPLE_DURATION_COUNT = FEATURE_DURATION_MS * AUDIO_SAMPLE
 // Number of bytes in memory needed for the preprocessor arena
 static const uint32_t PREPROCESSOR_ARENA_SIZE = 9528;
 
-// The following configure the streaming wake word model
-//
-// The number of audio slices to process before accepting a positive detection
-static const uint8_t MIN_SLICES_BEFORE_DETECTION = 74;
-
-// Number of bytes in memory needed for the streaming wake word model
-static const uint32_t STREAMING_MODEL_ARENA_SIZE = 64000;
-static const uint32_t STREAMING_MODEL_VARIABLE_ARENA_SIZE = 1024;
-
 enum State {
   IDLE,
   START_MICROPHONE,
@@ -75,25 +66,25 @@ class MicroWakeWord : public Component {
 
   bool initialize_models();
 
-  std::string get_wake_word() { return this->wake_word_; }
+  /// The wake word of the most recent detection
+  const std::string &get_wake_word() const { return this->detected_wake_word_; }
 
-  // Increasing either of these will reduce the rate of false acceptances while increasing the false rejection rate
-  void set_probability_cutoff(float probability_cutoff) { this->probability_cutoff_ = probability_cutoff; }
-  void set_sliding_window_average_size(size_t size);
+  // Increasing either the probability cutoff or the sliding window average size will reduce the rate of false
+  // acceptances while increasing the false rejection rate
+  void add_wake_word_model(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_average_size,
+                           const std::string &wake_word, size_t tensor_arena_size);
 
   void set_microphone(microphone::Microphone *microphone) { this->microphone_ = microphone; }
 
   Trigger<std::string> *get_wake_word_detected_trigger() const { return this->wake_word_detected_trigger_; }
 
-  void set_model_start(const uint8_t *model_start) { this->model_start_ = model_start; }
-  void set_wake_word(const std::string &wake_word) { this->wake_word_ = wake_word; }
-
  protected:
   void set_state_(State state);
   int read_microphone_();
 
-  const uint8_t *model_start_;
-  std::string wake_word_;
+  // All models are fed the same features, the preprocessor runs once per slice
+  std::vector<WakeWordModel *> wake_word_models_;
+  std::string detected_wake_word_;
 
   microphone::Microphone *microphone_{nullptr};
   Trigger<std::string> *wake_word_detected_trigger_ = new Trigger<std::string>();
@@ -102,42 +93,21 @@ class MicroWakeWord : public Component {
 
   std::unique_ptr<RingBuffer> ring_buffer_;
 
-  int16_t *input_buffer_;
-
   const tflite::Model *preprocessor_model_{nullptr};
-  const tflite::Model *streaming_model_{nullptr};
-  tflite::MicroInterpreter *streaming_interpreter_{nullptr};
   tflite::MicroInterpreter *preprocessor_interperter_{nullptr};
 
-  std::vector<float> recent_streaming_probabilities_;
-  size_t last_n_index_{0};
-
-  float probability_cutoff_{0.5};
-  size_t sliding_window_average_size_{10};
-
-  // When the wake word detection first starts or after the word has been detected once, we ignore this many audio
-  // feature slices before accepting a positive detection again
-  int16_t ignore_windows_{-MIN_SLICES_BEFORE_DETECTION};
-
-  uint8_t *streaming_var_arena_{nullptr};
-  uint8_t *streaming_tensor_arena_{nullptr};
   uint8_t *preprocessor_tensor_arena_{nullptr};
   int8_t *new_features_data_{nullptr};
 
-  tflite::MicroResourceVariables *mrv_{nullptr};
-
-  // Stores audio fed into feature generator preprocessor
+  // Stores audio fed into feature generator preprocessor when the window wraps around the end of the ring buffer
   int16_t *preprocessor_audio_buffer_;
-  int16_t *preprocessor_stride_buffer_;
 
   bool detected_{false};
 
-  /** Detects if wake word has been said
+  /** Detects if a wake word has been said
    *
-   * If enough audio samples are available, it will generate one slice of new features.
-   * If the streaming model predicts the wake word, then the nonstreaming model confirms it.
-   * @param ring_Buffer Ring buffer containing raw audio samples
-   * @return True if the wake word is detected, false otherwise
+   * If enough audio samples are available, it will generate one slice of new features and run every model over it.
+   * @return True if a wake word is detected, false otherwise
    */
   bool detect_wake_word_();
 
@@ -162,17 +132,14 @@ class MicroWakeWord : public Component {
   bool generate_single_feature_(const int16_t *audio_data, int audio_data_size,
                                 int8_t feature_output[PREPROCESSOR_FEATURE_SIZE]);
 
-  /** Performs inference over the most recent feature slice with the streaming model
-   *
-   * @return Probability of the wake word between 0.0 and 1.0
-   */
-  float perform_streaming_inference_();
+  /// @brief Forgets the recent probabilities of all models
+  void reset_models_();
 
-  /** Strides the audio samples by keeping the last 10 ms of the previous slice
+  /** Gets the window of audio samples for the next slice, which starts with the last 10 ms of the previous one
    *
-   * Adapted from the TFLite micro speech example
-   * @param ring_buffer Ring buffer containing raw audio samples
-   * @param audio_samples Pointer to an array that will store the strided audio samples
+   * The samples are used in place in the ring buffer unless they wrap around its end. update_features_() consumes
+   * the new samples afterwards, keeping the history for the next window.
+   * @param audio_samples Pointer that will point to the strided audio samples
    * @return True if successful, false otherwise
    */
   bool stride_audio_samples_(int16_t **audio_samples);
@@ -181,7 +148,7 @@ class MicroWakeWord : public Component {
   bool register_preprocessor_ops_(tflite::MicroMutableOpResolver<18> &op_resolver);
 
   /// @brief Returns true if successfully registered the streaming model's TensorFlow operations
-  bool register_streaming_ops_(tflite::MicroMutableOpResolver<14> &op_resolver);
+  bool register_streaming_ops_(StreamingOpResolver &op_resolver);
 };
 
 template<typename... Ts> class StartAction : public Action<Ts...>, public Parented<MicroWakeWord> {
@@ -202,6 +169,6 @@ template<typename... Ts> class IsRunningCondition : public Condition<Ts...>, pub
 }  // namespace micro_wake_word
 }  // namespace esphome
 
-#endif  // USE_ESP_IDF
+#endif  // USE_ESP_IDF || USE_HOST
 
 #endif  // CLANG_TIDY
@@ -0,0 +1,38 @@
+#include "sliding_window_average.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+namespace micro_wake_word {
+
+void SlidingWindowAverage::set_window_size(size_t size) {
+  this->window_.assign(std::max<size_t>(size, 1), 0);
+  this->index_ = 0;
+  this->sum_ = 0;
+  this->update_cutoff_sum_();
+}
+
+void SlidingWindowAverage::set_probability_cutoff(float probability_cutoff) {
+  this->probability_cutoff_ = probability_cutoff;
+  this->update_cutoff_sum_();
+}
+
+float SlidingWindowAverage::get_average() const {
+  return static_cast<float>(this->sum_) / (255.0f * static_cast<float>(this->window_.size()));
+}
+
+void SlidingWindowAverage::clear() {
+  std::fill(this->window_.begin(), this->window_.end(), 0);
+  this->sum_ = 0;
+}
+
+void SlidingWindowAverage::update_cutoff_sum_() {
+  // sum / (255 * size) > cutoff <=> sum > floor(cutoff * 255 * size),
+  // as the sum is an integer. The product is taken in double so it doesn't round across an integer
+  double limit = std::floor(static_cast<double>(this->probability_cutoff_) * 255.0 * this->window_.size());
+  this->cutoff_sum_ = static_cast<uint32_t>(std::max(limit, 0.0));
+}
+
+}  // namespace micro_wake_word
+}  // namespace esphome
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace micro_wake_word {
+
+/** Average of the most recent probabilities a streaming model produced, updated in O(1) per slice.
+ *
+ * The models output probabilities as uint8 (255 is 1.0), so the window and its running sum are kept as integers and
+ * the cutoff is compared against the sum instead of dividing for every slice.
+ */
+class SlidingWindowAverage {
+ public:
+  /// Set the number of slices averaged, clears the window.
+  void set_window_size(size_t size);
+  size_t get_window_size() const { return this->window_.size(); }
+  /// Set the cutoff between 0.0 and 1.0 the average has to exceed.
+  void set_probability_cutoff(float probability_cutoff);
+  float get_probability_cutoff() const { return this->probability_cutoff_; }
+
+  /// Replace the oldest probability with the newest one.
+  void add(uint8_t probability) {
+    this->sum_ += probability;
+    this->sum_ -= this->window_[this->index_];
+    this->window_[this->index_] = probability;
+    if (++this->index_ == this->window_.size())
+      this->index_ = 0;
+  }
+  /// Whether the average of the window is above the cutoff.
+  bool above_cutoff() const { return this->sum_ > this->cutoff_sum_; }
+  /// Average of the window between 0.0 and 1.0.
+  float get_average() const;
+
+  /// Set all probabilities in the window to 0.
+  void clear();
+
+ protected:
+  void update_cutoff_sum_();
+
+  std::vector<uint8_t> window_ = std::vector<uint8_t>(1);
+  size_t index_{0};
+  uint32_t sum_{0};
+  float probability_cutoff_{0.5};
+  /// The largest sum of the window that is still not above the cutoff
+  uint32_t cutoff_sum_{0};
+};
+
+}  // namespace micro_wake_word
+}  // namespace esphome
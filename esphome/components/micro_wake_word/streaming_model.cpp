@@ -0,0 +1,135 @@
+#include "streaming_model.h"
+
+/**
+ * This is a workaround until we can figure out a way to get
+ * the tflite-micro idf component code available in CI
+ *
+ * */
+//
+#ifndef CLANG_TIDY
+
+#if defined(USE_ESP_IDF) || defined(USE_HOST)
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace micro_wake_word {
+
+static const char *const TAG = "micro_wake_word";
+
+StreamingModel::StreamingModel(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_size,
+                               size_t tensor_arena_size)
+    : model_start_(model_start), tensor_arena_size_(tensor_arena_size) {
+  this->sliding_window_.set_window_size(sliding_window_size);
+  this->sliding_window_.set_probability_cutoff(probability_cutoff);
+}
+
+bool StreamingModel::load(const StreamingOpResolver &op_resolver) {
+  ExternalRAMAllocator<uint8_t> arena_allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+
+  this->tensor_arena_ = arena_allocator.allocate(this->tensor_arena_size_);
+  if (this->tensor_arena_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate the streaming model's tensor arena.");
+    return false;
+  }
+
+  this->var_arena_ = arena_allocator.allocate(STREAMING_MODEL_VARIABLE_ARENA_SIZE);
+  if (this->var_arena_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate the streaming model variable's tensor arena.");
+    return false;
+  }
+
+  const tflite::Model *model = tflite::GetModel(this->model_start_);
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    ESP_LOGE(TAG, "Streaming model's schema is not supported");
+    return false;
+  }
+
+  tflite::MicroAllocator *ma = tflite::MicroAllocator::Create(this->var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
+  this->mrv_ = tflite::MicroResourceVariables::Create(ma, 15);
+
+  this->interpreter_ = make_unique<tflite::MicroInterpreter>(model, op_resolver, this->tensor_arena_,
+                                                             this->tensor_arena_size_, this->mrv_);
+  if (this->interpreter_->AllocateTensors() != kTfLiteOk) {
+    ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model");
+    return false;
+  }
+
+  // Verify input tensor matches expected values
+  TfLiteTensor *input = this->interpreter_->input(0);
+  if ((input->dims->size != 3) || (input->dims->data[0] != 1) || (input->dims->data[1] != 1) ||
+      (input->dims->data[2] != PREPROCESSOR_FEATURE_SIZE)) {
+    ESP_LOGE(TAG, "Streaming model tensor input dimensions is not 1x1x%u", PREPROCESSOR_FEATURE_SIZE);
+    return false;
+  }
+
+  if (input->type != kTfLiteInt8) {
+    ESP_LOGE(TAG, "Streaming model tensor input is not int8.");
+    return false;
+  }
+
+  // Verify output tensor matches expected values
+  TfLiteTensor *output = this->interpreter_->output(0);
+  if ((output->dims->size != 2) || (output->dims->data[0] != 1) || (output->dims->data[1] != 1)) {
+    ESP_LOGE(TAG, "Streaming model tensor output dimensions is not 1x1.");
+  }
+
+  if (output->type != kTfLiteUInt8) {
+    ESP_LOGE(TAG, "Streaming model tensor output is not uint8.");
+    return false;
+  }
+
+  return true;
+}
+
+bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE]) {
+  TfLiteTensor *input = this->interpreter_->input(0);
+  std::memcpy(tflite::GetTensorData<int8_t>(input), features, PREPROCESSOR_FEATURE_SIZE);
+
+  uint32_t prior_invoke = millis();
+
+  if (this->interpreter_->Invoke() != kTfLiteOk) {
+    ESP_LOGW(TAG, "Streaming Interpreter Invoke failed");
+    return false;
+  }
+
+  ESP_LOGV(TAG, "Streaming Inference Latency=%u ms", (millis() - prior_invoke));
+
+  TfLiteTensor *output = this->interpreter_->output(0);
+  this->last_probability_ = output->data.uint8[0];
+  this->sliding_window_.add(this->last_probability_);
+  return true;
+}
+
+WakeWordModel::WakeWordModel(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_average_size,
+                             const std::string &wake_word, size_t tensor_arena_size)
+    : StreamingModel(model_start, probability_cutoff, sliding_window_average_size, tensor_arena_size),
+      wake_word_(wake_word) {}
+
+bool WakeWordModel::determine_detected() {
+  // Ensure we have enough samples since the last positive detection
+  this->ignore_windows_ = std::min(this->ignore_windows_ + 1, 0);
+  if (this->ignore_windows_ < 0) {
+    return false;
+  }
+
+  // Detect the wake word if the sliding window average is above the cutoff
+  return this->sliding_window_.above_cutoff();
+}
+
+void WakeWordModel::reset_probabilities() {
+  StreamingModel::reset_probabilities();
+  this->ignore_windows_ = -MIN_SLICES_BEFORE_DETECTION;
+}
+
+}  // namespace micro_wake_word
+}  // namespace esphome
+
+#endif  // USE_ESP_IDF || USE_HOST
+
+#endif  // CLANG_TIDY
@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+ * This is a workaround until we can figure out a way to get
+ * the tflite-micro idf component code available in CI
+ *
+ * */
+//
+#ifndef CLANG_TIDY
+
+// TFLite Micro is portable, so the models can also be run on the host, e.g. to replay recordings
+#if defined(USE_ESP_IDF) || defined(USE_HOST)
+
+#include "sliding_window_average.h"
+
+#include <tensorflow/lite/core/c/common.h>
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+
+#include <memory>
+#include <string>
+
+namespace esphome {
+namespace micro_wake_word {
+
+// The number of features the audio preprocessor generates per slice
+static const uint8_t PREPROCESSOR_FEATURE_SIZE = 40;
+
+// The number of audio slices to process before accepting a positive detection
+static const uint8_t MIN_SLICES_BEFORE_DETECTION = 74;
+
+// Default number of bytes in memory needed for a streaming model, the manifest can give the actual size
+static const uint32_t STREAMING_MODEL_ARENA_SIZE = 64000;
+static const uint32_t STREAMING_MODEL_VARIABLE_ARENA_SIZE = 1024;
+
+// Number of operations registered for the streaming models
+static const uint8_t STREAMING_MODEL_OP_COUNT = 14;
+using StreamingOpResolver = tflite::MicroMutableOpResolver<STREAMING_MODEL_OP_COUNT>;
+
+/** A streaming model fed one slice of audio features at a time.
+ *
+ * The models share the features of the audio preprocessor, each keeps its own tensor arena, resource variables (the
+ * streaming state) and the sliding window of its most recent probabilities.
+ */
+class StreamingModel {
+ public:
+  virtual ~StreamingModel() = default;
+
+  /// Allocate the arenas and set up the interpreter. The op resolver has to outlive the model.
+  bool load(const StreamingOpResolver &op_resolver);
+
+  /// Run the model on the newest slice of features and add the probability to the sliding window.
+  bool perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE]);
+
+  /// Whether the sliding window says the model detected what it's trained for, called once per slice.
+  virtual bool determine_detected() = 0;
+
+  /// Forget the recent probabilities, e.g. after a detection.
+  virtual void reset_probabilities() { this->sliding_window_.clear(); }
+
+  float get_probability_cutoff() const { return this->sliding_window_.get_probability_cutoff(); }
+  size_t get_sliding_window_size() const { return this->sliding_window_.get_window_size(); }
+  float get_sliding_window_average() const { return this->sliding_window_.get_average(); }
+  uint8_t get_last_probability() const { return this->last_probability_; }
+
+ protected:
+  StreamingModel(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_size,
+                 size_t tensor_arena_size);
+
+  const uint8_t *model_start_;
+  size_t tensor_arena_size_;
+  SlidingWindowAverage sliding_window_;
+  uint8_t last_probability_{0};
+
+  uint8_t *tensor_arena_{nullptr};
+  uint8_t *var_arena_{nullptr};
+  tflite::MicroResourceVariables *mrv_{nullptr};
+  std::unique_ptr<tflite::MicroInterpreter> interpreter_;
+};
+
+class WakeWordModel : public StreamingModel {
+ public:
+  WakeWordModel(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_average_size,
+                const std::string &wake_word, size_t tensor_arena_size);
+
+  /// Detected when the average is above the cutoff, but not within MIN_SLICES_BEFORE_DETECTION slices of starting
+  /// or of the previous detection.
+  bool determine_detected() override;
+  void reset_probabilities() override;
+
+  const std::string &get_wake_word() const { return this->wake_word_; }
+
+ protected:
+  std::string wake_word_;
+  // When the wake word detection first starts or after the word has been detected once, we ignore this many audio
+  // feature slices before accepting a positive detection again
+  int16_t ignore_windows_{-MIN_SLICES_BEFORE_DETECTION};
+};
+
+}  // namespace micro_wake_word
+}  // namespace esphome
+
+#endif  // USE_ESP_IDF || USE_HOST
+
+#endif  // CLANG_TIDY
@@ -10,12 +10,14 @@ from esphome.const import (
 )
 from esphome import pins
 
-DEPENDENCIES = ["uart"]
-
 modbus_ns = cg.esphome_ns.namespace("modbus")
-Modbus = modbus_ns.class_("Modbus", cg.Component, uart.UARTDevice)
+ModbusTransport = modbus_ns.class_("ModbusTransport")
+Modbus = modbus_ns.class_("Modbus", cg.Component, uart.UARTDevice, ModbusTransport)
 ModbusDevice = modbus_ns.class_("ModbusDevice")
 MULTI_CONF = True
+# Auto-loaded by the modbus devices and modbus_tcp for the shared transport code,
+# RTU buses are only created for the entries of a modbus: block
+MULTI_CONF_NO_DEFAULT = True
 
 CONF_MODBUS_ID = "modbus_id"
 CONF_SEND_WAIT_TIME = "send_wait_time"
@@ -38,6 +40,7 @@ CONFIG_SCHEMA = (
 
 async def to_code(config):
     cg.add_global(modbus_ns.using)
+    cg.add_define("USE_MODBUS_RTU")
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
@@ -53,7 +56,7 @@ async def to_code(config):
 
 def modbus_device_schema(default_address):
     schema = {
-        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(Modbus),
+        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(ModbusTransport),
     }
     if default_address is None:
         schema[cv.Required(CONF_ADDRESS)] = cv.hex_uint8_t
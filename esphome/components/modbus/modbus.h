@@ -1,67 +1,72 @@
 #pragma once
 
 #include "esphome/core/component.h"
-#include "esphome/components/uart/uart.h"
 
 #include <vector>
 
 namespace esphome {
 namespace modbus {
 
+class Modbus;
 class ModbusDevice;
 
-class Modbus : public uart::UARTDevice, public Component {
+/** Interface of the transports the modbus devices send their requests through.
+ *
+ * Modbus (modbus_rtu.h) implements RTU over a UART, which has a single request in flight and matches the response by
+ * the device address. Transports identifying responses by a transaction id (like Modbus TCP) return that id from
+ * send() and report responses through the on_modbus_transaction_*() callbacks of ModbusDevice.
+ */
+class ModbusTransport {
  public:
-  Modbus() = default;
-
-  void setup() override;
-
-  void loop() override;
-
-  void dump_config() override;
+  virtual ~ModbusTransport() = default;
 
   void register_device(ModbusDevice *device) { this->devices_.push_back(device); }
 
-  float get_setup_priority() const override;
-
-  void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
-            uint8_t payload_len = 0, const uint8_t *payload = nullptr);
-  void send_raw(const std::vector<uint8_t> &payload);
-  void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
-  uint8_t waiting_for_response{0};
-  void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
-  void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+  /// Send a request, returns its transaction id or 0 if the transport has none or the request wasn't sent.
+  virtual uint16_t send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                        uint8_t payload_len = 0, const uint8_t *payload = nullptr) = 0;
+  /// Send a raw request starting with the device address, the checksum or header is added by the transport.
+  virtual uint16_t send_raw(const std::vector<uint8_t> &payload) = 0;
+  /// Whether a new request has to wait for the response to an earlier one.
+  virtual bool is_busy() const = 0;
 
  protected:
-  GPIOPin *flow_control_pin_{nullptr};
+  /// Append device address, function code and data of a request to data. Returns false if it has too many values.
+  static bool encode_request_(std::vector<uint8_t> &data, uint8_t address, uint8_t function_code,
+                              uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len,
+                              const uint8_t *payload);
 
-  bool parse_modbus_byte_(uint8_t byte);
-  uint16_t send_wait_time_{250};
-  bool disable_crc_;
-  std::vector<uint8_t> rx_buffer_;
-  uint32_t last_modbus_byte_{0};
-  uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
 };
 
 class ModbusDevice {
  public:
-  void set_parent(Modbus *parent) { parent_ = parent; }
+  void set_parent(ModbusTransport *parent) { parent_ = parent; }
   void set_address(uint8_t address) { address_ = address; }
+  uint8_t get_address() const { return address_; }
   virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
   virtual void on_modbus_error(uint8_t function_code, uint8_t exception_code) {}
-  void send(uint8_t function, uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len = 0,
-            const uint8_t *payload = nullptr) {
-    this->parent_->send(this->address_, function, start_address, number_of_entities, payload_len, payload);
+  // Called instead of the above by transports with transaction ids, devices with more than one request in flight
+  // override these to match the response to its request.
+  virtual void on_modbus_transaction_data(uint16_t transaction_id, const std::vector<uint8_t> &data) {
+    this->on_modbus_data(data);
+  }
+  virtual void on_modbus_transaction_error(uint16_t transaction_id, uint8_t function_code, uint8_t exception_code) {
+    this->on_modbus_error(function_code, exception_code);
+  }
+  virtual void on_modbus_transaction_timeout(uint16_t transaction_id) {}
+  uint16_t send(uint8_t function, uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len = 0,
+                const uint8_t *payload = nullptr) {
+    return this->parent_->send(this->address_, function, start_address, number_of_entities, payload_len, payload);
   }
-  void send_raw(const std::vector<uint8_t> &payload) { this->parent_->send_raw(payload); }
+  uint16_t send_raw(const std::vector<uint8_t> &payload) { return this->parent_->send_raw(payload); }
   // If more than one device is connected block sending a new command before a response is received
-  bool waiting_for_response() { return parent_->waiting_for_response != 0; }
+  bool waiting_for_response() { return parent_->is_busy(); }
 
  protected:
   friend Modbus;
 
-  Modbus *parent_;
+  ModbusTransport *parent_;
   uint8_t address_;
 };
 
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MODBUS_RTU
+
+#include "esphome/components/uart/uart.h"
+#include "modbus.h"
+
+#include <vector>
+
+namespace esphome {
+namespace modbus {
+
+class Modbus : public uart::UARTDevice, public Component, public ModbusTransport {
+ public:
+  Modbus() = default;
+
+  void setup() override;
+
+  void loop() override;
+
+  void dump_config() override;
+
+  float get_setup_priority() const override;
+
+  uint16_t send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                uint8_t payload_len = 0, const uint8_t *payload = nullptr) override;
+  uint16_t send_raw(const std::vector<uint8_t> &payload) override;
+  bool is_busy() const override { return this->waiting_for_response != 0; }
+  void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
+  uint8_t waiting_for_response{0};
+  void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
+  void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+
+ protected:
+  GPIOPin *flow_control_pin_{nullptr};
+
+  bool parse_modbus_byte_(uint8_t byte);
+  uint16_t send_wait_time_{250};
+  bool disable_crc_;
+  std::vector<uint8_t> rx_buffer_;
+  uint32_t last_modbus_byte_{0};
+  uint32_t last_send_{0};
+};
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif  // USE_MODBUS_RTU
@@ -5,13 +5,16 @@ from esphome.components import modbus
 from esphome.const import CONF_ADDRESS, CONF_ID, CONF_NAME, CONF_LAMBDA, CONF_OFFSET
 from esphome.cpp_helpers import logging
 from .const import (
+    CONF_ADAPTIVE_THROTTLE,
     CONF_BITMASK,
     CONF_BYTE_OFFSET,
     CONF_COMMAND_THROTTLE,
     CONF_OFFLINE_SKIP_UPDATES,
     CONF_CUSTOM_COMMAND,
     CONF_FORCE_NEW_RANGE,
+    CONF_MAX_REGISTER_GAP,
     CONF_MODBUS_CONTROLLER_ID,
+    CONF_POLL_INTERVAL,
     CONF_REGISTER_COUNT,
     CONF_REGISTER_TYPE,
     CONF_RESPONSE_SIZE,
@@ -106,6 +109,10 @@ CONFIG_SCHEMA = cv.All(
                 CONF_COMMAND_THROTTLE, default="0ms"
             ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_OFFLINE_SKIP_UPDATES, default=0): cv.positive_int,
+            cv.Optional(CONF_MAX_REGISTER_GAP, default=0): cv.int_range(
+                min=0, max=124
+            ),
+            cv.Optional(CONF_ADAPTIVE_THROTTLE, default=False): cv.boolean,
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -130,6 +137,7 @@ ModbusItemBaseSchema = cv.Schema(
         ): cv.positive_int,
         cv.Optional(CONF_BITMASK, default=0xFFFFFFFF): cv.hex_uint32_t,
         cv.Optional(CONF_SKIP_UPDATES, default=0): cv.positive_int,
+        cv.Optional(CONF_POLL_INTERVAL): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_FORCE_NEW_RANGE, default=False): cv.boolean,
         cv.Optional(CONF_LAMBDA): cv.returning_lambda,
         cv.Optional(CONF_RESPONSE_SIZE, default=0): cv.positive_int,
@@ -191,6 +199,9 @@ async def add_modbus_base_properties(
     if config[CONF_RESPONSE_SIZE] > 0:
         cg.add(var.set_register_size(config[CONF_RESPONSE_SIZE]))
 
+    if CONF_POLL_INTERVAL in config:
+        cg.add(var.set_poll_interval(config[CONF_POLL_INTERVAL]))
+
     if CONF_LAMBDA in config:
         template_ = await cg.process_lambda(
             config[CONF_LAMBDA],
@@ -211,6 +222,8 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     cg.add(var.set_command_throttle(config[CONF_COMMAND_THROTTLE]))
     cg.add(var.set_offline_skip_updates(config[CONF_OFFLINE_SKIP_UPDATES]))
+    cg.add(var.set_max_register_gap(config[CONF_MAX_REGISTER_GAP]))
+    cg.add(var.set_adaptive_throttle(config[CONF_ADAPTIVE_THROTTLE]))
     await register_modbus_device(var, config)
 
 
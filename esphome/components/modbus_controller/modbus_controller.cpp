@@ -2,14 +2,25 @@
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus_controller {
 
 static const char *const TAG = "modbus_controller";
 
+// Bounds of the delay added between commands when adaptive throttling backs off (ms)
+static const uint32_t ADAPTIVE_DELAY_MIN = 20;
+static const uint32_t ADAPTIVE_DELAY_MAX = 2000;
+
 void ModbusController::setup() {
   // Modbus::setup();
   this->create_register_ranges_();
+  // ranges with their own poll interval are polled right away
+  const uint32_t now = millis();
+  for (auto &r : this->register_ranges_)
+    r.last_poll = now - r.poll_interval;
+  this->next_scheduled_poll_ = now;
 }
 
 /*
@@ -22,6 +33,20 @@ bool ModbusController::send_next_command_() {
   uint32_t last_send = millis() - this->last_command_timestamp_;
 
   if ((last_send > this->command_throttle_) && !waiting_for_response() && !command_queue_.empty()) {
+    if (this->adaptive_throttle_) {
+      if (!this->response_received_) {
+        // the last command timed out, give the device more time between commands
+        this->adaptive_delay_ =
+            clamp(std::max(this->adaptive_delay_ * 2, this->response_time_), ADAPTIVE_DELAY_MIN, ADAPTIVE_DELAY_MAX);
+        this->response_received_ = true;
+        this->last_response_timestamp_ = millis();
+        ESP_LOGD(TAG, "Modbus device=%d timed out, delaying commands by %" PRIu32 "ms", this->address_,
+                 this->adaptive_delay_);
+      }
+      if (millis() - this->last_response_timestamp_ < this->adaptive_delay_)
+        return true;
+    }
+
     auto &command = command_queue_.front();
 
     // remove from queue if command was sent too often
@@ -47,6 +72,14 @@ bool ModbusController::send_next_command_() {
                command->register_address, command->register_count);
       command->send();
       this->last_command_timestamp_ = millis();
+      command->sent_at = this->last_command_timestamp_;
+      if (command->transaction_id != 0 && command->on_data_func) {
+        // the transport matches the response by its transaction id, the next command doesn't have to wait for it
+        this->in_flight_.push_back(std::move(command));
+        command_queue_.pop_front();
+        return (!command_queue_.empty());
+      }
+      this->response_received_ = !command->on_data_func;
       // remove from queue if no handler is defined
       if (!command->on_data_func) {
         command_queue_.pop_front();
@@ -56,21 +89,24 @@ bool ModbusController::send_next_command_() {
   return (!command_queue_.empty());
 }
 
+void ModbusController::on_response_received_(uint32_t sent_at) {
+  const uint32_t now = millis();
+  const uint32_t response_time = now - sent_at;
+  // smoothed like the round trip time estimate of TCP
+  this->response_time_ = this->response_time_ == 0 ? response_time : (this->response_time_ * 7 + response_time) / 8;
+  this->last_response_timestamp_ = now;
+  this->response_received_ = true;
+  // after backing off probe for a shorter delay slowly, one millisecond per response
+  if (this->adaptive_delay_ > 0)
+    this->adaptive_delay_--;
+}
+
 // Queue incoming response
 void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
+  this->on_response_received_(this->last_command_timestamp_);
   auto &current_command = this->command_queue_.front();
   if (current_command != nullptr) {
-    if (this->module_offline_) {
-      ESP_LOGW(TAG, "Modbus device=%d back online", this->address_);
-
-      if (this->offline_skip_updates_ > 0) {
-        // Restore skip_updates_counter to restore commands updates
-        for (auto &r : this->register_ranges_) {
-          r.skip_updates_counter = 0;
-        }
-      }
-    }
-    this->module_offline_ = false;
+    this->set_online_();
 
     // Move the commandItem to the response queue
     current_command->payload = data;
@@ -80,6 +116,63 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
   }
 }
 
+void ModbusController::set_online_() {
+  if (this->module_offline_) {
+    ESP_LOGW(TAG, "Modbus device=%d back online", this->address_);
+
+    if (this->offline_skip_updates_ > 0) {
+      // Restore skip_updates_counter to restore commands updates
+      for (auto &r : this->register_ranges_) {
+        r.skip_updates_counter = 0;
+      }
+    }
+  }
+  this->module_offline_ = false;
+}
+
+std::unique_ptr<ModbusCommandItem> ModbusController::take_in_flight_(uint16_t transaction_id) {
+  for (auto it = this->in_flight_.begin(); it != this->in_flight_.end(); ++it) {
+    if ((*it)->transaction_id == transaction_id) {
+      auto command = std::move(*it);
+      this->in_flight_.erase(it);
+      return command;
+    }
+  }
+  ESP_LOGV(TAG, "No command waiting for transaction %u", transaction_id);
+  return nullptr;
+}
+
+void ModbusController::on_modbus_transaction_data(uint16_t transaction_id, const std::vector<uint8_t> &data) {
+  auto command = this->take_in_flight_(transaction_id);
+  if (command == nullptr)
+    return;
+  this->on_response_received_(command->sent_at);
+  this->set_online_();
+  command->payload = data;
+  this->incoming_queue_.push(std::move(command));
+  ESP_LOGV(TAG, "Modbus response queued");
+}
+
+void ModbusController::on_modbus_transaction_error(uint16_t transaction_id, uint8_t function_code,
+                                                   uint8_t exception_code) {
+  ESP_LOGE(TAG, "Modbus error function code: 0x%X exception: %d ", function_code, exception_code);
+  auto command = this->take_in_flight_(transaction_id);
+  if (command == nullptr)
+    return;
+  this->on_response_received_(command->sent_at);
+  ESP_LOGE(TAG, "Modbus error - command: function code=0x%X  register address = 0x%X  registers count=%d",
+           function_code, command->register_address, command->register_count);
+}
+
+void ModbusController::on_modbus_transaction_timeout(uint16_t transaction_id) {
+  auto command = this->take_in_flight_(transaction_id);
+  if (command == nullptr)
+    return;
+  // send it again next, send_next_command_() drops it and sets the device offline once it ran out of repeats
+  this->response_received_ = false;
+  command_queue_.push_front(std::move(command));
+}
+
 // Dispatch the response to the registered handler
 void ModbusController::process_modbus_data_(const ModbusCommandItem *response) {
   ESP_LOGV(TAG, "Process modbus response for address 0x%X size: %zu", response->register_address,
@@ -89,6 +182,7 @@ void ModbusController::process_modbus_data_(const ModbusCommandItem *response) {
 
 void ModbusController::on_modbus_error(uint8_t function_code, uint8_t exception_code) {
   ESP_LOGE(TAG, "Modbus error function code: 0x%X exception: %d ", function_code, exception_code);
+  this->on_response_received_(this->last_command_timestamp_);
   // Remove pending command waiting for a response
   auto &current_command = this->command_queue_.front();
   if (current_command != nullptr) {
@@ -140,16 +234,66 @@ void ModbusController::queue_command(const ModbusCommandItem &command) {
       return;
     }
   }
+  if (command.poll_interval != 0 && !command_queue_.empty()) {
+    // Scheduled reads go before the reads queued by update() and before reads with a longer poll interval.
+    // The command in front is never displaced, it might be waiting for its response.
+    auto it = std::find_if(std::next(command_queue_.begin()), command_queue_.end(),
+                           [&command](const std::unique_ptr<ModbusCommandItem> &item) {
+                             return item->function_code >= ModbusFunctionCode::READ_COILS &&
+                                    item->function_code <= ModbusFunctionCode::READ_INPUT_REGISTERS &&
+                                    (item->poll_interval == 0 || item->poll_interval > command.poll_interval);
+                           });
+    command_queue_.insert(it, make_unique<ModbusCommandItem>(command));
+    return;
+  }
   command_queue_.push_back(make_unique<ModbusCommandItem>(command));
 }
 
-void ModbusController::update_range_(RegisterRange &r) {
-  ESP_LOGV(TAG, "Range : %X Size: %x (%d) skip: %d", r.start_address, r.register_count, (int) r.register_type,
-           r.skip_updates_counter);
-  if (r.skip_updates_counter == 0) {
+bool ModbusController::is_queued_(const ModbusCommandItem &command) const {
+  for (auto &item : command_queue_) {
+    if (item->is_equal(command))
+      return true;
+  }
+  for (auto &item : in_flight_) {
+    if (item->is_equal(command))
+      return true;
+  }
+  return false;
+}
+
+bool ModbusController::can_merge_ranges_(const RegisterRange &first, uint16_t end, const RegisterRange &next) const {
+  // registers are cut out of the merged response by their size of two bytes, coils and inputs are packed as bits
+  if (next.register_type != first.register_type ||
+      (next.register_type != ModbusRegisterType::HOLDING && next.register_type != ModbusRegisterType::READ))
+    return false;
+  if (next.start_address < end || next.start_address - end > this->max_register_gap_)
+    return false;
+  if (next.start_address + next.register_count - first.start_address > ModbusCommandItem::MAX_READ_REGISTERS)
+    return false;
+  for (auto *sensor : next.sensors) {
+    if (sensor->force_new_range || sensor->response_bytes != 0)
+      return false;
+  }
+  for (auto *sensor : first.sensors) {
+    if (sensor->response_bytes != 0)
+      return false;
+  }
+  return true;
+}
+
+void ModbusController::queue_ranges_(std::vector<RegisterRange *> &ranges) {
+  std::sort(ranges.begin(), ranges.end(), [](const RegisterRange *a, const RegisterRange *b) {
+    if (a->register_type != b->register_type)
+      return a->register_type < b->register_type;
+    return a->start_address < b->start_address;
+  });
+
+  size_t i = 0;
+  while (i < ranges.size()) {
+    RegisterRange &first = *ranges[i];
     // if a custom command is used the user supplied custom_data is only available in the SensorItem.
-    if (r.register_type == ModbusRegisterType::CUSTOM) {
-      auto sensors = this->find_sensors_(r.register_type, r.start_address);
+    if (first.register_type == ModbusRegisterType::CUSTOM) {
+      auto sensors = this->find_sensors_(first.register_type, first.start_address);
       if (!sensors.empty()) {
         auto sensor = sensors.cbegin();
         auto command_item = ModbusCommandItem::create_custom_command(
@@ -160,16 +304,57 @@ void ModbusController::update_range_(RegisterRange &r) {
         command_item.register_address = (*sensor)->start_address;
         command_item.register_count = (*sensor)->register_count;
         command_item.function_code = ModbusFunctionCode::CUSTOM;
-        queue_command(command_item);
+        command_item.poll_interval = first.poll_interval;
+        if (first.poll_interval == 0 || !this->is_queued_(command_item))
+          queue_command(command_item);
       }
+      i++;
+      continue;
+    }
+
+    // merge the following due ranges, reading the unused registers in between is cheaper than another request
+    uint16_t end = first.start_address + first.register_count;
+    uint32_t poll_interval = first.poll_interval;
+    size_t next = i + 1;
+    while (next < ranges.size() && this->can_merge_ranges_(first, end, *ranges[next])) {
+      end = ranges[next]->start_address + ranges[next]->register_count;
+      poll_interval = std::min(poll_interval, ranges[next]->poll_interval);
+      next++;
+    }
+
+    ModbusCommandItem command_item;
+    if (next == i + 1) {
+      command_item =
+          ModbusCommandItem::create_read_command(this, first.register_type, first.start_address, first.register_count);
     } else {
-      queue_command(ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
+      ESP_LOGV(TAG, "Merging %zu ranges into a read of 0x%X count %u", next - i, first.start_address,
+               end - first.start_address);
+      std::vector<std::pair<uint16_t, uint16_t>> parts;
+      for (size_t j = i; j < next; j++)
+        parts.emplace_back(ranges[j]->start_address, ranges[j]->register_count);
+      command_item = ModbusCommandItem::create_read_command(
+          this, first.register_type, first.start_address, end - first.start_address,
+          [this, parts](ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data) {
+            // pass each range its own part of the response
+            for (auto &part : parts) {
+              size_t begin = (part.first - start_address) * 2;
+              size_t size = part.second * 2;
+              if (begin + size > data.size()) {
+                ESP_LOGW(TAG, "Response too short for range 0x%X", part.first);
+                return;
+              }
+              this->on_register_data(register_type, part.first,
+                                     std::vector<uint8_t>(data.begin() + begin, data.begin() + begin + size));
+            }
+          });
     }
-    r.skip_updates_counter = r.skip_updates;  // reset counter to config value
-  } else {
-    r.skip_updates_counter--;
+    command_item.poll_interval = poll_interval;
+    if (poll_interval == 0 || !this->is_queued_(command_item))
+      queue_command(command_item);
+    i = next;
   }
 }
+
 //
 // Queue the modbus requests to be send.
 // Once we get a response to the command it is removed from the queue and the next command is send
@@ -181,10 +366,49 @@ void ModbusController::update() {
     ESP_LOGV(TAG, "Updating modbus component");
   }
 
+  this->due_ranges_.clear();
+  for (auto &r : this->register_ranges_) {
+    // ranges with their own poll interval are polled by loop()
+    if (r.poll_interval != 0)
+      continue;
+    ESP_LOGVV(TAG, "Range : %X Size: %x (%d) skip: %d", r.start_address, r.register_count, (int) r.register_type,
+              r.skip_updates_counter);
+    if (r.skip_updates_counter == 0) {
+      this->due_ranges_.push_back(&r);
+      r.skip_updates_counter = r.skip_updates;  // reset counter to config value
+    } else {
+      r.skip_updates_counter--;
+    }
+  }
+  this->queue_ranges_(this->due_ranges_);
+}
+
+void ModbusController::poll_scheduled_ranges_() {
+  const uint32_t now = millis();
+  if ((int32_t) (now - this->next_scheduled_poll_) < 0)
+    return;
+
+  // without scheduled ranges this just rechecks about once a minute
+  uint32_t next_poll_in = UINT16_MAX;
+  this->due_ranges_.clear();
   for (auto &r : this->register_ranges_) {
-    ESP_LOGVV(TAG, "Updating range 0x%X", r.start_address);
-    update_range_(r);
+    if (r.poll_interval == 0)
+      continue;
+    // don't flood the bus with timeouts, offline devices are polled at most once per update interval
+    uint32_t interval = r.poll_interval;
+    if (this->module_offline_)
+      interval = std::max(interval, this->get_update_interval());
+    uint32_t elapsed = now - r.last_poll;
+    if (elapsed >= interval) {
+      this->due_ranges_.push_back(&r);
+      r.last_poll = now;
+      elapsed = 0;
+    }
+    next_poll_in = std::min(next_poll_in, interval - elapsed);
   }
+  this->next_scheduled_poll_ = now + next_poll_in;
+  if (!this->due_ranges_.empty())
+    this->queue_ranges_(this->due_ranges_);
 }
 
 // walk through the sensors and determine the register ranges to read
@@ -213,6 +437,7 @@ size_t ModbusController::create_register_ranges_() {
       r.register_type = curr->register_type;
       r.sensors.insert(curr);
       r.skip_updates = curr->skip_updates;
+      r.poll_interval = curr->poll_interval;
       r.skip_updates_counter = 0;
       buffer_offset = curr->get_register_size();
 
@@ -220,8 +445,9 @@ size_t ModbusController::create_register_ranges_() {
     } else {
       // this is not the first register in range so it might be possible
       // to reuse the last register or extend the current range
+      // registers with different poll intervals are kept in separate ranges, the scheduler merges them when due
       if (!curr->force_new_range && r.register_type == curr->register_type &&
-          curr->register_type != ModbusRegisterType::CUSTOM) {
+          curr->register_type != ModbusRegisterType::CUSTOM && curr->poll_interval == r.poll_interval) {
         if (curr->start_address == (r.start_address + r.register_count - prev->register_count) &&
             curr->register_count == prev->register_count && curr->get_register_size() == prev->get_register_size()) {
           // this register can re-use the data from the previous register
@@ -269,6 +495,9 @@ size_t ModbusController::create_register_ranges_() {
           r.skip_updates = curr->skip_updates;
         }
       }
+      // same for the poll interval, zero means the range is polled by update()
+      if (curr->poll_interval != 0 && (r.poll_interval == 0 || curr->poll_interval < r.poll_interval))
+        r.poll_interval = curr->poll_interval;
 
       // add sensor to this range
       r.sensors.insert(curr);
@@ -297,6 +526,8 @@ size_t ModbusController::create_register_ranges_() {
 void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG, "ModbusController:");
   ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
+  ESP_LOGCONFIG(TAG, "  Max Register Gap: %u", this->max_register_gap_);
+  ESP_LOGCONFIG(TAG, "  Adaptive Throttle: %s", YESNO(this->adaptive_throttle_));
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : sensorset_) {
@@ -306,13 +537,16 @@ void ModbusController::dump_config() {
   }
   ESP_LOGCONFIG(TAG, "ranges");
   for (auto &it : register_ranges_) {
-    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d skip_updates=%d", static_cast<uint8_t>(it.register_type),
-                  it.start_address, it.register_count, it.skip_updates);
+    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d skip_updates=%d poll_interval=%" PRIu32,
+                  static_cast<uint8_t>(it.register_type), it.start_address, it.register_count, it.skip_updates,
+                  it.poll_interval);
   }
 #endif
 }
 
 void ModbusController::loop() {
+  this->poll_scheduled_ranges_();
+
   // Incoming data to process?
   if (!incoming_queue_.empty()) {
     auto &message = incoming_queue_.front();
@@ -501,10 +735,11 @@ ModbusCommandItem ModbusCommandItem::create_custom_command(
 
 bool ModbusCommandItem::send() {
   if (this->function_code != ModbusFunctionCode::CUSTOM) {
-    modbusdevice->send(uint8_t(this->function_code), this->register_address, this->register_count, this->payload.size(),
-                       this->payload.empty() ? nullptr : &this->payload[0]);
+    this->transaction_id =
+        modbusdevice->send(uint8_t(this->function_code), this->register_address, this->register_count,
+                           this->payload.size(), this->payload.empty() ? nullptr : &this->payload[0]);
   } else {
-    modbusdevice->send_raw(this->payload);
+    this->transaction_id = modbusdevice->send_raw(this->payload);
   }
   ESP_LOGV(TAG, "Command sent %d 0x%X %d", uint8_t(this->function_code), this->register_address, this->register_count);
   send_countdown--;
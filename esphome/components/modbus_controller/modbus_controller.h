@@ -239,6 +239,8 @@ class SensorItem {
   }
   // Override register size for modbus devices not using 1 register for one dword
   void set_register_size(uint8_t register_size) { response_bytes = register_size; }
+  // Poll this item on its own interval instead of on every update of the controller
+  void set_poll_interval(uint32_t poll_interval) { this->poll_interval = poll_interval; }
   ModbusRegisterType register_type;
   SensorValueType sensor_value_type;
   uint16_t start_address;
@@ -247,6 +249,7 @@ class SensorItem {
   uint8_t register_count;
   uint8_t response_bytes{0};
   uint16_t skip_updates;
+  uint32_t poll_interval{0};
   std::vector<uint8_t> custom_data{};
   bool force_new_range{false};
 };
@@ -291,12 +294,16 @@ struct RegisterRange {
   uint16_t skip_updates;          // the config value
   SensorSet sensors;              // all sensors of this range
   uint16_t skip_updates_counter;  // the running value
+  uint32_t poll_interval;         // ms, 0 if the range is polled by update()
+  uint32_t last_poll;             // when the range was last queued by the scheduler
 };
 
 class ModbusCommandItem {
  public:
   static const size_t MAX_PAYLOAD_BYTES = 240;
   static const uint8_t MAX_SEND_REPEATS = 5;
+  /// Maximum number of registers a single read command may request
+  static const uint16_t MAX_READ_REGISTERS = 125;
   ModbusController *modbusdevice;
   uint16_t register_address;
   uint16_t register_count;
@@ -309,6 +316,13 @@ class ModbusCommandItem {
   // wrong commands (esp. custom commands) can block the send queue
   // limit the number of repeats
   uint8_t send_countdown{MAX_SEND_REPEATS};
+  // poll interval of the ranges read by this command, 0 if it was not queued by the scheduler.
+  // Scheduled reads with a shorter interval are sent before the other reads in the queue.
+  uint32_t poll_interval{0};
+  // transaction id of the last send if the transport has them (Modbus TCP), 0 otherwise
+  uint16_t transaction_id{0};
+  // when the command was last sent
+  uint32_t sent_at{0};
   /// factory methods
   /** Create modbus read command
    *  Function code 02-04
@@ -422,6 +436,12 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_data(const std::vector<uint8_t> &data) override;
   /// called when a modbus error response was received
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
+  /// called by transports with transaction ids when the response to an in-flight command was received
+  void on_modbus_transaction_data(uint16_t transaction_id, const std::vector<uint8_t> &data) override;
+  /// called by transports with transaction ids when an in-flight command got an error response
+  void on_modbus_transaction_error(uint16_t transaction_id, uint8_t function_code, uint8_t exception_code) override;
+  /// called by transports with transaction ids when an in-flight command wasn't answered in time
+  void on_modbus_transaction_timeout(uint16_t transaction_id) override;
   /// default delegate called by process_modbus_data when a response has retrieved from the incoming queue
   void on_register_data(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data);
   /// default delegate called by process_modbus_data when a response for a write response has retrieved from the
@@ -432,6 +452,12 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
   /// called by esphome generated code to set the offline_skip_updates
   void set_offline_skip_updates(uint16_t offline_skip_updates) { this->offline_skip_updates_ = offline_skip_updates; }
+  /// called by esphome generated code to set how many unused registers may be read to merge two due ranges
+  void set_max_register_gap(uint16_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
+  /// called by esphome generated code to enable backing off when the device stops responding
+  void set_adaptive_throttle(bool adaptive_throttle) { this->adaptive_throttle_ = adaptive_throttle; }
+  /// get the smoothed time in ms between sending a command and receiving its response
+  uint32_t get_response_time() const { return this->response_time_; }
   /// get the number of queued modbus commands (should be mostly empty)
   size_t get_command_queue_length() { return command_queue_.size(); }
   /// get if the module is offline, didn't respond the last command
@@ -442,8 +468,20 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   size_t create_register_ranges_();
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
-  /// submit the read command for the address range to the send queue
-  void update_range_(RegisterRange &r);
+  /// submit the read commands for the due ranges to the send queue, merging ranges close to each other
+  void queue_ranges_(std::vector<RegisterRange *> &ranges);
+  /// whether next can be read by the same command as the ranges from first up to end
+  bool can_merge_ranges_(const RegisterRange &first, uint16_t end, const RegisterRange &next) const;
+  /// queue the ranges with their own poll interval which are due
+  void poll_scheduled_ranges_();
+  /// whether a command equal to command is already in the send queue or waiting for its response
+  bool is_queued_(const ModbusCommandItem &command) const;
+  /// update the response time and adaptive delay after a response or error to a command sent at sent_at was received
+  void on_response_received_(uint32_t sent_at);
+  /// clear the offline state after a response was received
+  void set_online_();
+  /// take the in-flight command with the given transaction id, nullptr if there is none
+  std::unique_ptr<ModbusCommandItem> take_in_flight_(uint16_t transaction_id);
   /// parse incoming modbus data
   void process_modbus_data_(const ModbusCommandItem *response);
   /// send the next modbus command from the send queue
@@ -454,18 +492,36 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   SensorSet sensorset_;
   /// Continuous range of modbus registers
   std::vector<RegisterRange> register_ranges_;
+  /// Ranges due for polling, kept to reuse the allocation
+  std::vector<RegisterRange *> due_ranges_;
+  /// when the next range with its own poll interval is due
+  uint32_t next_scheduled_poll_{0};
   /// Hold the pending requests to be sent
   std::list<std::unique_ptr<ModbusCommandItem>> command_queue_;
+  /// Commands sent through a transport with transaction ids that wait for their response
+  std::list<std::unique_ptr<ModbusCommandItem>> in_flight_;
   /// modbus response data waiting to get processed
   std::queue<std::unique_ptr<ModbusCommandItem>> incoming_queue_;
   /// when was the last send operation
-  uint32_t last_command_timestamp_;
+  uint32_t last_command_timestamp_{0};
   /// min time in ms between sending modbus commands
   uint16_t command_throttle_;
   /// if module didn't respond the last command
-  bool module_offline_;
+  bool module_offline_{false};
   /// how many updates to skip if module is offline
   uint16_t offline_skip_updates_;
+  /// how many unused registers may be read to merge two due ranges
+  uint16_t max_register_gap_{0};
+  /// back off when the device stops responding
+  bool adaptive_throttle_{false};
+  /// extra delay in ms after a response before sending the next command, grows on timeouts
+  uint32_t adaptive_delay_{0};
+  /// smoothed response time in ms
+  uint32_t response_time_{0};
+  /// when the last response or error was received
+  uint32_t last_response_timestamp_{0};
+  /// whether the last sent command was answered
+  bool response_received_{true};
 };
 
 /** Convert vector<uint8_t> response payload to float.
@@ -13,6 +13,7 @@ from .. import (
 from ..const import (
     CONF_FORCE_NEW_RANGE,
     CONF_MODBUS_CONTROLLER_ID,
+    CONF_POLL_INTERVAL,
     CONF_REGISTER_COUNT,
     CONF_SKIP_UPDATES,
     CONF_USE_WRITE_MULTIPLE,
@@ -75,6 +76,7 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_REGISTER_COUNT): cv.positive_int,
             cv.Optional(CONF_SKIP_UPDATES, default=0): cv.positive_int,
+            cv.Optional(CONF_POLL_INTERVAL): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_FORCE_NEW_RANGE, default=False): cv.boolean,
             cv.Required(CONF_OPTIONSMAP): ensure_option_map(),
             cv.Optional(CONF_USE_WRITE_MULTIPLE, default=False): cv.boolean,
@@ -113,6 +115,8 @@ async def to_code(config):
     cg.add(var.set_parent(parent))
     cg.add(var.set_use_write_mutiple(config[CONF_USE_WRITE_MULTIPLE]))
     cg.add(var.set_optimistic(config[CONF_OPTIMISTIC]))
+    if CONF_POLL_INTERVAL in config:
+        cg.add(var.set_poll_interval(config[CONF_POLL_INTERVAL]))
 
     if CONF_LAMBDA in config:
         template_ = await cg.process_lambda(
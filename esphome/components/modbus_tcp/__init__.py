@@ -0,0 +1,48 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import modbus
+from esphome.const import (
+    CONF_HOST,
+    CONF_ID,
+    CONF_PORT,
+    CONF_TIMEOUT,
+    PLATFORM_BK72XX,
+    PLATFORM_ESP32,
+    PLATFORM_HOST,
+    PLATFORM_RTL87XX,
+)
+
+AUTO_LOAD = ["modbus", "socket"]
+DEPENDENCIES = ["network"]
+MULTI_CONF = True
+
+modbus_tcp_ns = cg.esphome_ns.namespace("modbus_tcp")
+ModbusTCP = modbus_tcp_ns.class_("ModbusTCP", cg.Component, modbus.ModbusTransport)
+
+CONF_MAX_IN_FLIGHT = "max_in_flight"
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ModbusTCP),
+            cv.Required(CONF_HOST): cv.string_strict,
+            cv.Optional(CONF_PORT, default=502): cv.port,
+            cv.Optional(CONF_MAX_IN_FLIGHT, default=1): cv.int_range(min=1, max=16),
+            cv.Optional(
+                CONF_TIMEOUT, default="1s"
+            ): cv.positive_time_period_milliseconds,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    # The raw lwIP TCP socket implementation (ESP8266, RP2040) can't connect to a server
+    cv.only_on([PLATFORM_ESP32, PLATFORM_HOST, PLATFORM_BK72XX, PLATFORM_RTL87XX]),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add(var.set_host(str(config[CONF_HOST])))
+    cg.add(var.set_port(config[CONF_PORT]))
+    cg.add(var.set_max_in_flight(config[CONF_MAX_IN_FLIGHT]))
+    cg.add(var.set_timeout(config[CONF_TIMEOUT]))
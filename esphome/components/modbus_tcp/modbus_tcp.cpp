@@ -0,0 +1,327 @@
+#include "modbus_tcp.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+
+#ifdef USE_HOST
+#include <netdb.h>
+#endif
+
+namespace esphome {
+namespace modbus_tcp {
+
+static const char *const TAG = "modbus_tcp";
+
+// MBAP header: transaction id, protocol id (always 0) and length of the remaining frame, each 16 bits big endian.
+// The unit id (device address) following it is counted by the length and part of the frame as in RTU.
+static const size_t MBAP_HEADER_SIZE = 6;
+// Unit id and the longest PDU allowed by the specification
+static const uint16_t MAX_FRAME_LENGTH = 254;
+static const uint32_t RECONNECT_INTERVAL = 5000;
+static const uint32_t RESOLVE_TIMEOUT = 10000;
+
+void ModbusTCP::setup() { this->resolve_(); }
+
+void ModbusTCP::loop() {
+  const uint32_t now = millis();
+  switch (this->state_) {
+    case State::DISCONNECTED:
+      if (now - this->state_changed_ > RECONNECT_INTERVAL)
+        this->resolve_();
+      break;
+    case State::RESOLVING:
+      if (this->dns_resolve_error_ || (!this->dns_resolved_ && now - this->state_changed_ > RESOLVE_TIMEOUT)) {
+        ESP_LOGW(TAG, "Couldn't resolve IP address for '%s'", this->host_.c_str());
+        this->state_ = State::DISCONNECTED;
+        this->state_changed_ = now;
+      } else if (this->dns_resolved_) {
+        this->connect_();
+      }
+      break;
+    case State::CONNECTING: {
+      int err = 0;
+      socklen_t len = sizeof(err);
+      if (this->socket_->getsockopt(SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+        ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.c_str(), this->port_, err);
+        this->disconnect_();
+        break;
+      }
+      struct sockaddr_storage peer;
+      len = sizeof(peer);
+      if (this->socket_->getpeername(reinterpret_cast<struct sockaddr *>(&peer), &len) == 0) {
+        ESP_LOGI(TAG, "Connected to %s:%u", this->host_.c_str(), this->port_);
+        this->state_ = State::CONNECTED;
+        this->state_changed_ = now;
+      } else if (now - this->state_changed_ > this->timeout_) {
+        ESP_LOGW(TAG, "Connecting to %s:%u timed out", this->host_.c_str(), this->port_);
+        this->disconnect_();
+      }
+      break;
+    }
+    case State::CONNECTED:
+      this->read_responses_();
+      break;
+  }
+  this->check_timeouts_();
+}
+
+void ModbusTCP::resolve_() {
+  this->state_ = State::RESOLVING;
+  this->state_changed_ = millis();
+  this->dns_resolved_ = false;
+  this->dns_resolve_error_ = false;
+#ifdef USE_HOST
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *result;
+  if (getaddrinfo(this->host_.c_str(), nullptr, &hints, &result) != 0) {
+    this->dns_resolve_error_ = true;
+    return;
+  }
+  this->ip_ = reinterpret_cast<struct sockaddr_in *>(result->ai_addr)->sin_addr.s_addr;
+  freeaddrinfo(result);
+  this->dns_resolved_ = true;
+#else
+  ip_addr_t addr;
+  err_t err = dns_gethostbyname_addrtype(this->host_.c_str(), &addr, ModbusTCP::dns_found_callback, this,
+                                         LWIP_DNS_ADDRTYPE_IPV4);
+  if (err == ERR_OK) {
+    this->ip_ = ip4_addr_get_u32(ip_2_ip4(&addr));
+    this->dns_resolved_ = true;
+  } else if (err != ERR_INPROGRESS) {
+    this->dns_resolve_error_ = true;
+  }
+#endif
+}
+
+#ifndef USE_HOST
+void ModbusTCP::dns_found_callback(const char *name, const ip_addr_t *ipaddr, void *callback_arg) {
+  auto *a_this = (ModbusTCP *) callback_arg;
+  // A lookup that timed out may still complete
+  if (a_this->state_ != State::RESOLVING)
+    return;
+  if (ipaddr == nullptr) {
+    a_this->dns_resolve_error_ = true;
+  } else {
+    a_this->ip_ = ip4_addr_get_u32(ip_2_ip4(ipaddr));
+    a_this->dns_resolved_ = true;
+  }
+}
+#endif
+
+void ModbusTCP::connect_() {
+  this->socket_ = socket::socket(AF_INET, SOCK_STREAM, 0);
+  this->state_changed_ = millis();
+  if (this->socket_ == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    this->state_ = State::DISCONNECTED;
+    return;
+  }
+  int enable = 1;
+  this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+  this->socket_->setblocking(false);
+
+  struct sockaddr_in server;
+  memset(&server, 0, sizeof(server));
+  server.sin_family = AF_INET;
+  server.sin_addr.s_addr = this->ip_;
+  server.sin_port = htons(this->port_);
+  if (this->socket_->connect(reinterpret_cast<struct sockaddr *>(&server), sizeof(server)) != 0 &&
+      errno != EINPROGRESS) {
+    ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.c_str(), this->port_, errno);
+    this->disconnect_();
+    return;
+  }
+  this->state_ = State::CONNECTING;
+}
+
+void ModbusTCP::disconnect_() {
+  if (this->socket_ != nullptr) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+  this->rx_buffer_.clear();
+  this->state_ = State::DISCONNECTED;
+  this->state_changed_ = millis();
+}
+
+uint16_t ModbusTCP::send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                         uint8_t payload_len, const uint8_t *payload) {
+  this->tx_buffer_.assign(MBAP_HEADER_SIZE, 0);
+  if (!encode_request_(this->tx_buffer_, address, function_code, start_address, number_of_entities, payload_len,
+                       payload))
+    return 0;
+  return this->send_request_();
+}
+
+uint16_t ModbusTCP::send_raw(const std::vector<uint8_t> &payload) {
+  if (payload.empty())
+    return 0;
+  this->tx_buffer_.assign(MBAP_HEADER_SIZE, 0);
+  this->tx_buffer_.insert(this->tx_buffer_.end(), payload.begin(), payload.end());
+  return this->send_request_();
+}
+
+uint16_t ModbusTCP::send_request_() {
+  if (this->state_ != State::CONNECTED) {
+    ESP_LOGV(TAG, "Not connected, dropping request");
+    return 0;
+  }
+  uint16_t transaction_id = this->next_transaction_id_++;
+  if (this->next_transaction_id_ == 0)
+    this->next_transaction_id_ = 1;
+  const uint16_t length = this->tx_buffer_.size() - MBAP_HEADER_SIZE;
+  this->tx_buffer_[0] = transaction_id >> 8;
+  this->tx_buffer_[1] = transaction_id >> 0;
+  this->tx_buffer_[4] = length >> 8;
+  this->tx_buffer_[5] = length >> 0;
+
+  ssize_t written = this->socket_->write(this->tx_buffer_.data(), this->tx_buffer_.size());
+  if (written != (ssize_t) this->tx_buffer_.size()) {
+    if (written < 0 && (errno == EWOULDBLOCK || errno == EAGAIN)) {
+      ESP_LOGV(TAG, "Send buffer full, dropping request");
+    } else {
+      // A partially written frame can't be recovered from
+      ESP_LOGW(TAG, "Sending request failed: errno %d", errno);
+      this->disconnect_();
+    }
+    return 0;
+  }
+  this->in_flight_.push_back(Transaction{transaction_id, this->tx_buffer_[MBAP_HEADER_SIZE], millis()});
+  ESP_LOGV(TAG, "Modbus write: %s", format_hex_pretty(this->tx_buffer_).c_str());
+  return transaction_id;
+}
+
+bool ModbusTCP::is_busy() const {
+  return this->state_ != State::CONNECTED || this->in_flight_.size() >= this->max_in_flight_;
+}
+
+void ModbusTCP::read_responses_() {
+  uint8_t buf[128];
+  while (true) {
+    ssize_t read = this->socket_->read(buf, sizeof(buf));
+    if (read > 0) {
+      this->rx_buffer_.insert(this->rx_buffer_.end(), buf, buf + read);
+      continue;
+    }
+    if (read == 0) {
+      ESP_LOGW(TAG, "Connection closed by server");
+      this->disconnect_();
+      return;
+    }
+    if (errno == EWOULDBLOCK || errno == EAGAIN)
+      break;
+    ESP_LOGW(TAG, "Reading failed: errno %d", errno);
+    this->disconnect_();
+    return;
+  }
+
+  while (this->rx_buffer_.size() >= MBAP_HEADER_SIZE) {
+    const uint8_t *raw = this->rx_buffer_.data();
+    uint16_t transaction_id = encode_uint16(raw[0], raw[1]);
+    uint16_t protocol_id = encode_uint16(raw[2], raw[3]);
+    uint16_t length = encode_uint16(raw[4], raw[5]);
+    if (protocol_id != 0 || length < 3 || length > MAX_FRAME_LENGTH) {
+      // Framing is lost, there is no way to find the start of the next response
+      ESP_LOGW(TAG, "Invalid MBAP header %s", format_hex_pretty(raw, MBAP_HEADER_SIZE).c_str());
+      this->disconnect_();
+      return;
+    }
+    if (this->rx_buffer_.size() < MBAP_HEADER_SIZE + length)
+      break;
+    // Take the frame out of the buffer first, the devices might send the next request (and fail) from the callbacks
+    std::vector<uint8_t> frame(this->rx_buffer_.begin() + MBAP_HEADER_SIZE,
+                               this->rx_buffer_.begin() + MBAP_HEADER_SIZE + length);
+    this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + MBAP_HEADER_SIZE + length);
+    this->handle_response_(transaction_id, frame);
+  }
+}
+
+void ModbusTCP::handle_response_(uint16_t transaction_id, const std::vector<uint8_t> &frame) {
+  ESP_LOGV(TAG, "Modbus received transaction %u: %s", transaction_id, format_hex_pretty(frame).c_str());
+  auto it = std::find_if(this->in_flight_.begin(), this->in_flight_.end(),
+                         [transaction_id](const Transaction &t) { return t.id == transaction_id; });
+  if (it == this->in_flight_.end()) {
+    ESP_LOGD(TAG, "Ignoring response to unknown transaction %u", transaction_id);
+    return;
+  }
+  this->in_flight_.erase(it);
+
+  uint8_t address = frame[0];
+  uint8_t function_code = frame[1];
+  size_t data_offset = 3;
+  size_t data_len = frame[2];
+  if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
+    // User-defined function, the length of the frame is all there is to go by
+    data_offset = 1;
+    data_len = frame.size() - 1;
+  } else if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
+    // the response for write command mirrors the request and data starts at offset 2
+    data_offset = 2;
+    data_len = 4;
+  }
+  bool error = (function_code & 0x80) == 0x80;
+  if (!error && data_offset + data_len > frame.size()) {
+    ESP_LOGW(TAG, "Truncated response to transaction %u", transaction_id);
+    return;
+  }
+
+  std::vector<uint8_t> data;
+  if (!error)
+    data.assign(frame.begin() + data_offset, frame.begin() + data_offset + data_len);
+  bool found = false;
+  for (auto *device : this->devices_) {
+    if (device->get_address() != address)
+      continue;
+    if (error) {
+      ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, frame[2]);
+      device->on_modbus_transaction_error(transaction_id, function_code & 0x7F, frame[2]);
+    } else {
+      device->on_modbus_transaction_data(transaction_id, data);
+    }
+    found = true;
+  }
+  if (!found) {
+    ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X! ", address);
+  }
+}
+
+void ModbusTCP::check_timeouts_() {
+  if (this->in_flight_.empty())
+    return;
+  const uint32_t now = millis();
+  const bool connected = this->state_ == State::CONNECTED;
+  std::vector<Transaction> expired;
+  for (auto it = this->in_flight_.begin(); it != this->in_flight_.end();) {
+    if (!connected || now - it->sent_at > this->timeout_) {
+      expired.push_back(*it);
+      it = this->in_flight_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (auto &transaction : expired) {
+    ESP_LOGD(TAG, "Transaction %u to 0x%02X timed out", transaction.id, transaction.address);
+    for (auto *device : this->devices_) {
+      if (device->get_address() == transaction.address)
+        device->on_modbus_transaction_timeout(transaction.id);
+    }
+  }
+}
+
+void ModbusTCP::dump_config() {
+  ESP_LOGCONFIG(TAG, "Modbus TCP:");
+  ESP_LOGCONFIG(TAG, "  Server: %s:%u", this->host_.c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Max In Flight: %u", this->max_in_flight_);
+  ESP_LOGCONFIG(TAG, "  Timeout: %" PRIu32 " ms", this->timeout_);
+}
+
+}  // namespace modbus_tcp
+}  // namespace esphome
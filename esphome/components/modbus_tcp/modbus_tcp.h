@@ -0,0 +1,93 @@
+#pragma once
+
+#include "esphome/components/modbus/modbus.h"
+#include "esphome/components/socket/socket.h"
+#include "esphome/core/component.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef USE_HOST
+#include "lwip/dns.h"
+#endif
+
+namespace esphome {
+namespace modbus_tcp {
+
+/** Modbus TCP client transport.
+ *
+ * Sends the requests of the registered modbus devices to a Modbus TCP server or gateway. Every request gets a
+ * transaction id in its MBAP header, so up to max_in_flight requests can wait for their responses at the same time
+ * and responses are matched to their requests even if they arrive out of order. The host may be a name, it is
+ * resolved without blocking before every connection attempt.
+ */
+class ModbusTCP : public Component, public modbus::ModbusTransport {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+  uint16_t send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                uint8_t payload_len = 0, const uint8_t *payload = nullptr) override;
+  uint16_t send_raw(const std::vector<uint8_t> &payload) override;
+  bool is_busy() const override;
+
+  void set_host(const std::string &host) { this->host_ = host; }
+  void set_port(uint16_t port) { this->port_ = port; }
+  void set_max_in_flight(uint8_t max_in_flight) { this->max_in_flight_ = max_in_flight; }
+  void set_timeout(uint32_t timeout) { this->timeout_ = timeout; }
+
+  bool is_connected() const { return this->state_ == State::CONNECTED; }
+
+ protected:
+  enum class State : uint8_t {
+    DISCONNECTED,
+    RESOLVING,
+    CONNECTING,
+    CONNECTED,
+  };
+
+  struct Transaction {
+    uint16_t id;
+    uint8_t address;
+    uint32_t sent_at;
+  };
+
+  void resolve_();
+  void connect_();
+  /// Close the connection, requests waiting for their response are reported as timed out in the next loop().
+  void disconnect_();
+  /// Fill in the MBAP header of the request in tx_buffer_ and send it.
+  uint16_t send_request_();
+  void read_responses_();
+  /// Handle a response frame (unit id and PDU).
+  void handle_response_(uint16_t transaction_id, const std::vector<uint8_t> &frame);
+  /// Report requests whose response is overdue (or that lost their connection) to their devices.
+  void check_timeouts_();
+#ifndef USE_HOST
+  static void dns_found_callback(const char *name, const ip_addr_t *ipaddr, void *callback_arg);
+#endif
+
+  std::string host_;
+  uint16_t port_{502};
+  uint8_t max_in_flight_{1};
+  uint32_t timeout_{1000};
+
+  /// Resolved IPv4 address of the server, in network byte order
+  uint32_t ip_{0};
+  bool dns_resolved_{false};
+  bool dns_resolve_error_{false};
+
+  std::unique_ptr<socket::Socket> socket_;
+  State state_{State::DISCONNECTED};
+  uint32_t state_changed_{0};
+  uint16_t next_transaction_id_{1};
+  std::vector<Transaction> in_flight_;
+  std::vector<uint8_t> rx_buffer_;
+  std::vector<uint8_t> tx_buffer_;
+};
+
+}  // namespace modbus_tcp
+}  // namespace esphome
@@ -58,6 +58,7 @@ AUTO_LOAD = ["json"]
 
 CONF_IDF_SEND_ASYNC = "idf_send_async"
 CONF_SKIP_CERT_CN_CHECK = "skip_cert_cn_check"
+CONF_PUBLISH_BATCH_INTERVAL = "publish_batch_interval"
 
 
 def validate_message_just_topic(value):
@@ -244,6 +245,9 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_REBOOT_TIMEOUT, default="15min"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_PUBLISH_BATCH_INTERVAL, default="0ms"
+            ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_ON_CONNECT): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(MQTTConnectTrigger),
@@ -381,6 +385,7 @@ async def to_code(config):
     cg.add(var.set_keep_alive(config[CONF_KEEPALIVE]))
 
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    cg.add(var.set_publish_batch_interval(config[CONF_PUBLISH_BATCH_INTERVAL]))
 
     # esp-idf only
     if CONF_CERTIFICATE_AUTHORITY in config:
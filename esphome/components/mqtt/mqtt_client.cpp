@@ -26,6 +26,9 @@ namespace esphome {
 namespace mqtt {
 
 static const char *const TAG = "mqtt";
+// Topics and payloads held back by the publish batching at most, a discovery burst must not run an ESP8266 out of
+// memory. Messages that don't fit are sent right away.
+static const size_t MAX_PUBLISH_QUEUE_BYTES = 4096;
 
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
@@ -151,6 +154,9 @@ void MQTTClientComponent::dump_config() {
   if (!this->availability_.topic.empty()) {
     ESP_LOGCONFIG(TAG, "  Availability: '%s'", this->availability_.topic.c_str());
   }
+  if (this->publish_batch_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Publish Batch Interval: %" PRIu32 "ms", this->publish_batch_interval_);
+  }
 }
 bool MQTTClientComponent::can_proceed() { return network::is_disabled() || this->is_connected(); }
 
@@ -159,6 +165,9 @@ void MQTTClientComponent::start_dnslookup_() {
     subscription.subscribed = false;
     subscription.resubscribe_timeout = 0;
   }
+  // Components resend their state after reconnecting
+  this->publish_queue_.clear();
+  this->publish_queue_bytes_ = 0;
 
   this->status_set_warning();
   this->dns_resolve_error_ = false;
@@ -354,6 +363,9 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+
+        if (!this->publish_queue_.empty() && now - this->last_publish_flush_ >= this->publish_batch_interval_)
+          this->flush_publish_queue_();
       }
       break;
   }
@@ -453,37 +465,94 @@ bool MQTTClientComponent::publish(const std::string &topic, const std::string &p
   return this->publish(topic, payload.data(), payload.size(), qos, retain);
 }
 
-bool MQTTClientComponent::publish(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos,
-                                  bool retain) {
-  return publish({.topic = topic, .payload = payload, .qos = qos, .retain = retain});
+bool MQTTClientComponent::publish(const MQTTMessage &message) {
+  return this->publish(message.topic, message.payload.data(), message.payload.size(), message.qos, message.retain);
 }
 
-bool MQTTClientComponent::publish(const MQTTMessage &message) {
+bool MQTTClientComponent::publish(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos,
+                                  bool retain) {
   if (!this->is_connected()) {
     // critical components will re-transmit their messages
     return false;
   }
-  bool logging_topic = this->log_message_.topic == message.topic;
-  bool ret = this->mqtt_backend_.publish(message);
+  bool logging_topic = this->log_message_.topic == topic;
+  if (this->publish_batch_interval_ != 0 && !logging_topic) {
+    if (retain)
+      return this->queue_publish_(topic, payload, payload_length, qos);
+    // Don't let a direct message overtake a queued one for the same topic
+    for (auto &queued : this->publish_queue_) {
+      if (queued.message.topic == topic) {
+        this->flush_publish_queue_();
+        break;
+      }
+    }
+  }
+  return this->publish_now_(topic, payload, payload_length, qos, retain, logging_topic);
+}
+
+bool MQTTClientComponent::publish_now_(const std::string &topic, const char *payload, size_t payload_length,
+                                       uint8_t qos, bool retain, bool logging_topic) {
+  bool ret = this->mqtt_backend_.publish(topic.c_str(), payload, payload_length, qos, retain);
   delay(0);
   if (!ret && !logging_topic && this->is_connected()) {
     delay(0);
-    ret = this->mqtt_backend_.publish(message);
+    ret = this->mqtt_backend_.publish(topic.c_str(), payload, payload_length, qos, retain);
     delay(0);
   }
 
   if (!logging_topic) {
     if (ret) {
-      ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d)", message.topic.c_str(), message.payload.c_str(),
-               message.retain);
+      ESP_LOGV(TAG, "Publish(topic='%s' payload='%.*s' retain=%d)", topic.c_str(), (int) payload_length, payload,
+               retain);
     } else {
-      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", message.topic.c_str(),
-               message.payload.length());
+      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", topic.c_str(), payload_length);
       this->status_momentary_warning("publish", 1000);
     }
   }
   return ret != 0;
 }
+
+bool MQTTClientComponent::queue_publish_(const std::string &topic, const char *payload, size_t payload_length,
+                                         uint8_t qos) {
+  uint32_t topic_hash = fnv1_hash(topic);
+  for (auto &queued : this->publish_queue_) {
+    if (queued.topic_hash == topic_hash && queued.message.topic == topic) {
+      // Only the latest retained state matters, reuse the queued message's buffer for it
+      this->publish_queue_bytes_ = this->publish_queue_bytes_ - queued.message.payload.size() + payload_length;
+      queued.message.payload.assign(payload, payload_length);
+      queued.message.qos = qos;
+      return true;
+    }
+  }
+  size_t size = topic.size() + payload_length;
+  if (this->publish_queue_bytes_ + size > MAX_PUBLISH_QUEUE_BYTES) {
+    this->flush_publish_queue_();
+    if (!this->publish_queue_.empty() || size > MAX_PUBLISH_QUEUE_BYTES) {
+      ESP_LOGVV(TAG, "Publish queue is full, sending '%s' right away", topic.c_str());
+      return this->publish_now_(topic, payload, payload_length, qos, true, false);
+    }
+  }
+  this->publish_queue_.push_back(QueuedMessage{
+      .topic_hash = topic_hash,
+      .message = {.topic = topic, .payload = std::string(payload, payload_length), .qos = qos, .retain = true},
+  });
+  this->publish_queue_bytes_ += size;
+  return true;
+}
+
+void MQTTClientComponent::flush_publish_queue_() {
+  this->last_publish_flush_ = millis();
+  size_t sent = 0;
+  for (auto &queued : this->publish_queue_) {
+    const MQTTMessage &message = queued.message;
+    if (!this->publish_now_(message.topic, message.payload.data(), message.payload.size(), message.qos, true, false))
+      break;
+    this->publish_queue_bytes_ -= message.topic.size() + message.payload.size();
+    sent++;
+  }
+  ESP_LOGVV(TAG, "Flushed %zu of %zu queued messages", sent, this->publish_queue_.size());
+  this->publish_queue_.erase(this->publish_queue_.begin(), this->publish_queue_.begin() + sent);
+}
 bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
                                        bool retain) {
   std::string message = json::build_json(f);
@@ -627,6 +696,10 @@ void MQTTClientComponent::disable_discovery() {
   };
 }
 void MQTTClientComponent::on_shutdown() {
+  if (this->is_connected())
+    this->flush_publish_queue_();
+  // Nothing would flush messages queued from now on
+  this->publish_batch_interval_ = 0;
   if (!this->shutdown_message_.topic.empty()) {
     yield();
     this->publish(this->shutdown_message_);
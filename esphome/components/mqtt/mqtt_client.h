@@ -113,6 +113,14 @@ class MQTTClientComponent : public Component {
   /// Set the keep alive time in seconds, every 0.7*keep_alive a ping will be sent.
   void set_keep_alive(uint16_t keep_alive_s);
 
+  /** Set the interval in milliseconds in which retained messages are published in batches, 0 to disable batching.
+   *
+   * Retained messages are queued until the next flush, a newer message for a queued topic replaces the queued one.
+   */
+  void set_publish_batch_interval(uint32_t publish_batch_interval) {
+    this->publish_batch_interval_ = publish_batch_interval;
+  }
+
   /** Set the Home Assistant discovery info
    *
    * See <a href="https://www.home-assistant.io/docs/mqtt/discovery/">MQTT Discovery</a>.
@@ -270,6 +278,15 @@ class MQTTClientComponent : public Component {
   /// Re-calculate the availability property.
   void recalculate_availability_();
 
+  /// Hand a message to the backend right away, retrying once if that fails.
+  bool publish_now_(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos, bool retain,
+                    bool logging_topic);
+  /// Queue a retained message until the next flush, replacing a queued message for the same topic. When the queue is
+  /// full, the message is sent right away instead and the result of that is returned.
+  bool queue_publish_(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos);
+  /// Publish queued messages in order, stopping at the first one the backend doesn't accept.
+  void flush_publish_queue_();
+
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
@@ -300,6 +317,15 @@ class MQTTClientComponent : public Component {
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  struct QueuedMessage {
+    uint32_t topic_hash;
+    MQTTMessage message;
+  };
+  std::vector<QueuedMessage> publish_queue_;
+  /// Size of the topics and payloads in publish_queue_
+  size_t publish_queue_bytes_{0};
+  uint32_t publish_batch_interval_{0};
+  uint32_t last_publish_flush_{0};
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
@@ -28,15 +28,16 @@ struct SendDiscoveryConfig {
     ESP_LOGCONFIG(TAG, "  Command Topic: '%s'", this->get_command_topic_().c_str()); \
   }
 
+// The default topic is stored in the custom topic on first use, so that it's only built once.
 #define MQTT_COMPONENT_CUSTOM_TOPIC_(name, type) \
  protected: \
-  std::string custom_##name##_##type##_topic_{}; \
+  mutable std::string custom_##name##_##type##_topic_{}; \
 \
  public: \
   void set_custom_##name##_##type##_topic(const std::string &topic) { this->custom_##name##_##type##_topic_ = topic; } \
-  std::string get_##name##_##type##_topic() const { \
+  const std::string &get_##name##_##type##_topic() const { \
     if (this->custom_##name##_##type##_topic_.empty()) \
-      return this->get_default_topic_for_(#name "/" #type); \
+      this->custom_##name##_##type##_topic_ = this->get_default_topic_for_(#name "/" #type); \
     return this->custom_##name##_##type##_topic_; \
   }
 
@@ -173,11 +174,11 @@ class MQTTComponent : public Component {
   /// Get whether the underlying Entity is disabled by default
   virtual bool is_disabled_by_default() const;
 
-  /// Get the MQTT topic that new states will be shared to.
-  std::string get_state_topic_() const;
+  /// Get the MQTT topic that new states will be shared to. Built on first use and cached afterwards.
+  const std::string &get_state_topic_() const;
 
-  /// Get the MQTT topic for listening to commands.
-  std::string get_command_topic_() const;
+  /// Get the MQTT topic for listening to commands. Built on first use and cached afterwards.
+  const std::string &get_command_topic_() const;
 
   bool is_connected_() const;
 
@@ -192,6 +193,10 @@ class MQTTComponent : public Component {
   StringRef custom_state_topic_{};
   StringRef custom_command_topic_{};
 
+  /// Fully-formed state/command topics, so that publishing doesn't rebuild them every time.
+  mutable std::string state_topic_{};
+  mutable std::string command_topic_{};
+
   std::unique_ptr<Availability> availability_;
 
   bool has_custom_state_topic_{false};
@@ -304,11 +304,11 @@ bool Nextion::remove_from_q_(bool report_empty) {
 }
 
 void Nextion::process_serial_() {
-  uint8_t d;
+  uint8_t buf[uart::READ_CHUNK_SIZE];
+  size_t len;
 
-  while (this->available()) {
-    read_byte(&d);
-    this->command_data_ += d;
+  while ((len = this->read_array_available(buf, sizeof(buf))) > 0) {
+    this->command_data_.append(reinterpret_cast<const char *>(buf), len);
   }
 }
 // nextion.tech/instruction-set/
@@ -0,0 +1,448 @@
+#include "gzip_decoder.h"
+
+#if defined(USE_ESP32) || defined(USE_HOST)
+
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace ota {
+
+static const uint8_t GZIP_FLAG_HCRC = 0x02;
+static const uint8_t GZIP_FLAG_EXTRA = 0x04;
+static const uint8_t GZIP_FLAG_NAME = 0x08;
+static const uint8_t GZIP_FLAG_COMMENT = 0x10;
+
+// Base values and extra bits of the length symbols 257..285 and the distance symbols 0..29
+static const uint16_t LENGTH_BASE[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                         31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                         2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t DISTANCE_BASE[30] = {1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,
+                                           129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193,
+                                           12289, 16385, 24577};
+static const uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                           6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// Order the code lengths of the code length code are stored in
+static const uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+static uint32_t crc32_table[256];  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc = crc32_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+GzipDecoder::~GzipDecoder() {
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  if (this->window_ != nullptr)
+    allocator.deallocate(this->window_, WINDOW_SIZE);
+}
+
+bool GzipDecoder::init(OutputCallback &&output) {
+  if (crc32_table[1] == 0) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t crc = i;
+      for (uint8_t bit = 0; bit < 8; bit++)
+        crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+      crc32_table[i] = crc;
+    }
+  }
+
+  if (this->window_ == nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    this->window_ = allocator.allocate(WINDOW_SIZE);
+    if (this->window_ == nullptr)
+      return false;
+  }
+  this->output_ = std::move(output);
+  this->window_pos_ = 0;
+  this->window_flushed_ = 0;
+  this->output_failed_ = false;
+  this->output_size_ = 0;
+  this->crc_ = 0;
+  this->bits_ = 0;
+  this->bit_count_ = 0;
+  this->state_ = STATE_HEADER;
+  return true;
+}
+
+GzipDecoder::Result GzipDecoder::feed(const uint8_t *data, size_t len) {
+  if (this->state_ == STATE_ERROR)
+    return GZIP_ERROR;
+  this->in_ = data;
+  this->in_end_ = data + len;
+  Result result = this->decode_();
+  // Pass on what was decompressed from this chunk
+  if (result != GZIP_ERROR && this->state_ != STATE_DONE && !this->flush_())
+    result = this->fail_();
+  return result;
+}
+
+void GzipDecoder::fill_() {
+  while (this->bit_count_ <= 56 && this->in_ != this->in_end_) {
+    this->bits_ |= uint64_t(*this->in_++) << this->bit_count_;
+    this->bit_count_ += 8;
+  }
+}
+
+bool GzipDecoder::flush_() {
+  if (this->window_pos_ != this->window_flushed_) {
+    const uint8_t *data = this->window_ + this->window_flushed_;
+    size_t len = this->window_pos_ - this->window_flushed_;
+    this->crc_ = crc32_update(this->crc_, data, len);
+    this->output_size_ += len;
+    if (!this->output_failed_ && !this->output_(data, len))
+      this->output_failed_ = true;
+  }
+  if (this->window_pos_ == WINDOW_SIZE)
+    this->window_pos_ = 0;
+  this->window_flushed_ = this->window_pos_;
+  return !this->output_failed_;
+}
+
+GzipDecoder::Result GzipDecoder::fail_() {
+  this->state_ = STATE_ERROR;
+  return GZIP_ERROR;
+}
+
+int GzipDecoder::decode_symbol_(const Huffman &huffman, uint8_t *length) const {
+  // Canonical codes are stored starting with their most significant bit
+  int code = 0;
+  int first = 0;
+  int index = 0;
+  for (uint8_t len = 1; len <= MAX_BITS; len++) {
+    if (len > this->bit_count_)
+      return -1;
+    code |= (this->bits_ >> (len - 1)) & 1;
+    int count = huffman.count[len];
+    if (code - count < first) {
+      *length = len;
+      return huffman.symbol[index + (code - first)];
+    }
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  return -2;
+}
+
+bool GzipDecoder::build_huffman_(Huffman &huffman, const uint8_t *lengths, uint16_t count) {
+  memset(huffman.count, 0, sizeof(huffman.count));
+  for (uint16_t symbol = 0; symbol < count; symbol++)
+    huffman.count[lengths[symbol]]++;
+  huffman.count[0] = 0;
+
+  int left = 1;
+  for (uint8_t len = 1; len <= MAX_BITS; len++) {
+    left = (left << 1) - huffman.count[len];
+    if (left < 0)
+      return false;
+  }
+
+  uint16_t offsets[MAX_BITS + 1];
+  offsets[1] = 0;
+  for (uint8_t len = 1; len < MAX_BITS; len++)
+    offsets[len + 1] = offsets[len] + huffman.count[len];
+  for (uint16_t symbol = 0; symbol < count; symbol++) {
+    if (lengths[symbol] != 0)
+      huffman.symbol[offsets[lengths[symbol]]++] = symbol;
+  }
+  return true;
+}
+
+GzipDecoder::Result GzipDecoder::decode_() {
+  while (true) {
+    this->fill_();
+    switch (this->state_) {
+      case STATE_HEADER:
+        // ID1, ID2, CM and FLG
+        if (this->bit_count_ < 32)
+          return GZIP_NEED_INPUT;
+        if (this->peek_(24) != 0x088B1F)
+          return this->fail_();
+        this->flags_ = this->peek_(32) >> 24;
+        this->drop_(32);
+        this->state_ = STATE_HEADER_REST;
+        break;
+
+      case STATE_HEADER_REST:
+        // MTIME, XFL and OS
+        if (this->bit_count_ < 48)
+          return GZIP_NEED_INPUT;
+        this->drop_(48);
+        this->state_ = STATE_HEADER_EXTRA_LENGTH;
+        break;
+
+      case STATE_HEADER_EXTRA_LENGTH:
+        if ((this->flags_ & GZIP_FLAG_EXTRA) != 0) {
+          if (this->bit_count_ < 16)
+            return GZIP_NEED_INPUT;
+          this->remaining_ = this->peek_(16);
+          this->drop_(16);
+        } else {
+          this->remaining_ = 0;
+        }
+        this->state_ = STATE_HEADER_EXTRA;
+        break;
+
+      case STATE_HEADER_EXTRA:
+        while (this->remaining_ > 0 && this->need_(8)) {
+          this->drop_(8);
+          this->remaining_--;
+        }
+        if (this->remaining_ > 0)
+          return GZIP_NEED_INPUT;
+        this->state_ = STATE_HEADER_NAME;
+        break;
+
+      case STATE_HEADER_NAME:
+      case STATE_HEADER_COMMENT: {
+        // Zero terminated strings
+        uint8_t flag = this->state_ == STATE_HEADER_NAME ? GZIP_FLAG_NAME : GZIP_FLAG_COMMENT;
+        bool terminated = (this->flags_ & flag) == 0;
+        while (!terminated && this->need_(8)) {
+          terminated = this->peek_(8) == 0;
+          this->drop_(8);
+        }
+        if (!terminated)
+          return GZIP_NEED_INPUT;
+        this->state_ = this->state_ == STATE_HEADER_NAME ? STATE_HEADER_COMMENT : STATE_HEADER_CRC;
+        break;
+      }
+
+      case STATE_HEADER_CRC:
+        if ((this->flags_ & GZIP_FLAG_HCRC) != 0) {
+          if (this->bit_count_ < 16)
+            return GZIP_NEED_INPUT;
+          this->drop_(16);
+        }
+        this->state_ = STATE_BLOCK_HEADER;
+        break;
+
+      case STATE_BLOCK_HEADER: {
+        if (this->bit_count_ < 3)
+          return GZIP_NEED_INPUT;
+        this->final_block_ = this->peek_(1) != 0;
+        uint8_t type = this->peek_(3) >> 1;
+        this->drop_(3);
+        if (type == 0) {
+          // Stored blocks start at a byte boundary
+          this->drop_(this->bit_count_ % 8);
+          this->state_ = STATE_STORED_HEADER;
+        } else if (type == 1) {
+          for (uint16_t symbol = 0; symbol < 288; symbol++)
+            this->lengths_[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+          for (uint16_t symbol = 0; symbol < 30; symbol++)
+            this->lengths_[288 + symbol] = 5;
+          build_huffman_(this->lengths_code_, this->lengths_, 288);
+          build_huffman_(this->distances_code_, this->lengths_ + 288, 30);
+          this->state_ = STATE_CODES;
+        } else if (type == 2) {
+          this->state_ = STATE_TABLE_SIZES;
+        } else {
+          return this->fail_();
+        }
+        break;
+      }
+
+      case STATE_STORED_HEADER: {
+        // LEN and its one's complement NLEN
+        if (this->bit_count_ < 32)
+          return GZIP_NEED_INPUT;
+        uint16_t len = this->peek_(16);
+        uint16_t nlen = this->peek_(32) >> 16;
+        this->drop_(32);
+        if (len != static_cast<uint16_t>(~nlen))
+          return this->fail_();
+        this->remaining_ = len;
+        this->state_ = STATE_STORED;
+        break;
+      }
+
+      case STATE_STORED:
+        while (this->remaining_ > 0 && this->bit_count_ >= 8) {
+          this->put_(this->peek_(8));
+          this->drop_(8);
+          this->remaining_--;
+        }
+        // The bit buffer is empty now, copy the rest straight from the input
+        while (this->remaining_ > 0 && this->in_ != this->in_end_) {
+          size_t len = std::min<size_t>({this->remaining_, size_t(this->in_end_ - this->in_),
+                                         size_t(WINDOW_SIZE - this->window_pos_)});
+          memcpy(this->window_ + this->window_pos_, this->in_, len);
+          this->in_ += len;
+          this->window_pos_ += len;
+          this->remaining_ -= len;
+          if (this->window_pos_ == WINDOW_SIZE)
+            this->flush_();
+        }
+        if (this->remaining_ > 0)
+          return GZIP_NEED_INPUT;
+        this->state_ = this->final_block_ ? STATE_TRAILER : STATE_BLOCK_HEADER;
+        break;
+
+      case STATE_TABLE_SIZES:
+        if (this->bit_count_ < 14)
+          return GZIP_NEED_INPUT;
+        this->num_lengths_ = this->peek_(5) + 257;
+        this->num_distances_ = (this->peek_(10) >> 5) + 1;
+        this->remaining_ = (this->peek_(14) >> 10) + 4;
+        this->drop_(14);
+        if (this->num_lengths_ > 286 || this->num_distances_ > 30)
+          return this->fail_();
+        memset(this->lengths_, 0, 19);
+        this->index_ = 0;
+        this->state_ = STATE_CODE_LENGTH_LENGTHS;
+        break;
+
+      case STATE_CODE_LENGTH_LENGTHS:
+        while (this->index_ < this->remaining_ && this->need_(3)) {
+          this->lengths_[CODE_LENGTH_ORDER[this->index_++]] = this->peek_(3);
+          this->drop_(3);
+        }
+        if (this->index_ < this->remaining_)
+          return GZIP_NEED_INPUT;
+        // The code length code is kept in the distances code until the actual codes are built
+        if (!build_huffman_(this->distances_code_, this->lengths_, 19))
+          return this->fail_();
+        this->index_ = 0;
+        this->state_ = STATE_CODE_LENGTHS;
+        break;
+
+      case STATE_CODE_LENGTHS: {
+        uint16_t total = this->num_lengths_ + this->num_distances_;
+        while (this->index_ < total) {
+          // A symbol and its extra bits take at most 14 bits
+          this->need_(14);
+          uint8_t len;
+          int symbol = this->decode_symbol_(this->distances_code_, &len);
+          if (symbol == -1)
+            return GZIP_NEED_INPUT;
+          if (symbol < 0)
+            return this->fail_();
+          if (symbol < 16) {
+            this->drop_(len);
+            this->lengths_[this->index_++] = symbol;
+            continue;
+          }
+          // Repeat the previous length or zeros
+          static const uint8_t REPEAT_EXTRA[3] = {2, 3, 7};
+          static const uint8_t REPEAT_BASE[3] = {3, 3, 11};
+          uint8_t extra = REPEAT_EXTRA[symbol - 16];
+          if (len + extra > this->bit_count_)
+            return GZIP_NEED_INPUT;
+          uint8_t repeat = REPEAT_BASE[symbol - 16] + ((this->bits_ >> len) & ((1 << extra) - 1));
+          this->drop_(len + extra);
+          uint8_t value = 0;
+          if (symbol == 16) {
+            if (this->index_ == 0)
+              return this->fail_();
+            value = this->lengths_[this->index_ - 1];
+          }
+          if (this->index_ + repeat > total)
+            return this->fail_();
+          while (repeat-- > 0)
+            this->lengths_[this->index_++] = value;
+        }
+        // The end of block code has to be present
+        if (this->lengths_[256] == 0)
+          return this->fail_();
+        if (!build_huffman_(this->lengths_code_, this->lengths_, this->num_lengths_) ||
+            !build_huffman_(this->distances_code_, this->lengths_ + this->num_lengths_, this->num_distances_))
+          return this->fail_();
+        this->state_ = STATE_CODES;
+        break;
+      }
+
+      case STATE_CODES:
+        while (true) {
+          // A length symbol and its extra bits take at most 20 bits
+          this->need_(20);
+          uint8_t len;
+          int symbol = this->decode_symbol_(this->lengths_code_, &len);
+          if (symbol == -1)
+            return GZIP_NEED_INPUT;
+          if (symbol < 0)
+            return this->fail_();
+          if (symbol < 256) {
+            this->drop_(len);
+            this->put_(symbol);
+            continue;
+          }
+          if (symbol == 256) {
+            this->drop_(len);
+            this->state_ = this->final_block_ ? STATE_TRAILER : STATE_BLOCK_HEADER;
+            break;
+          }
+          symbol -= 257;
+          if (symbol >= 29)
+            return this->fail_();
+          uint8_t extra = LENGTH_EXTRA[symbol];
+          if (len + extra > this->bit_count_)
+            return GZIP_NEED_INPUT;
+          this->length_ = LENGTH_BASE[symbol] + ((this->bits_ >> len) & ((1 << extra) - 1));
+          this->drop_(len + extra);
+          this->state_ = STATE_DISTANCE;
+          break;
+        }
+        break;
+
+      case STATE_DISTANCE: {
+        uint8_t len;
+        int symbol = this->decode_symbol_(this->distances_code_, &len);
+        if (symbol == -1)
+          return GZIP_NEED_INPUT;
+        if (symbol < 0 || symbol >= 30)
+          return this->fail_();
+        uint8_t extra = DISTANCE_EXTRA[symbol];
+        if (len + extra > this->bit_count_)
+          return GZIP_NEED_INPUT;
+        uint32_t distance = DISTANCE_BASE[symbol] + ((this->bits_ >> len) & ((1 << extra) - 1));
+        this->drop_(len + extra);
+        uint32_t produced = this->output_size_ + (this->window_pos_ - this->window_flushed_);
+        if (distance > produced || distance > WINDOW_SIZE)
+          return this->fail_();
+        uint16_t from = (this->window_pos_ - distance) & (WINDOW_SIZE - 1);
+        for (uint16_t i = 0; i < this->length_; i++) {
+          this->put_(this->window_[from]);
+          from = (from + 1) & (WINDOW_SIZE - 1);
+        }
+        this->state_ = STATE_CODES;
+        break;
+      }
+
+      case STATE_TRAILER: {
+        // CRC-32 and size of the decompressed data, starting at a byte boundary
+        this->drop_(this->bit_count_ % 8);
+        this->fill_();
+        if (this->bit_count_ < 64)
+          return GZIP_NEED_INPUT;
+        uint32_t crc = this->peek_(32);
+        this->drop_(32);
+        uint32_t size = this->peek_(32);
+        this->drop_(32);
+        if (!this->flush_() || crc != this->crc_ || size != this->output_size_)
+          return this->fail_();
+        this->state_ = STATE_DONE;
+        break;
+      }
+
+      case STATE_DONE:
+        return GZIP_DONE;
+
+      case STATE_ERROR:
+        return GZIP_ERROR;
+    }
+  }
+}
+
+}  // namespace ota
+}  // namespace esphome
+
+#endif  // USE_ESP32 || USE_HOST
@@ -0,0 +1,129 @@
+#pragma once
+#include "esphome/core/defines.h"
+#if defined(USE_ESP32) || defined(USE_HOST)
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace esphome {
+namespace ota {
+
+/** Streaming gzip (RFC 1952) decoder for deflate (RFC 1951) compressed OTA images.
+ *
+ * The compressed data can be fed in chunks of any size, the decoder keeps its state between them. The decompressed
+ * data is passed to the output callback in pieces of up to 32 KB, the size of the history window deflate refers to.
+ * The CRC-32 and the length in the gzip trailer are verified once the stream ends.
+ */
+class GzipDecoder {
+ public:
+  enum Result : uint8_t {
+    GZIP_NEED_INPUT = 0,  ///< All data was consumed, the stream hasn't ended yet
+    GZIP_DONE,            ///< The stream ended and its trailer matched
+    GZIP_ERROR,           ///< The stream is corrupt or the output callback failed
+  };
+  /// Called with the decompressed data, returns false to abort decoding.
+  using OutputCallback = std::function<bool(const uint8_t *data, size_t len)>;
+
+  ~GzipDecoder();
+
+  /// Allocate the history window and start a new stream.
+  bool init(OutputCallback &&output);
+  /// Decode the next chunk of compressed data.
+  Result feed(const uint8_t *data, size_t len);
+
+  bool is_done() const { return this->state_ == STATE_DONE; }
+  /// Number of decompressed bytes so far.
+  uint32_t get_output_size() const { return this->output_size_; }
+
+ protected:
+  static const uint16_t WINDOW_SIZE = 32768;
+  static const uint8_t MAX_BITS = 15;
+
+  enum State : uint8_t {
+    STATE_HEADER,
+    STATE_HEADER_REST,
+    STATE_HEADER_EXTRA_LENGTH,
+    STATE_HEADER_EXTRA,
+    STATE_HEADER_NAME,
+    STATE_HEADER_COMMENT,
+    STATE_HEADER_CRC,
+    STATE_BLOCK_HEADER,
+    STATE_STORED_HEADER,
+    STATE_STORED,
+    STATE_TABLE_SIZES,
+    STATE_CODE_LENGTH_LENGTHS,
+    STATE_CODE_LENGTHS,
+    STATE_CODES,
+    STATE_DISTANCE,
+    STATE_TRAILER,
+    STATE_DONE,
+    STATE_ERROR,
+  };
+
+  /// Canonical Huffman code, decoded one bit at a time
+  struct Huffman {
+    uint16_t count[MAX_BITS + 1];  ///< Number of codes of each length
+    uint16_t symbol[288];          ///< Symbols ordered by code
+  };
+
+  Result decode_();
+  Result fail_();
+
+  /// Move input into the bit buffer until it holds at least 57 bits or the input ran out.
+  void fill_();
+  /// Whether the bit buffer holds at least `count` bits, refilling it if needed.
+  bool need_(uint8_t count) {
+    if (this->bit_count_ < count)
+      this->fill_();
+    return this->bit_count_ >= count;
+  }
+  uint32_t peek_(uint8_t count) const { return this->bits_ & ((1ULL << count) - 1); }
+  void drop_(uint8_t count) {
+    this->bits_ >>= count;
+    this->bit_count_ -= count;
+  }
+  /// Decode a symbol without consuming its bits, returns -1 if more bits are needed, -2 if the code is invalid.
+  int decode_symbol_(const Huffman &huffman, uint8_t *length) const;
+  /// Returns false if the lengths describe an over-subscribed code.
+  static bool build_huffman_(Huffman &huffman, const uint8_t *lengths, uint16_t count);
+
+  void put_(uint8_t byte) {
+    this->window_[this->window_pos_++] = byte;
+    if (this->window_pos_ == WINDOW_SIZE)
+      this->flush_();
+  }
+  /// Hand the decompressed data that wasn't passed on yet to the output callback.
+  bool flush_();
+
+  OutputCallback output_;
+  uint8_t *window_{nullptr};
+  uint16_t window_pos_{0};
+  uint16_t window_flushed_{0};
+  bool output_failed_{false};
+  uint32_t output_size_{0};
+  uint32_t crc_{0};
+
+  const uint8_t *in_{nullptr};
+  const uint8_t *in_end_{nullptr};
+  uint64_t bits_{0};
+  uint8_t bit_count_{0};
+
+  State state_{STATE_HEADER};
+  uint8_t flags_{0};
+  bool final_block_{false};
+  uint16_t remaining_{0};  ///< Bytes left in a header field or stored block, lengths left to read of a dynamic block
+  uint16_t length_{0};     ///< Length of the match whose distance is decoded next
+  uint16_t num_lengths_{0};
+  uint16_t num_distances_{0};
+  uint16_t index_{0};
+
+  Huffman lengths_code_;
+  Huffman distances_code_;
+  uint8_t lengths_[320];
+};
+
+}  // namespace ota
+}  // namespace esphome
+
+#endif  // USE_ESP32 || USE_HOST
@@ -12,7 +12,11 @@ class OTABackend {
   virtual OTAResponseTypes write(uint8_t *data, size_t len) = 0;
   virtual OTAResponseTypes end() = 0;
   virtual void abort() = 0;
+  /// Whether the backend takes gzip compressed images as they are
   virtual bool supports_compression() = 0;
+  /// Whether begin() accepts a size of 0 for an image whose size is only known at end(), so compressed images can
+  /// be decompressed while they're received
+  virtual bool supports_unknown_size() { return false; }
 };
 
 }  // namespace ota
@@ -11,7 +11,7 @@ namespace esphome {
 namespace ota {
 
 OTAResponseTypes ArduinoESP32OTABackend::begin(size_t image_size) {
-  bool ret = Update.begin(image_size, U_FLASH);
+  bool ret = Update.begin(image_size == 0 ? UPDATE_SIZE_UNKNOWN : image_size, U_FLASH);
   if (ret) {
     return OTA_RESPONSE_OK;
   }
@@ -16,6 +16,7 @@ class ArduinoESP32OTABackend : public OTABackend {
   OTAResponseTypes end() override;
   void abort() override;
   bool supports_compression() override { return false; }
+  bool supports_unknown_size() override { return true; }
 };
 
 }  // namespace ota
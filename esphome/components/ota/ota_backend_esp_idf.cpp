@@ -40,6 +40,14 @@ OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
 #endif
 #endif
 
+  if (image_size == 0) {
+#ifdef OTA_WITH_SEQUENTIAL_WRITES
+    // Erase the flash while writing instead of the whole partition up front
+    image_size = OTA_WITH_SEQUENTIAL_WRITES;
+#else
+    image_size = OTA_SIZE_UNKNOWN;
+#endif
+  }
   esp_err_t err = esp_ota_begin(this->partition_, image_size, &this->update_handle_);
 
 #if CONFIG_ESP_TASK_WDT_TIMEOUT_S < 15
@@ -63,10 +71,14 @@ OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
     return OTA_RESPONSE_ERROR_UNKNOWN;
   }
   this->md5_.init();
+  this->md5_set_ = false;
   return OTA_RESPONSE_OK;
 }
 
-void IDFOTABackend::set_update_md5(const char *expected_md5) { memcpy(this->expected_bin_md5_, expected_md5, 32); }
+void IDFOTABackend::set_update_md5(const char *expected_md5) {
+  memcpy(this->expected_bin_md5_, expected_md5, 32);
+  this->md5_set_ = true;
+}
 
 OTAResponseTypes IDFOTABackend::write(uint8_t *data, size_t len) {
   esp_err_t err = esp_ota_write(this->update_handle_, data, len);
@@ -84,7 +96,7 @@ OTAResponseTypes IDFOTABackend::write(uint8_t *data, size_t len) {
 
 OTAResponseTypes IDFOTABackend::end() {
   this->md5_.calculate();
-  if (!this->md5_.equals_hex(this->expected_bin_md5_)) {
+  if (this->md5_set_ && !this->md5_.equals_hex(this->expected_bin_md5_)) {
     this->abort();
     return OTA_RESPONSE_ERROR_MD5_MISMATCH;
   }
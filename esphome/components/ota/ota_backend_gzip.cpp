@@ -0,0 +1,68 @@
+#include "ota_backend_gzip.h"
+
+#if defined(USE_ESP32) || defined(USE_HOST)
+
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.gzip";
+
+bool GzipOTABackend::init() {
+  return this->decoder_.init([this](const uint8_t *data, size_t len) {
+    // The backends take mutable data, but don't modify it
+    this->write_result_ = this->backend_->write(const_cast<uint8_t *>(data), len);
+    return this->write_result_ == OTA_RESPONSE_OK;
+  });
+}
+
+OTAResponseTypes GzipOTABackend::begin(size_t image_size) {
+  // The window is already allocated by init(), this only restarts the stream
+  if (!this->init()) {
+    ESP_LOGW(TAG, "Could not allocate the decompression window");
+    return OTA_RESPONSE_ERROR_UPDATE_PREPARE;
+  }
+  this->write_result_ = OTA_RESPONSE_OK;
+  this->md5_.init();
+  // The size of the decompressed image is only known once it's complete
+  return this->backend_->begin(0);
+}
+
+void GzipOTABackend::set_update_md5(const char *md5) { memcpy(this->expected_bin_md5_, md5, 32); }
+
+OTAResponseTypes GzipOTABackend::write(uint8_t *data, size_t len) {
+  this->md5_.add(data, len);
+  if (this->decoder_.feed(data, len) == GzipDecoder::GZIP_ERROR) {
+    if (this->write_result_ != OTA_RESPONSE_OK)
+      return this->write_result_;
+    ESP_LOGW(TAG, "Decompressing the update failed after %" PRIu32 " bytes", this->decoder_.get_output_size());
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes GzipOTABackend::end() {
+  this->md5_.calculate();
+  if (!this->md5_.equals_hex(this->expected_bin_md5_)) {
+    this->abort();
+    return OTA_RESPONSE_ERROR_MD5_MISMATCH;
+  }
+  if (!this->decoder_.is_done()) {
+    ESP_LOGW(TAG, "Compressed update ended early");
+    this->abort();
+    return OTA_RESPONSE_ERROR_UPDATE_END;
+  }
+  ESP_LOGD(TAG, "Decompressed the update to %" PRIu32 " bytes", this->decoder_.get_output_size());
+  return this->backend_->end();
+}
+
+void GzipOTABackend::abort() { this->backend_->abort(); }
+
+}  // namespace ota
+}  // namespace esphome
+
+#endif  // USE_ESP32 || USE_HOST
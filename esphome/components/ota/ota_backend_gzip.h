@@ -0,0 +1,46 @@
+#pragma once
+#include "esphome/core/defines.h"
+#if defined(USE_ESP32) || defined(USE_HOST)
+
+#include "ota_backend.h"
+#include "ota_component.h"
+#include "gzip_decoder.h"
+#include "esphome/components/md5/md5.h"
+
+#include <memory>
+
+namespace esphome {
+namespace ota {
+
+/** Decompresses a gzip compressed image while it's received and passes it on to another backend.
+ *
+ * Used for backends that can't take compressed images themselves but can write an image of unknown size. The MD5
+ * sent by the client is the one of the compressed upload, so it's verified here, the decompressed image is verified
+ * against the CRC-32 and size in the gzip trailer.
+ */
+class GzipOTABackend : public OTABackend {
+ public:
+  explicit GzipOTABackend(std::unique_ptr<OTABackend> backend) : backend_(std::move(backend)) {}
+
+  /// Allocate the decompression window, returns false if there isn't enough memory.
+  bool init();
+  OTAResponseTypes begin(size_t image_size) override;
+  void set_update_md5(const char *md5) override;
+  OTAResponseTypes write(uint8_t *data, size_t len) override;
+  OTAResponseTypes end() override;
+  void abort() override;
+  bool supports_compression() override { return true; }
+
+ protected:
+  std::unique_ptr<OTABackend> backend_;
+  GzipDecoder decoder_;
+  /// Result of the last write of decompressed data to the wrapped backend
+  OTAResponseTypes write_result_{OTA_RESPONSE_OK};
+  md5::MD5Digest md5_{};
+  char expected_bin_md5_[32];
+};
+
+}  // namespace ota
+}  // namespace esphome
+
+#endif  // USE_ESP32 || USE_HOST
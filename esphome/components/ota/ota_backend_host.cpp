@@ -0,0 +1,58 @@
+#include "esphome/core/defines.h"
+#ifdef USE_HOST
+
+#include "ota_backend_host.h"
+#include "esphome/core/application.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace ota {
+
+OTAResponseTypes HostOTABackend::begin(size_t image_size) {
+  this->path_ = App.get_name() + ".ota.bin";
+  this->file_ = std::fopen((this->path_ + ".part").c_str(), "wb");
+  if (this->file_ == nullptr)
+    return OTA_RESPONSE_ERROR_UPDATE_PREPARE;
+  this->md5_.init();
+  this->md5_set_ = false;
+  return OTA_RESPONSE_OK;
+}
+
+void HostOTABackend::set_update_md5(const char *md5) {
+  memcpy(this->expected_bin_md5_, md5, 32);
+  this->md5_set_ = true;
+}
+
+OTAResponseTypes HostOTABackend::write(uint8_t *data, size_t len) {
+  this->md5_.add(data, len);
+  if (std::fwrite(data, 1, len, this->file_) != len)
+    return OTA_RESPONSE_ERROR_WRITING_FLASH;
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes HostOTABackend::end() {
+  this->md5_.calculate();
+  if (this->md5_set_ && !this->md5_.equals_hex(this->expected_bin_md5_)) {
+    this->abort();
+    return OTA_RESPONSE_ERROR_MD5_MISMATCH;
+  }
+  bool closed = std::fclose(this->file_) == 0;
+  this->file_ = nullptr;
+  if (!closed || std::rename((this->path_ + ".part").c_str(), this->path_.c_str()) != 0)
+    return OTA_RESPONSE_ERROR_WRITING_FLASH;
+  return OTA_RESPONSE_OK;
+}
+
+void HostOTABackend::abort() {
+  if (this->file_ == nullptr)
+    return;
+  std::fclose(this->file_);
+  this->file_ = nullptr;
+  std::remove((this->path_ + ".part").c_str());
+}
+
+}  // namespace ota
+}  // namespace esphome
+
+#endif  // USE_HOST
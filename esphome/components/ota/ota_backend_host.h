@@ -0,0 +1,38 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_HOST
+
+#include "ota_backend.h"
+#include "ota_component.h"
+#include "esphome/components/md5/md5.h"
+
+#include <cstdio>
+#include <string>
+
+namespace esphome {
+namespace ota {
+
+/// Writes the received image to `<node name>.ota.bin` in the working directory, so the OTA protocol can be
+/// exercised locally. The file only appears once the whole image arrived and its MD5 matched.
+class HostOTABackend : public OTABackend {
+ public:
+  OTAResponseTypes begin(size_t image_size) override;
+  void set_update_md5(const char *md5) override;
+  OTAResponseTypes write(uint8_t *data, size_t len) override;
+  OTAResponseTypes end() override;
+  void abort() override;
+  bool supports_compression() override { return false; }
+  bool supports_unknown_size() override { return true; }
+
+ protected:
+  std::FILE *file_{nullptr};
+  std::string path_;
+  md5::MD5Digest md5_{};
+  char expected_bin_md5_[32];
+  bool md5_set_{false};
+};
+
+}  // namespace ota
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -5,6 +5,8 @@
 #include "ota_backend_arduino_rp2040.h"
 #include "ota_backend_arduino_libretiny.h"
 #include "ota_backend_esp_idf.h"
+#include "ota_backend_host.h"
+#include "ota_backend_gzip.h"
 
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
@@ -14,6 +16,7 @@
 #include "esphome/components/network/util.h"
 
 #include <cerrno>
+#include <cinttypes>
 #include <cstdio>
 
 namespace esphome {
@@ -21,6 +24,14 @@ namespace ota {
 
 static const char *const TAG = "ota";
 static constexpr u_int16_t OTA_BLOCK_SIZE = 8192;
+// Size of the socket reads while receiving the image
+static constexpr size_t OTA_BUFFER_SIZE = 4096;
+// How long the image may be received in one loop() before the other components get their turn
+static constexpr uint32_t OTA_LOOP_BUDGET_MS = 20;
+static constexpr uint32_t OTA_SOCKET_TIMEOUT_HANDSHAKE = 10000;
+static constexpr uint32_t OTA_SOCKET_TIMEOUT_DATA = 90000;
+// How long the client may not take any of the responses
+static constexpr uint32_t OTA_SOCKET_TIMEOUT_SEND = 1000;
 
 OTAComponent *global_ota_component = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
@@ -42,6 +53,9 @@ std::unique_ptr<OTABackend> make_ota_backend() {
 #ifdef USE_LIBRETINY
   return make_unique<ArduinoLibreTinyOTABackend>();
 #endif
+#ifdef USE_HOST
+  return make_unique<HostOTABackend>();
+#endif  // USE_HOST
 }
 
 OTAComponent::OTAComponent() { global_ota_component = this; }
@@ -122,325 +136,408 @@ void OTAComponent::loop() {
 static const uint8_t FEATURE_SUPPORTS_COMPRESSION = 0x01;
 
 void OTAComponent::handle_() {
-  OTAResponseTypes error_code = OTA_RESPONSE_ERROR_UNKNOWN;
-  bool update_started = false;
-  size_t total = 0;
-  uint32_t last_progress = 0;
-  uint8_t buf[1024];
-  char *sbuf = reinterpret_cast<char *>(buf);
-  size_t ota_size;
-  uint8_t ota_features;
-  std::unique_ptr<OTABackend> backend;
-  (void) ota_features;
-#if USE_OTA_VERSION == 2
-  size_t size_acknowledged = 0;
-#endif
-
-  if (client_ == nullptr) {
+  if (this->step_ == OTA_STEP_IDLE) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
-    client_ = server_->accept((struct sockaddr *) &source_addr, &addr_len);
-  }
-  if (client_ == nullptr)
-    return;
-
-  int enable = 1;
-  int err = client_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
-  if (err != 0) {
-    ESP_LOGW(TAG, "Socket could not enable tcp nodelay, errno: %d", errno);
-    return;
-  }
+    this->client_ = this->server_->accept((struct sockaddr *) &source_addr, &addr_len);
+    if (this->client_ == nullptr)
+      return;
+
+    int enable = 1;
+    int err = this->client_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+    if (err != 0) {
+      ESP_LOGW(TAG, "Socket could not enable tcp nodelay, errno: %d", errno);
+      this->client_->close();
+      this->client_ = nullptr;
+      return;
+    }
+    err = this->client_->setblocking(false);
+    if (err != 0) {
+      ESP_LOGW(TAG, "Socket could not set nonblocking mode, errno: %d", errno);
+      this->client_->close();
+      this->client_ = nullptr;
+      return;
+    }
 
-  ESP_LOGD(TAG, "Starting OTA Update from %s...", this->client_->getpeername().c_str());
-  this->status_set_warning();
+    ESP_LOGD(TAG, "Starting OTA Update from %s...", this->client_->getpeername().c_str());
+    this->status_set_warning();
 #ifdef USE_OTA_STATE_CALLBACK
-  this->state_callback_.call(OTA_STARTED, 0.0f, 0);
+    this->state_callback_.call(OTA_STARTED, 0.0f, 0);
 #endif
+    // Keep the loop running continuously so the update is received at full speed
+    this->high_freq_.start();
+    this->set_step_(OTA_STEP_MAGIC);
+  }
 
-  if (!this->readall_(buf, 5)) {
-    ESP_LOGW(TAG, "Reading magic bytes failed!");
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+  // Advance as many steps as the received data allows, then let the other components run
+  while (this->step_ != OTA_STEP_IDLE) {
+    // The client waits for the responses before it sends more, they go out before the next step
+    if (!this->flush_send_buffer_()) {
+      if (this->send_failed_ || millis() - this->send_start_ > OTA_SOCKET_TIMEOUT_SEND) {
+        ESP_LOGW(TAG, "Failed to send %zu bytes of data", this->send_buffer_.size());
+        this->error_(OTA_RESPONSE_ERROR_UNKNOWN);
+      }
+      return;
+    }
+    OTAProtocolStep step = this->step_;
+    this->handle_step_();
+    if (this->step_ == step)
+      break;
   }
-  // 0x6C, 0x26, 0xF7, 0x5C, 0x45
-  if (buf[0] != 0x6C || buf[1] != 0x26 || buf[2] != 0xF7 || buf[3] != 0x5C || buf[4] != 0x45) {
-    ESP_LOGW(TAG, "Magic bytes do not match! 0x%02X-0x%02X-0x%02X-0x%02X-0x%02X", buf[0], buf[1], buf[2], buf[3],
-             buf[4]);
-    error_code = OTA_RESPONSE_ERROR_MAGIC;
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+}
+
+void OTAComponent::handle_step_() {
+  uint32_t timeout = this->step_ == OTA_STEP_DATA ? OTA_SOCKET_TIMEOUT_DATA : OTA_SOCKET_TIMEOUT_HANDSHAKE;
+  if (millis() - this->step_start_ > timeout) {
+    if (this->step_ == OTA_STEP_END_ACK) {
+      // The update is written, a missing acknowledgement is not fatal
+      ESP_LOGW(TAG, "Reading back acknowledgement failed!");
+      this->finish_();
+      return;
+    }
+    ESP_LOGW(TAG, "Timed out waiting for data in step %u", this->step_);
+    this->error_(OTA_RESPONSE_ERROR_UNKNOWN);
+    return;
   }
 
-  // Send OK and version - 2 bytes
-  buf[0] = OTA_RESPONSE_OK;
-  buf[1] = USE_OTA_VERSION;
-  this->writeall_(buf, 2);
+  switch (this->step_) {
+    case OTA_STEP_IDLE:
+      break;
+
+    case OTA_STEP_MAGIC: {
+      if (!this->read_step_(5))
+        return;
+      // 0x6C, 0x26, 0xF7, 0x5C, 0x45
+      const uint8_t *buf = this->buf_;
+      if (buf[0] != 0x6C || buf[1] != 0x26 || buf[2] != 0xF7 || buf[3] != 0x5C || buf[4] != 0x45) {
+        ESP_LOGW(TAG, "Magic bytes do not match! 0x%02X-0x%02X-0x%02X-0x%02X-0x%02X", buf[0], buf[1], buf[2], buf[3],
+                 buf[4]);
+        this->error_(OTA_RESPONSE_ERROR_MAGIC);
+        return;
+      }
 
-  backend = make_ota_backend();
+      // Send OK and version - 2 bytes
+      uint8_t response[2] = {OTA_RESPONSE_OK, USE_OTA_VERSION};
+      this->send_(response, 2);
 
-  // Read features - 1 byte
-  if (!this->readall_(buf, 1)) {
-    ESP_LOGW(TAG, "Reading features failed!");
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
-  }
-  ota_features = buf[0];  // NOLINT
-  ESP_LOGV(TAG, "OTA features is 0x%02X", ota_features);
+      this->backend_ = make_ota_backend();
+      this->set_step_(OTA_STEP_FEATURES);
+      break;
+    }
 
-  // Acknowledge header - 1 byte
-  buf[0] = OTA_RESPONSE_HEADER_OK;
-  if ((ota_features & FEATURE_SUPPORTS_COMPRESSION) != 0 && backend->supports_compression()) {
-    buf[0] = OTA_RESPONSE_SUPPORTS_COMPRESSION;
-  }
+    case OTA_STEP_FEATURES: {
+      // Read features - 1 byte
+      if (!this->read_step_(1))
+        return;
+      uint8_t ota_features = this->buf_[0];
+      ESP_LOGV(TAG, "OTA features is 0x%02X", ota_features);
+
+      // Acknowledge header - 1 byte
+      uint8_t response = OTA_RESPONSE_HEADER_OK;
+      if ((ota_features & FEATURE_SUPPORTS_COMPRESSION) != 0) {
+#if defined(USE_ESP32) || defined(USE_HOST)
+        // Only these backends take images of unknown size, the decoder isn't built for the other platforms
+        if (!this->backend_->supports_compression() && this->backend_->supports_unknown_size()) {
+          // Decompress the image while it's received, if there's memory for the window
+          auto gzip = make_unique<GzipOTABackend>(std::move(this->backend_));
+          if (gzip->init()) {
+            this->backend_ = std::move(gzip);
+          } else {
+            ESP_LOGW(TAG, "Not enough memory to decompress the update, requesting it uncompressed");
+            this->backend_ = make_ota_backend();
+          }
+        }
+#endif
+        if (this->backend_->supports_compression())
+          response = OTA_RESPONSE_SUPPORTS_COMPRESSION;
+      }
+      this->send_(&response, 1);
 
-  this->writeall_(buf, 1);
+#ifdef USE_OTA_PASSWORD
+      if (!this->password_.empty()) {
+        response = OTA_RESPONSE_REQUEST_AUTH;
+        this->send_(&response, 1);
+        char nonce[33];
+        md5::MD5Digest md5{};
+        md5.init();
+        sprintf(nonce, "%08" PRIx32, random_uint32());
+        md5.add(nonce, 8);
+        md5.calculate();
+        md5.get_hex(nonce);
+        ESP_LOGV(TAG, "Auth: Nonce is %.32s", nonce);
+
+        // Send nonce, 32 bytes hex MD5
+        this->send_(reinterpret_cast<uint8_t *>(nonce), 32);
+
+        // prepare challenge
+        this->auth_md5_.init();
+        this->auth_md5_.add(this->password_.c_str(), this->password_.length());
+        // add nonce
+        this->auth_md5_.add(nonce, 32);
+        this->set_step_(OTA_STEP_AUTH_CNONCE);
+        break;
+      }
+#endif  // USE_OTA_PASSWORD
+
+      // Acknowledge auth OK - 1 byte
+      response = OTA_RESPONSE_AUTH_OK;
+      this->send_(&response, 1);
+      this->set_step_(OTA_STEP_SIZE);
+      break;
+    }
 
 #ifdef USE_OTA_PASSWORD
-  if (!this->password_.empty()) {
-    buf[0] = OTA_RESPONSE_REQUEST_AUTH;
-    this->writeall_(buf, 1);
-    md5::MD5Digest md5{};
-    md5.init();
-    sprintf(sbuf, "%08" PRIx32, random_uint32());
-    md5.add(sbuf, 8);
-    md5.calculate();
-    md5.get_hex(sbuf);
-    ESP_LOGV(TAG, "Auth: Nonce is %s", sbuf);
-
-    // Send nonce, 32 bytes hex MD5
-    if (!this->writeall_(reinterpret_cast<uint8_t *>(sbuf), 32)) {
-      ESP_LOGW(TAG, "Auth: Writing nonce failed!");
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+    case OTA_STEP_AUTH_CNONCE: {
+      // Receive cnonce, 32 bytes hex MD5
+      if (!this->read_step_(32))
+        return;
+      ESP_LOGV(TAG, "Auth: CNonce is %s", reinterpret_cast<char *>(this->buf_));
+      // add cnonce and calculate the result
+      this->auth_md5_.add(this->buf_, 32);
+      this->auth_md5_.calculate();
+      this->set_step_(OTA_STEP_AUTH_RESPONSE);
+      break;
     }
 
-    // prepare challenge
-    md5.init();
-    md5.add(this->password_.c_str(), this->password_.length());
-    // add nonce
-    md5.add(sbuf, 32);
+    case OTA_STEP_AUTH_RESPONSE: {
+      // Receive result, 32 bytes hex MD5
+      if (!this->read_step_(32))
+        return;
+      ESP_LOGV(TAG, "Auth: Response is %s", reinterpret_cast<char *>(this->buf_));
+      if (!this->auth_md5_.equals_hex(reinterpret_cast<const char *>(this->buf_))) {
+        ESP_LOGW(TAG, "Auth failed! Passwords do not match!");
+        this->error_(OTA_RESPONSE_ERROR_AUTH_INVALID);
+        return;
+      }
 
-    // Receive cnonce, 32 bytes hex MD5
-    if (!this->readall_(buf, 32)) {
-      ESP_LOGW(TAG, "Auth: Reading cnonce failed!");
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      // Acknowledge auth OK - 1 byte
+      uint8_t response = OTA_RESPONSE_AUTH_OK;
+      this->send_(&response, 1);
+      this->set_step_(OTA_STEP_SIZE);
+      break;
     }
-    sbuf[32] = '\0';
-    ESP_LOGV(TAG, "Auth: CNonce is %s", sbuf);
-    // add cnonce
-    md5.add(sbuf, 32);
-
-    // calculate result
-    md5.calculate();
-    md5.get_hex(sbuf);
-    ESP_LOGV(TAG, "Auth: Result is %s", sbuf);
-
-    // Receive result, 32 bytes hex MD5
-    if (!this->readall_(buf + 64, 32)) {
-      ESP_LOGW(TAG, "Auth: Reading response failed!");
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
-    }
-    sbuf[64 + 32] = '\0';
-    ESP_LOGV(TAG, "Auth: Response is %s", sbuf + 64);
+#else
+    case OTA_STEP_AUTH_CNONCE:
+    case OTA_STEP_AUTH_RESPONSE:
+      break;
+#endif  // USE_OTA_PASSWORD
 
-    bool matches = true;
-    for (uint8_t i = 0; i < 32; i++)
-      matches = matches && buf[i] == buf[64 + i];
+    case OTA_STEP_SIZE: {
+      // Read size, 4 bytes MSB first
+      if (!this->read_step_(4))
+        return;
+      this->ota_size_ = encode_uint32(this->buf_[0], this->buf_[1], this->buf_[2], this->buf_[3]);
+      ESP_LOGV(TAG, "OTA size is %zu bytes", this->ota_size_);
+
+      OTAResponseTypes error_code = this->backend_->begin(this->ota_size_);
+      if (error_code != OTA_RESPONSE_OK) {
+        this->error_(error_code);
+        return;
+      }
+      this->update_started_ = true;
 
-    if (!matches) {
-      ESP_LOGW(TAG, "Auth failed! Passwords do not match!");
-      error_code = OTA_RESPONSE_ERROR_AUTH_INVALID;
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      // Acknowledge prepare OK - 1 byte
+      uint8_t response = OTA_RESPONSE_UPDATE_PREPARE_OK;
+      this->send_(&response, 1);
+      this->set_step_(OTA_STEP_MD5);
+      break;
     }
-  }
-#endif  // USE_OTA_PASSWORD
 
-  // Acknowledge auth OK - 1 byte
-  buf[0] = OTA_RESPONSE_AUTH_OK;
-  this->writeall_(buf, 1);
+    case OTA_STEP_MD5: {
+      // Read binary MD5, 32 bytes
+      if (!this->read_step_(32))
+        return;
+      ESP_LOGV(TAG, "Update: Binary MD5 is %s", reinterpret_cast<char *>(this->buf_));
+      this->backend_->set_update_md5(reinterpret_cast<const char *>(this->buf_));
+
+      this->data_buf_ = std::unique_ptr<uint8_t[]>(new uint8_t[OTA_BUFFER_SIZE]);
+      this->total_ = 0;
+      this->size_acknowledged_ = 0;
+      this->last_progress_ = millis();
+
+      // Acknowledge MD5 OK - 1 byte
+      uint8_t response = OTA_RESPONSE_BIN_MD5_OK;
+      this->send_(&response, 1);
+      this->set_step_(OTA_STEP_DATA);
+      break;
+    }
 
-  // Read size, 4 bytes MSB first
-  if (!this->readall_(buf, 4)) {
-    ESP_LOGW(TAG, "Reading size failed!");
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
-  }
-  ota_size = 0;
-  for (uint8_t i = 0; i < 4; i++) {
-    ota_size <<= 8;
-    ota_size |= buf[i];
+    case OTA_STEP_DATA:
+      this->handle_data_();
+      break;
+
+    case OTA_STEP_END_ACK: {
+      // Read ACK
+      uint8_t ack;
+      ssize_t read = this->client_->read(&ack, 1);
+      if (read == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        return;
+      if (read != 1 || ack != OTA_RESPONSE_OK) {
+        ESP_LOGW(TAG, "Reading back acknowledgement failed!");
+        // do not go to error, this is not fatal
+      }
+      this->finish_();
+      break;
+    }
   }
-  ESP_LOGV(TAG, "OTA size is %u bytes", ota_size);
-
-  error_code = backend->begin(ota_size);
-  if (error_code != OTA_RESPONSE_OK)
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
-  update_started = true;
+}
 
-  // Acknowledge prepare OK - 1 byte
-  buf[0] = OTA_RESPONSE_UPDATE_PREPARE_OK;
-  this->writeall_(buf, 1);
+void OTAComponent::handle_data_() {
+  uint32_t start = millis();
+  while (this->total_ < this->ota_size_) {
+    // Leave the rest of the data for the next loop, so the other components keep running
+    if (millis() - start > OTA_LOOP_BUDGET_MS)
+      return;
 
-  // Read binary MD5, 32 bytes
-  if (!this->readall_(buf, 32)) {
-    ESP_LOGW(TAG, "Reading binary MD5 checksum failed!");
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
-  }
-  sbuf[32] = '\0';
-  ESP_LOGV(TAG, "Update: Binary MD5 is %s", sbuf);
-  backend->set_update_md5(sbuf);
-
-  // Acknowledge MD5 OK - 1 byte
-  buf[0] = OTA_RESPONSE_BIN_MD5_OK;
-  this->writeall_(buf, 1);
-
-  while (total < ota_size) {
-    // TODO: timeout check
-    size_t requested = std::min(sizeof(buf), ota_size - total);
-    ssize_t read = this->client_->read(buf, requested);
+    size_t requested = std::min(OTA_BUFFER_SIZE, this->ota_size_ - this->total_);
+    ssize_t read = this->client_->read(this->data_buf_.get(), requested);
     if (read == -1) {
-      if (errno == EAGAIN || errno == EWOULDBLOCK) {
-        App.feed_wdt();
-        delay(1);
-        continue;
-      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        return;
       ESP_LOGW(TAG, "Error receiving data for update, errno: %d", errno);
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      this->error_(OTA_RESPONSE_ERROR_UNKNOWN);
+      return;
     } else if (read == 0) {
       // $ man recv
       // "When  a  stream socket peer has performed an orderly shutdown, the return value will
       // be 0 (the traditional "end-of-file" return)."
       ESP_LOGW(TAG, "Remote end closed connection");
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      this->error_(OTA_RESPONSE_ERROR_UNKNOWN);
+      return;
     }
+    this->step_start_ = millis();
 
-    error_code = backend->write(buf, read);
+    OTAResponseTypes error_code = this->backend_->write(this->data_buf_.get(), read);
     if (error_code != OTA_RESPONSE_OK) {
       ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
-      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+      this->error_(error_code);
+      return;
     }
-    total += read;
+    this->total_ += read;
 #if USE_OTA_VERSION == 2
-    while (size_acknowledged + OTA_BLOCK_SIZE <= total || (total == ota_size && size_acknowledged < ota_size)) {
-      buf[0] = OTA_RESPONSE_CHUNK_OK;
-      this->writeall_(buf, 1);
-      size_acknowledged += OTA_BLOCK_SIZE;
+    while (this->size_acknowledged_ + OTA_BLOCK_SIZE <= this->total_ ||
+           (this->total_ == this->ota_size_ && this->size_acknowledged_ < this->ota_size_)) {
+      uint8_t response = OTA_RESPONSE_CHUNK_OK;
+      this->send_(&response, 1);
+      this->size_acknowledged_ += OTA_BLOCK_SIZE;
     }
 #endif
 
     uint32_t now = millis();
-    if (now - last_progress > 1000) {
-      last_progress = now;
-      float percentage = (total * 100.0f) / ota_size;
+    if (now - this->last_progress_ > 1000) {
+      this->last_progress_ = now;
+      float percentage = (this->total_ * 100.0f) / this->ota_size_;
       ESP_LOGD(TAG, "OTA in progress: %0.1f%%", percentage);
 #ifdef USE_OTA_STATE_CALLBACK
       this->state_callback_.call(OTA_IN_PROGRESS, percentage, 0);
 #endif
-      // feed watchdog and give other tasks a chance to run
-      App.feed_wdt();
-      yield();
     }
+    App.feed_wdt();
   }
 
   // Acknowledge receive OK - 1 byte
-  buf[0] = OTA_RESPONSE_RECEIVE_OK;
-  this->writeall_(buf, 1);
+  uint8_t response = OTA_RESPONSE_RECEIVE_OK;
+  this->send_(&response, 1);
 
-  error_code = backend->end();
+  OTAResponseTypes error_code = this->backend_->end();
   if (error_code != OTA_RESPONSE_OK) {
     ESP_LOGW(TAG, "Error ending OTA!, error_code: %d", error_code);
-    goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+    this->error_(error_code);
+    return;
   }
 
   // Acknowledge Update end OK - 1 byte
-  buf[0] = OTA_RESPONSE_UPDATE_END_OK;
-  this->writeall_(buf, 1);
-
-  // Read ACK
-  if (!this->readall_(buf, 1) || buf[0] != OTA_RESPONSE_OK) {
-    ESP_LOGW(TAG, "Reading back acknowledgement failed!");
-    // do not go to error, this is not fatal
-  }
-
-  this->client_->close();
-  this->client_ = nullptr;
-  delay(10);
-  ESP_LOGI(TAG, "OTA update finished!");
-  this->status_clear_warning();
-#ifdef USE_OTA_STATE_CALLBACK
-  this->state_callback_.call(OTA_COMPLETED, 100.0f, 0);
-#endif
-  delay(100);  // NOLINT
-  App.safe_reboot();
-
-error:
-  buf[0] = static_cast<uint8_t>(error_code);
-  this->writeall_(buf, 1);
-  this->client_->close();
-  this->client_ = nullptr;
-
-  if (backend != nullptr && update_started) {
-    backend->abort();
-  }
-
-  this->status_momentary_error("onerror", 5000);
-#ifdef USE_OTA_STATE_CALLBACK
-  this->state_callback_.call(OTA_ERROR, 0.0f, static_cast<uint8_t>(error_code));
-#endif
+  response = OTA_RESPONSE_UPDATE_END_OK;
+  this->send_(&response, 1);
+  this->set_step_(OTA_STEP_END_ACK);
 }
 
-bool OTAComponent::readall_(uint8_t *buf, size_t len) {
-  uint32_t start = millis();
-  uint32_t at = 0;
-  while (len - at > 0) {
-    uint32_t now = millis();
-    if (now - start > 1000) {
-      ESP_LOGW(TAG, "Timed out reading %d bytes of data", len);
-      return false;
-    }
+void OTAComponent::set_step_(OTAProtocolStep step) {
+  this->step_ = step;
+  this->step_start_ = millis();
+  this->buf_len_ = 0;
+}
 
-    ssize_t read = this->client_->read(buf + at, len - at);
+bool OTAComponent::read_step_(size_t len) {
+  while (this->buf_len_ < len) {
+    ssize_t read = this->client_->read(this->buf_ + this->buf_len_, len - this->buf_len_);
     if (read == -1) {
-      if (errno == EAGAIN || errno == EWOULDBLOCK) {
-        App.feed_wdt();
-        delay(1);
-        continue;
-      }
-      ESP_LOGW(TAG, "Failed to read %d bytes of data, errno: %d", len, errno);
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        return false;
+      ESP_LOGW(TAG, "Failed to read %zu bytes of data, errno: %d", len, errno);
+      this->error_(OTA_RESPONSE_ERROR_UNKNOWN);
       return false;
     } else if (read == 0) {
       ESP_LOGW(TAG, "Remote closed connection");
+      this->error_(OTA_RESPONSE_ERROR_UNKNOWN);
       return false;
-    } else {
-      at += read;
     }
-    App.feed_wdt();
-    delay(1);
+    this->buf_len_ += read;
   }
-
+  this->buf_[len] = '\0';
   return true;
 }
-bool OTAComponent::writeall_(const uint8_t *buf, size_t len) {
-  uint32_t start = millis();
-  uint32_t at = 0;
-  while (len - at > 0) {
-    uint32_t now = millis();
-    if (now - start > 1000) {
-      ESP_LOGW(TAG, "Timed out writing %d bytes of data", len);
-      return false;
-    }
 
-    ssize_t written = this->client_->write(buf + at, len - at);
+void OTAComponent::send_(const uint8_t *buf, size_t len) {
+  if (this->send_buffer_.empty())
+    this->send_start_ = millis();
+  this->send_buffer_.insert(this->send_buffer_.end(), buf, buf + len);
+  this->flush_send_buffer_();
+}
+
+bool OTAComponent::flush_send_buffer_() {
+  while (!this->send_buffer_.empty() && !this->send_failed_) {
+    ssize_t written = this->client_->write(this->send_buffer_.data(), this->send_buffer_.size());
     if (written == -1) {
-      if (errno == EAGAIN || errno == EWOULDBLOCK) {
-        App.feed_wdt();
-        delay(1);
-        continue;
-      }
-      ESP_LOGW(TAG, "Failed to write %d bytes of data, errno: %d", len, errno);
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        return false;
+      ESP_LOGW(TAG, "Failed to write %zu bytes of data, errno: %d", this->send_buffer_.size(), errno);
+      this->send_failed_ = true;
       return false;
-    } else {
-      at += written;
     }
-    App.feed_wdt();
-    delay(1);
+    this->send_buffer_.erase(this->send_buffer_.begin(), this->send_buffer_.begin() + written);
+    this->send_start_ = millis();
   }
-  return true;
+  return !this->send_failed_;
+}
+
+void OTAComponent::error_(OTAResponseTypes error_code) {
+  // Best effort, the connection is closed right away
+  uint8_t response = static_cast<uint8_t>(error_code);
+  this->send_(&response, 1);
+  if (this->backend_ != nullptr && this->update_started_) {
+    this->backend_->abort();
+  }
+  this->cleanup_();
+
+  this->status_momentary_error("onerror", 5000);
+#ifdef USE_OTA_STATE_CALLBACK
+  this->state_callback_.call(OTA_ERROR, 0.0f, static_cast<uint8_t>(error_code));
+#endif
+}
+
+void OTAComponent::finish_() {
+  this->cleanup_();
+  delay(10);
+  ESP_LOGI(TAG, "OTA update finished!");
+  this->status_clear_warning();
+#ifdef USE_OTA_STATE_CALLBACK
+  this->state_callback_.call(OTA_COMPLETED, 100.0f, 0);
+#endif
+  delay(100);  // NOLINT
+  App.safe_reboot();
+}
+
+void OTAComponent::cleanup_() {
+  this->client_->close();
+  this->client_ = nullptr;
+  this->backend_ = nullptr;
+  this->update_started_ = false;
+  this->data_buf_ = nullptr;
+  this->send_buffer_.clear();
+  this->send_failed_ = false;
+  this->high_freq_.stop();
+  this->step_ = OTA_STEP_IDLE;
 }
 
 float OTAComponent::get_setup_priority() const { return setup_priority::AFTER_WIFI; }
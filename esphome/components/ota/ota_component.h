@@ -1,11 +1,14 @@
 #pragma once
 
+#include "esphome/components/md5/md5.h"
 #include "esphome/components/socket/socket.h"
 #include "esphome/core/component.h"
 #include "esphome/core/preferences.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
 
+#include <vector>
+
 namespace esphome {
 namespace ota {
 
@@ -40,6 +43,21 @@ enum OTAResponseTypes {
 
 enum OTAState { OTA_COMPLETED = 0, OTA_STARTED, OTA_IN_PROGRESS, OTA_ERROR };
 
+/// The step of the protocol an update is in, each loop() advances as far as the received data allows.
+enum OTAProtocolStep : uint8_t {
+  OTA_STEP_IDLE = 0,
+  OTA_STEP_MAGIC,
+  OTA_STEP_FEATURES,
+  OTA_STEP_AUTH_CNONCE,
+  OTA_STEP_AUTH_RESPONSE,
+  OTA_STEP_SIZE,
+  OTA_STEP_MD5,
+  OTA_STEP_DATA,
+  OTA_STEP_END_ACK,
+};
+
+class OTABackend;
+
 /// OTAComponent provides a simple way to integrate Over-the-Air updates into your app using ArduinoOTA.
 class OTAComponent : public Component {
  public:
@@ -79,8 +97,21 @@ class OTAComponent : public Component {
   uint32_t read_rtc_();
 
   void handle_();
-  bool readall_(uint8_t *buf, size_t len);
-  bool writeall_(const uint8_t *buf, size_t len);
+  /// Advance the current step with the data received so far.
+  void handle_step_();
+  /// Receive the image, until the socket runs dry or the loop's time budget is used up.
+  void handle_data_();
+  void set_step_(OTAProtocolStep step);
+  /// Read what has arrived of the `len` bytes the current step needs into buf_, true once all of them are there.
+  bool read_step_(size_t len);
+  /// Queue data for the client and send what the socket takes without blocking, the rest is sent by later loops.
+  void send_(const uint8_t *buf, size_t len);
+  /// Send queued data without blocking, true once all of it is sent.
+  bool flush_send_buffer_();
+  /// Report the error to the client, close the connection and abort the update.
+  void error_(OTAResponseTypes error_code);
+  void finish_();
+  void cleanup_();
 
 #ifdef USE_OTA_PASSWORD
   std::string password_;
@@ -91,6 +122,25 @@ class OTAComponent : public Component {
   std::unique_ptr<socket::Socket> server_;
   std::unique_ptr<socket::Socket> client_;
 
+  OTAProtocolStep step_{OTA_STEP_IDLE};
+  uint32_t step_start_;  ///< When the step started or, while receiving the image, when data last arrived
+  uint8_t buf_[33];      ///< The bytes received for the current step, one extra for a terminating null
+  size_t buf_len_{0};
+  std::unique_ptr<OTABackend> backend_;
+  bool update_started_{false};
+  std::unique_ptr<uint8_t[]> data_buf_;
+  size_t ota_size_{0};
+  size_t total_{0};
+  size_t size_acknowledged_{0};
+  uint32_t last_progress_{0};
+  std::vector<uint8_t> send_buffer_;
+  uint32_t send_start_{0};  ///< When data was queued to an empty send buffer or last taken by the socket
+  bool send_failed_{false};
+  HighFrequencyLoopRequester high_freq_;
+#ifdef USE_OTA_PASSWORD
+  md5::MD5Digest auth_md5_{};
+#endif  // USE_OTA_PASSWORD
+
   bool has_safe_mode_{false};              ///< stores whether safe mode can be enabled.
   uint32_t safe_mode_start_time_;          ///< stores when safe mode was enabled.
   uint32_t safe_mode_enable_time_{60000};  ///< The time safe mode should be on for.
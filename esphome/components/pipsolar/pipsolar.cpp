@@ -13,10 +13,11 @@ void Pipsolar::setup() {
 }
 
 void Pipsolar::empty_uart_buffer_() {
-  uint8_t byte;
-  while (this->available()) {
-    this->read_byte(&byte);
-  }
+  uint8_t buf[uart::READ_CHUNK_SIZE];
+  size_t len;
+  do {
+    len = this->read_array_available(buf, sizeof(buf));
+  } while (len > 0);
 }
 
 void Pipsolar::loop() {
@@ -713,27 +714,38 @@ void Pipsolar::loop() {
   }
 
   if (this->state_ == STATE_COMMAND || this->state_ == STATE_POLL) {
-    while (this->available()) {
-      uint8_t byte;
-      this->read_byte(&byte);
-
-      if (this->read_pos_ == PIPSOLAR_READ_BUFFER_LENGTH) {
-        this->read_pos_ = 0;
-        this->empty_uart_buffer_();
-      }
-      this->read_buffer_[this->read_pos_] = byte;
-      this->read_pos_++;
+    uint8_t buf[uart::READ_CHUNK_SIZE];
+    size_t len;
+    bool complete = false;
+    while (!complete && (len = this->read_array_available(buf, sizeof(buf))) > 0) {
+      for (size_t i = 0; i < len; i++) {
+        const uint8_t byte = buf[i];
+        // The rest of the chunk has been taken from the UART buffer already, it's dropped whenever that is emptied
+        bool drop_rest = false;
 
-      // end of answer
-      if (byte == 0x0D) {
-        this->read_buffer_[this->read_pos_] = 0;
-        this->empty_uart_buffer_();
-        if (this->state_ == STATE_POLL) {
-          this->state_ = STATE_POLL_COMPLETE;
+        if (this->read_pos_ == PIPSOLAR_READ_BUFFER_LENGTH) {
+          this->read_pos_ = 0;
+          this->empty_uart_buffer_();
+          drop_rest = true;
         }
-        if (this->state_ == STATE_COMMAND) {
-          this->state_ = STATE_COMMAND_COMPLETE;
+        this->read_buffer_[this->read_pos_] = byte;
+        this->read_pos_++;
+
+        // end of answer
+        if (byte == 0x0D) {
+          this->read_buffer_[this->read_pos_] = 0;
+          this->empty_uart_buffer_();
+          if (this->state_ == STATE_POLL) {
+            this->state_ = STATE_POLL_COMPLETE;
+          }
+          if (this->state_ == STATE_COMMAND) {
+            this->state_ = STATE_COMMAND_COMPLETE;
+          }
+          complete = true;
+          drop_rest = true;
         }
+        if (drop_rest)
+          break;
       }
     }  // available
   }
@@ -0,0 +1,138 @@
+#include "keyed_preferences.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace preferences {
+
+static const char *const TAG = "preferences";
+
+static uint32_t value_hash(const uint8_t *data, size_t len) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+class KeyedPreferenceBackend : public ESPPreferenceBackend {
+ public:
+  KeyedPreferenceBackend(KeyedPreferences *parent, uint16_t slot) : parent_(parent), slot_(slot) {}
+  bool save(const uint8_t *data, size_t len) override { return this->parent_->save(this->slot_, data, len); }
+  bool load(uint8_t *data, size_t len) override { return this->parent_->load(this->slot_, data, len); }
+
+ protected:
+  KeyedPreferences *parent_;
+  uint16_t slot_;
+};
+
+ESPPreferenceObject KeyedPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
+  return this->make_preference(length, type);
+}
+
+ESPPreferenceObject KeyedPreferences::make_preference(size_t length, uint32_t type) {
+  std::string key = str_sprintf("%" PRIu32, type);
+  uint16_t slot = 0;
+  // Preferences made with the same type share their slot
+  while (slot < this->slots_.size() && this->slots_[slot].key != key)
+    slot++;
+  if (slot == this->slots_.size())
+    this->slots_.push_back(Slot{std::move(key), {}, 0, 0, false});
+  return {new KeyedPreferenceBackend(this, slot)};  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+bool KeyedPreferences::save(uint16_t slot, const uint8_t *data, size_t len) {
+  Slot &s = this->slots_[slot];
+  s.data.assign(data, data + len);
+  s.pending = true;
+  ESP_LOGVV(TAG, "Pending save: key: %s, len: %zu", s.key.c_str(), len);
+  return true;
+}
+
+bool KeyedPreferences::load(uint16_t slot, uint8_t *data, size_t len) {
+  Slot &s = this->slots_[slot];
+  if (s.pending) {
+    if (s.data.size() != len)
+      return false;
+    memcpy(data, s.data.data(), len);
+    return true;
+  }
+  if (!this->read_(s.key.c_str(), data, len))
+    return false;
+  s.stored_hash = value_hash(data, len);
+  s.stored_length = len;
+  return true;
+}
+
+bool KeyedPreferences::is_changed_(const std::string &key, const std::vector<uint8_t> &data) {
+  std::vector<uint8_t> stored(data.size());
+  return !this->read_(key.c_str(), stored.data(), stored.size()) || stored != data;
+}
+
+bool KeyedPreferences::sync() {
+  size_t cached = 0, failed = 0;
+  const char *last_key = nullptr;
+  std::vector<Slot *> written;
+  // Try to write all pending saves even if one fails
+  for (auto &s : this->slots_) {
+    if (!s.pending)
+      continue;
+    uint32_t hash = value_hash(s.data.data(), s.data.size());
+    bool changed = s.stored_length != 0 ? s.stored_length != s.data.size() || s.stored_hash != hash
+                                        : this->is_changed_(s.key, s.data);
+    if (!changed) {
+      ESP_LOGV(TAG, "Data not changed skipping %s  len=%zu", s.key.c_str(), s.data.size());
+      cached++;
+      s.pending = false;
+      s.stored_hash = hash;
+      s.stored_length = s.data.size();
+      continue;
+    }
+    ESP_LOGV(TAG, "sync: key: %s, len: %zu", s.key.c_str(), s.data.size());
+    // What's in the store isn't known until the write is committed
+    s.stored_hash = hash;
+    s.stored_length = 0;
+    if (!this->write_(s.key.c_str(), s.data.data(), s.data.size())) {
+      failed++;
+      last_key = s.key.c_str();
+      continue;
+    }
+    written.push_back(&s);
+  }
+  if (cached + written.size() + failed == 0)
+    return true;
+
+  ESP_LOGD(TAG, "Saving %zu preferences to flash: %zu cached, %zu written, %zu failed",
+           cached + written.size() + failed, cached, written.size(), failed);
+  if (failed > 0)
+    ESP_LOGE(TAG, "Error saving %zu preferences to flash. Last failed key=%s", failed, last_key);
+  if (!written.empty()) {
+    if (!this->commit_()) {
+      // Keep them pending to retry on the next sync
+      ESP_LOGE(TAG, "Error committing %zu preferences to flash", written.size());
+      return false;
+    }
+    for (auto *s : written) {
+      s->pending = false;
+      s->stored_length = s->data.size();
+    }
+  }
+  return failed == 0;
+}
+
+bool KeyedPreferences::reset() {
+  ESP_LOGD(TAG, "Cleaning up preferences in flash...");
+  for (auto &s : this->slots_) {
+    s.pending = false;
+    s.stored_length = 0;
+  }
+  this->erase_();
+  return true;
+}
+
+}  // namespace preferences
+}  // namespace esphome
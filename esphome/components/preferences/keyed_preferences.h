@@ -0,0 +1,48 @@
+#pragma once
+
+#include "esphome/core/preferences.h"
+
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace preferences {
+
+/** Preferences stored as blobs under a key, in a key-value store like NVS.
+ *
+ * Every key gets a slot when its preference is made, so saving and loading don't search. Saves wait in their slot
+ * until sync(), which writes them all and commits once. Values equal to what was last read from or written to the
+ * store are skipped by comparing a hash, without reading them back.
+ */
+class KeyedPreferences : public ESPPreferences {
+ public:
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override;
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override;
+  bool sync() override;
+  bool reset() override;
+
+  bool save(uint16_t slot, const uint8_t *data, size_t len);
+  bool load(uint16_t slot, uint8_t *data, size_t len);
+
+ protected:
+  /// Read the value stored under key into data, fails if there's none or it has a different length.
+  virtual bool read_(const char *key, uint8_t *data, size_t len) = 0;
+  virtual bool write_(const char *key, const uint8_t *data, size_t len) = 0;
+  virtual bool commit_() = 0;
+  /// Erase all stored values, nothing can be written until restart.
+  virtual void erase_() = 0;
+
+  bool is_changed_(const std::string &key, const std::vector<uint8_t> &data);
+
+  struct Slot {
+    std::string key;
+    std::vector<uint8_t> data;  // saved, waiting for sync()
+    uint32_t stored_hash;       // of the value in the store, valid if stored_length isn't 0
+    uint16_t stored_length;
+    bool pending;
+  };
+  std::vector<Slot> slots_;
+};
+
+}  // namespace preferences
+}  // namespace esphome
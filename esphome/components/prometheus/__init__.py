@@ -12,6 +12,8 @@ from esphome.cpp_types import EntityBase
 
 AUTO_LOAD = ["web_server_base"]
 
+CONF_RUNTIME_METRICS = "runtime_metrics"
+
 prometheus_ns = cg.esphome_ns.namespace("prometheus")
 PrometheusHandler = prometheus_ns.class_("PrometheusHandler", cg.Component)
 
@@ -30,6 +32,7 @@ CONFIG_SCHEMA = cv.Schema(
             web_server_base.WebServerBase
         ),
         cv.Optional(CONF_INCLUDE_INTERNAL, default=False): cv.boolean,
+        cv.Optional(CONF_RUNTIME_METRICS, default=False): cv.boolean,
         cv.Optional(CONF_RELABEL, default={}): cv.Schema(
             {
                 cv.use_id(EntityBase): CUSTOMIZED_ENTITY,
@@ -44,6 +47,8 @@ async def to_code(config):
     paren = await cg.get_variable(config[CONF_WEB_SERVER_BASE_ID])
 
     cg.add_define("USE_PROMETHEUS")
+    if config[CONF_RUNTIME_METRICS]:
+        cg.add_define("USE_RUNTIME_METRICS")
 
     var = cg.new_Pvariable(config[CONF_ID], paren)
     await cg.register_component(var, config)
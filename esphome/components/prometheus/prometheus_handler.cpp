@@ -1,5 +1,14 @@
 #include "prometheus_handler.h"
 #include "esphome/core/application.h"
+#include <cinttypes>
+
+#ifdef USE_RUNTIME_METRICS
+#ifdef USE_ESP32
+#include <esp_heap_caps.h>
+#elif defined(USE_ESP8266)
+#include <Esp.h>
+#endif
+#endif
 
 namespace esphome {
 namespace prometheus {
@@ -49,6 +58,10 @@ void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
     this->lock_row_(stream, obj);
 #endif
 
+#ifdef USE_RUNTIME_METRICS
+  this->runtime_metrics_(stream);
+#endif
+
   req->send(stream);
 }
 
@@ -348,5 +361,76 @@ void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj)
 }
 #endif
 
+#ifdef USE_RUNTIME_METRICS
+void PrometheusHandler::runtime_metrics_(AsyncResponseStream *stream) {
+  auto &registry = metrics::global_metrics;
+
+  stream->print(F("#TYPE esphome_component_loop_duration_seconds HISTOGRAM\n"));
+  const auto &components = registry.get_components();
+  for (size_t i = 0; i < components.size(); i++) {
+    std::string labels = "component=\"";
+    labels += components[i].component->get_component_source();
+    labels += "\",index=\"";
+    labels += to_string(i);
+    labels += "\",";
+    this->histogram_rows_(stream, "esphome_component_loop_duration_seconds", labels, components[i].loop_time);
+  }
+
+  stream->print(F("#TYPE esphome_scheduler_lateness_seconds HISTOGRAM\n"));
+  this->histogram_rows_(stream, "esphome_scheduler_lateness_seconds", "", registry.scheduler_lateness);
+  stream->print(F("#TYPE esphome_scheduler_items GAUGE\n"));
+  stream->print(str_sprintf("esphome_scheduler_items %" PRIu32 "\n", registry.scheduler_items).c_str());
+  stream->print(F("#TYPE esphome_scheduler_executed_total COUNTER\n"));
+  stream->print(str_sprintf("esphome_scheduler_executed_total %" PRIu32 "\n", registry.scheduler_executed).c_str());
+
+  stream->print(F("#TYPE esphome_api_messages_sent_total COUNTER\n"));
+  stream->print(str_sprintf("esphome_api_messages_sent_total %" PRIu32 "\n", registry.api_messages_sent).c_str());
+  stream->print(F("#TYPE esphome_api_messages_dropped_total COUNTER\n"));
+  stream->print(str_sprintf("esphome_api_messages_dropped_total %" PRIu32 "\n", registry.api_messages_dropped).c_str());
+  stream->print(F("#TYPE esphome_api_bytes_sent_total COUNTER\n"));
+  stream->print(str_sprintf("esphome_api_bytes_sent_total %" PRIu64 "\n", registry.api_bytes_sent).c_str());
+
+  stream->print(F("#TYPE esphome_log_lines_total COUNTER\n"));
+  stream->print(str_sprintf("esphome_log_lines_total %" PRIu32 "\n", registry.log_lines.load()).c_str());
+
+#if defined(USE_ESP32)
+  uint32_t free_heap = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  uint32_t largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+#elif defined(USE_ESP8266)
+  uint32_t free_heap = ESP.getFreeHeap();              // NOLINT(readability-static-accessed-through-instance)
+  uint32_t largest_block = ESP.getMaxFreeBlockSize();  // NOLINT(readability-static-accessed-through-instance)
+#elif defined(USE_RP2040)
+  uint32_t free_heap = rp2040.getFreeHeap();
+  uint32_t largest_block = free_heap;
+#elif defined(USE_LIBRETINY)
+  uint32_t free_heap = lt_heap_get_free();
+  uint32_t largest_block = lt_heap_get_max_alloc();
+#endif
+  stream->print(F("#TYPE esphome_heap_free_bytes GAUGE\n"));
+  stream->print(str_sprintf("esphome_heap_free_bytes %" PRIu32 "\n", free_heap).c_str());
+  stream->print(F("#TYPE esphome_heap_largest_free_block_bytes GAUGE\n"));
+  stream->print(str_sprintf("esphome_heap_largest_free_block_bytes %" PRIu32 "\n", largest_block).c_str());
+}
+
+void PrometheusHandler::histogram_rows_(AsyncResponseStream *stream, const char *name, const std::string &labels,
+                                        const metrics::Histogram &histogram) {
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i < metrics::Histogram::BUCKET_COUNT; i++) {
+    cumulative += histogram.get_bucket(i);
+    if (i < metrics::Histogram::BUCKET_COUNT - 1) {
+      stream->print(str_sprintf("%s_bucket{%sle=\"%g\"} %" PRIu32 "\n", name, labels.c_str(),
+                                metrics::Histogram::BUCKET_BOUNDS[i] / 1e6, cumulative)
+                        .c_str());
+    } else {
+      stream->print(str_sprintf("%s_bucket{%sle=\"+Inf\"} %" PRIu32 "\n", name, labels.c_str(), cumulative).c_str());
+    }
+  }
+  // strip the trailing comma for the sum and count series
+  std::string series_labels = labels.empty() ? "" : "{" + labels.substr(0, labels.size() - 1) + "}";
+  stream->print(str_sprintf("%s_sum%s %.6f\n", name, series_labels.c_str(), histogram.get_sum() / 1e6).c_str());
+  stream->print(str_sprintf("%s_count%s %" PRIu32 "\n", name, series_labels.c_str(), histogram.get_count()).c_str());
+}
+#endif
+
 }  // namespace prometheus
 }  // namespace esphome
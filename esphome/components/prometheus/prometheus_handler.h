@@ -7,6 +7,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
+#include "esphome/core/metrics.h"
 
 namespace esphome {
 namespace prometheus {
@@ -109,6 +110,14 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
   void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
 #endif
 
+#ifdef USE_RUNTIME_METRICS
+  /// Return the device's own performance telemetry as prometheus data points
+  void runtime_metrics_(AsyncResponseStream *stream);
+  /// Return a histogram as prometheus data points, labels must be empty or end with a comma
+  void histogram_rows_(AsyncResponseStream *stream, const char *name, const std::string &labels,
+                       const metrics::Histogram &histogram);
+#endif
+
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
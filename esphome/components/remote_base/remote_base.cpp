@@ -103,20 +103,28 @@ void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
   }
 }
 
+void RemoteReceiverBase::next_capture_() {
+  // Shared by all receivers, so that ids are unique across them
+  static uint32_t last_capture_id = 0;
+  if (++last_capture_id == 0)
+    last_capture_id = 1;
+  this->capture_id_ = last_capture_id;
+}
+
 void RemoteReceiverBase::call_listeners_() {
   for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_));
+    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->capture_id_));
 }
 
 void RemoteReceiverBase::call_dumpers_() {
   bool success = false;
   for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_)))
+    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->capture_id_)))
       success = true;
   }
   if (!success) {
     for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_));
+      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->capture_id_));
   }
 }
 
@@ -42,11 +42,13 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance)
-      : data_(data), index_(0), tolerance_(tolerance) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance, uint32_t capture_id = 0)
+      : data_(data), index_(0), tolerance_(tolerance), capture_id_(capture_id) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
+  /// Unique id of the capture this data belongs to, 0 if unknown.
+  uint32_t get_capture_id() const { return this->capture_id_; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
   bool is_valid(uint32_t offset) const { return this->index_ + offset < this->data_.size(); }
@@ -72,6 +74,7 @@ class RemoteReceiveData {
   const RawTimings &data_;
   uint32_t index_;
   uint8_t tolerance_;
+  uint32_t capture_id_;
 };
 
 class RemoteComponentBase {
@@ -167,15 +170,19 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void call_listeners_();
   void call_dumpers_();
   void call_listeners_dumpers_() {
+    this->next_capture_();
     this->call_listeners_();
     this->call_dumpers_();
   }
+  /// Assign a new capture id to temp_, invalidating the decode results of the previous capture.
+  void next_capture_();
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   RawTimings temp_;
   uint8_t tolerance_;
+  uint32_t capture_id_{0};
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -198,14 +205,35 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/** Decode a capture with the protocol T, at most once per capture.
+ *
+ * All binary sensors, triggers and dumpers of a protocol share the result of the last capture, so a receiver with
+ * many listeners of the same protocol only decodes each capture once. Data without a capture id is always decoded.
+ */
+template<typename T> optional<typename T::ProtocolData> decode_once(RemoteReceiveData src) {
+  struct DecodeCache {
+    uint32_t capture_id{0};
+    optional<typename T::ProtocolData> result{};
+  };
+  static DecodeCache cache;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  const uint32_t capture_id = src.get_capture_id();
+  if (capture_id != 0 && cache.capture_id == capture_id)
+    return cache.result;
+  auto result = T().decode(src);
+  if (capture_id != 0) {
+    cache.capture_id = capture_id;
+    cache.result = result;
+  }
+  return result;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_once<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -220,8 +248,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_once<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -262,11 +289,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = decode_once<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
@@ -0,0 +1,133 @@
+#include "remote_receiver.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+
+#include <atomic>
+
+#if defined(USE_ESP8266) || defined(USE_LIBRETINY)
+
+namespace esphome {
+namespace remote_receiver {
+
+static const char *const TAG = "remote_receiver";
+
+void IRAM_ATTR HOT RemoteReceiverComponentStore::gpio_intr(RemoteReceiverComponentStore *arg) {
+  const uint32_t now = micros();
+  // If the lhs is 1 (rising edge) we should write to an uneven index and vice versa
+  const uint32_t next = (arg->buffer_write_at + 1) & arg->buffer_mask;
+  const bool level = arg->pin.digital_read();
+  if (level != next % 2)
+    return;
+
+  // If next is buffer_read, we have hit an overflow
+  if (next == arg->buffer_read_at) {
+    arg->overflow = true;
+    return;
+  }
+
+  const uint32_t last_change = arg->buffer[arg->buffer_write_at];
+  const uint32_t time_since_change = now - last_change;
+  if (time_since_change <= arg->filter_us)
+    return;
+
+  arg->buffer[arg->buffer_write_at = next] = now;
+}
+
+void RemoteReceiverComponent::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up Remote Receiver...");
+  this->pin_->setup();
+  auto &s = this->store_;
+  s.filter_us = this->filter_us_;
+  s.pin = this->pin_->to_isr();
+
+  this->high_freq_.start();
+  // Round up to a power of two, so that indices wrap with a mask. This also makes it divisible by two, this way we
+  // know that every 0bxxx0 index is a space and every 0bxxx1 index is a mark
+  s.buffer_size = 2;
+  while (s.buffer_size < this->buffer_size_)
+    s.buffer_size <<= 1;
+  s.buffer_mask = s.buffer_size - 1;
+
+  s.buffer = new uint32_t[s.buffer_size];
+  void *buf = (void *) s.buffer;
+  memset(buf, 0, s.buffer_size * sizeof(uint32_t));
+
+  // First index is a space.
+  if (this->pin_->digital_read()) {
+    s.buffer_write_at = s.buffer_read_at = 1;
+  } else {
+    s.buffer_write_at = s.buffer_read_at = 0;
+  }
+  this->pin_->attach_interrupt(RemoteReceiverComponentStore::gpio_intr, &this->store_, gpio::INTERRUPT_ANY_EDGE);
+}
+void RemoteReceiverComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Remote Receiver:");
+  LOG_PIN("  Pin: ", this->pin_);
+  if (this->pin_->digital_read()) {
+    ESP_LOGW(TAG, "Remote Receiver Signal starts with a HIGH value. Usually this means you have to "
+                  "invert the signal using 'inverted: True' in the pin schema!");
+  }
+  ESP_LOGCONFIG(TAG, "  Buffer Size: %u", this->store_.buffer_size);
+  ESP_LOGCONFIG(TAG, "  Tolerance: %u%%", this->tolerance_);
+  ESP_LOGCONFIG(TAG, "  Filter out pulses shorter than: %u us", this->filter_us_);
+  ESP_LOGCONFIG(TAG, "  Signal is done after %u us of no changes", this->idle_us_);
+}
+
+void RemoteReceiverComponent::loop() {
+  auto &s = this->store_;
+  if (s.overflow) {
+    ESP_LOGW(TAG, "Buffer overflow, signal dropped. Consider increasing the buffer size.");
+    s.overflow = false;
+    this->temp_.clear();
+    this->in_signal_ = false;
+  }
+
+  // Consume all edges written so far instead of waiting for the signal to end, so that long signals don't overflow
+  // the buffer. Only the ISR moves buffer_write_at and only the loop moves buffer_read_at.
+  const uint32_t write_at = s.buffer_write_at;
+  uint32_t read_at = s.buffer_read_at;
+  while (read_at != write_at) {
+    const uint32_t next = (read_at + 1) & s.buffer_mask;
+    const uint32_t delta = s.buffer[next] - s.buffer[read_at];
+    if (delta >= this->idle_us_) {
+      // A space longer than idle ends the current signal, the edge at next starts a new one
+      this->finish_signal_(read_at);
+      this->in_signal_ = true;
+    } else if (this->temp_.size() >= s.buffer_size) {
+      // Noise without an idle gap would grow the signal until the heap runs out
+      ESP_LOGW(TAG, "Buffer overflow, signal dropped. Consider increasing the buffer size.");
+      this->temp_.clear();
+      this->in_signal_ = false;
+    } else if (this->in_signal_) {
+      // The edge at an even index is a falling one, so the pulse before it was a mark
+      this->temp_.push_back(next % 2 == 0 ? int32_t(delta) : -int32_t(delta));
+    }
+    read_at = next;
+  }
+  s.buffer_read_at = read_at;
+
+  if (this->temp_.empty() || micros() - s.buffer[read_at] < this->idle_us_)
+    return;
+  // The ISR may have stored an edge since write_at was read, which continues the signal. Read the index again only
+  // after micros(), an edge stored after that can't be part of this signal anymore.
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  if (s.buffer_write_at == read_at)
+    this->finish_signal_(read_at);
+}
+
+void RemoteReceiverComponent::finish_signal_(uint32_t last_edge) {
+  // A signal needs at least one rising and one falling edge
+  if (this->temp_.empty())
+    return;
+  // End with the idle level after the last edge
+  this->temp_.push_back(last_edge % 2 == 0 ? -int32_t(this->idle_us_) : int32_t(this->idle_us_));
+  ESP_LOGVV(TAG, "Received signal with %u pulses", this->temp_.size());
+  this->call_listeners_dumpers_();
+  this->temp_.clear();
+}
+
+}  // namespace remote_receiver
+}  // namespace esphome
+
+#endif  // USE_ESP8266 || USE_LIBRETINY
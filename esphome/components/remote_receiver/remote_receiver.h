@@ -15,13 +15,18 @@ struct RemoteReceiverComponentStore {
   /// Stores the time (in micros) that the leading/falling edge happened at
   ///  * An even index means a falling edge appeared at the time stored at the index
   ///  * An uneven index means a rising edge appeared at the time stored at the index
+  ///
+  /// This is a single-producer/single-consumer ring buffer: only the ISR advances buffer_write_at and only the loop
+  /// advances buffer_read_at. The size is a power of two, so that indices wrap with buffer_mask.
   volatile uint32_t *buffer{nullptr};
   /// The position last written to
   volatile uint32_t buffer_write_at;
   /// The position last read from
-  uint32_t buffer_read_at{0};
-  bool overflow{false};
+  volatile uint32_t buffer_read_at{0};
+  /// Set by the ISR when an edge had to be dropped because the buffer was full
+  volatile bool overflow{false};
   uint32_t buffer_size{1000};
+  uint32_t buffer_mask{0};
   uint8_t filter_us{10};
   ISRInternalGPIOPin pin;
 };
@@ -58,8 +63,13 @@ class RemoteReceiverComponent : public remote_base::RemoteReceiverBase,
 #endif
 
 #if defined(USE_ESP8266) || defined(USE_LIBRETINY)
+  /// Append the idle level to the received signal in temp_ and pass it on to the listeners and dumpers.
+  void finish_signal_(uint32_t last_edge);
+
   RemoteReceiverComponentStore store_;
   HighFrequencyLoopRequester high_freq_;
+  /// Whether the edges being read belong to a signal, false until the first idle space after an overflow.
+  bool in_signal_{false};
 #endif
 
   uint32_t buffer_size_{};
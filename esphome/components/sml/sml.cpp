@@ -3,6 +3,9 @@
 #include "esphome/core/helpers.h"
 #include "sml_parser.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 namespace sml {
 
@@ -12,7 +15,28 @@ const char START_BYTES_DETECTED = 1;
 const char END_BYTES_DETECTED = 2;
 
 SmlListener::SmlListener(std::string server_id, std::string obis_code)
-    : server_id(std::move(server_id)), obis_code(std::move(obis_code)) {}
+    : server_id(std::move(server_id)), obis_code(std::move(obis_code)) {
+  // parse both once, so matching a value list entry doesn't have to format it
+  int consumed = 0;
+  uint8_t *code = this->obis_code_bytes_;
+  this->valid_ = sscanf(this->obis_code.c_str(), "%hhu-%hhu:%hhu.%hhu.%hhu%n", &code[0], &code[1], &code[2], &code[3],
+                        &code[4], &consumed) == 5 &&
+                 consumed == (int) this->obis_code.size();
+  if (!this->server_id.empty()) {
+    this->server_id_bytes_.resize(this->server_id.size() / 2);
+    this->valid_ &= this->server_id.size() % 2 == 0 &&
+                    parse_hex(this->server_id, this->server_id_bytes_, this->server_id_bytes_.size());
+  }
+}
+
+bool SmlListener::matches(const ObisInfo &obis_info) const {
+  if (!this->valid_ || memcmp(obis_info.code.data(), this->obis_code_bytes_, sizeof(this->obis_code_bytes_)) != 0)
+    return false;
+  if (this->server_id.empty())
+    return true;
+  return obis_info.server_id.size() == this->server_id_bytes_.size() &&
+         std::equal(obis_info.server_id.begin(), obis_info.server_id.end(), this->server_id_bytes_.begin());
+}
 
 char Sml::check_start_end_bytes_(uint8_t byte) {
   this->incoming_mask_ = (this->incoming_mask_ << 2) | get_code(byte);
@@ -25,79 +49,74 @@ char Sml::check_start_end_bytes_(uint8_t byte) {
 }
 
 void Sml::loop() {
-  while (available()) {
-    const char c = read();
-
-    if (this->record_)
-      this->sml_data_.emplace_back(c);
-
-    switch (this->check_start_end_bytes_(c)) {
-      case START_BYTES_DETECTED: {
-        this->record_ = true;
-        this->sml_data_.clear();
-        // add start sequence (for callbacks)
-        this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
-        break;
-      };
-      case END_BYTES_DETECTED: {
-        if (this->record_) {
-          this->record_ = false;
-
-          bool valid = check_sml_data(this->sml_data_);
-
-          // call callbacks
-          this->data_callbacks_.call(this->sml_data_, valid);
-
-          if (!valid)
-            break;
-
-          // remove start/end sequence
-          this->sml_data_.erase(this->sml_data_.begin(), this->sml_data_.begin() + START_SEQ.size());
-          this->sml_data_.resize(this->sml_data_.size() - 8);
-          this->process_sml_file_(this->sml_data_);
-        }
-        break;
-      };
-    };
+  uint8_t buf[uart::READ_CHUNK_SIZE];
+  size_t len;
+  while ((len = this->read_array_available(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < len; i++)
+      this->handle_byte_(buf[i]);
   }
 }
 
-void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback) {
-  this->data_callbacks_.add(std::move(callback));
-}
+void Sml::handle_byte_(uint8_t c) {
+  if (this->record_)
+    this->sml_data_.emplace_back(c);
+
+  switch (this->check_start_end_bytes_(c)) {
+    case START_BYTES_DETECTED: {
+      this->record_ = true;
+      this->sml_data_.clear();
+      // add start sequence (for callbacks)
+      this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
+      break;
+    };
+    case END_BYTES_DETECTED: {
+      if (this->record_) {
+        this->record_ = false;
 
-void Sml::process_sml_file_(const bytes &sml_data) {
-  SmlFile sml_file = SmlFile(sml_data);
-  std::vector<ObisInfo> obis_info = sml_file.get_obis_info();
-  this->publish_obis_info_(obis_info);
+        bool valid = check_sml_data(this->sml_data_);
 
-  this->log_obis_info_(obis_info);
+        // call callbacks
+        this->data_callbacks_.call(this->sml_data_, valid);
+
+        if (!valid)
+          break;
+
+        // without start/end sequence
+        this->process_sml_file_(BytesView(this->sml_data_.data() + START_SEQ.size(),
+                                          this->sml_data_.size() - START_SEQ.size() - 8));
+      }
+      break;
+    };
+  };
 }
 
-void Sml::log_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
-  ESP_LOGD(TAG, "OBIS info:");
-  for (auto const &obis_info : obis_info_vec) {
-    std::string info;
-    info += "  (" + bytes_repr(obis_info.server_id) + ") ";
-    info += obis_info.code_repr();
-    info += " [0x" + bytes_repr(obis_info.value) + "]";
-    ESP_LOGD(TAG, "%s", info.c_str());
-  }
+void Sml::add_on_data_callback(std::function<void(const std::vector<uint8_t> &, bool)> &&callback) {
+  this->data_callbacks_.add(std::move(callback));
 }
 
-void Sml::publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
-  for (auto const &obis_info : obis_info_vec) {
+void Sml::process_sml_file_(BytesView sml_data) {
+  ESP_LOGD(TAG, "OBIS info:");
+  // the values are handed to the listeners while parsing, they point into sml_data_
+  SmlFile sml_file(sml_data);
+  bool valid = sml_file.parse([this](const ObisInfo &obis_info) {
     this->publish_value_(obis_info);
-  }
+    this->log_obis_info_(obis_info);
+  });
+  if (!valid)
+    ESP_LOGW(TAG, "Malformed SML data, ignoring the rest of the file");
+}
+
+void Sml::log_obis_info_(const ObisInfo &obis_info) {
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
+  ESP_LOGD(TAG, "  (%s) %s [0x%s]", bytes_repr(obis_info.server_id).c_str(), obis_info.code_repr().c_str(),
+           bytes_repr(obis_info.value).c_str());
+#endif
 }
 
 void Sml::publish_value_(const ObisInfo &obis_info) {
   for (auto const &sml_listener : sml_listeners_) {
-    if ((!sml_listener->server_id.empty()) && (bytes_repr(obis_info.server_id) != sml_listener->server_id))
-      continue;
-    if (obis_info.code_repr() != sml_listener->obis_code)
-      continue;
-    sml_listener->publish_val(obis_info);
+    if (sml_listener->matches(obis_info))
+      sml_listener->publish_val(obis_info);
   }
 }
 
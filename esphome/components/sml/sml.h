@@ -16,6 +16,13 @@ class SmlListener {
   std::string obis_code;
   SmlListener(std::string server_id, std::string obis_code);
   virtual void publish_val(const ObisInfo &obis_info){};
+  /// Whether the value list entry is for this listener, compares the raw bytes of server id and OBIS code.
+  bool matches(const ObisInfo &obis_info) const;
+
+ protected:
+  bytes server_id_bytes_;
+  uint8_t obis_code_bytes_[5]{};
+  bool valid_{false};
 };
 
 class Sml : public Component, public uart::UARTDevice {
@@ -24,13 +31,13 @@ class Sml : public Component, public uart::UARTDevice {
   void loop() override;
   void dump_config() override;
   std::vector<SmlListener *> sml_listeners_{};
-  void add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback);
+  void add_on_data_callback(std::function<void(const std::vector<uint8_t> &, bool)> &&callback);
 
  protected:
-  void process_sml_file_(const bytes &sml_data);
-  void log_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
-  void publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
+  void process_sml_file_(BytesView sml_data);
+  void log_obis_info_(const ObisInfo &obis_info);
   char check_start_end_bytes_(uint8_t byte);
+  void handle_byte_(uint8_t c);
   void publish_value_(const ObisInfo &obis_info);
 
   // Serial parser
@@ -5,85 +5,146 @@
 namespace esphome {
 namespace sml {
 
-SmlFile::SmlFile(bytes buffer) : buffer_(std::move(buffer)) {
-  // extract messages
-  this->pos_ = 0;
+bool SmlFile::parse(const std::function<void(const ObisInfo &)> &callback) {
   while (this->pos_ < this->buffer_.size()) {
     if (this->buffer_[this->pos_] == 0x00)
       break;  // fill byte detected -> no more messages
-
-    SmlNode message = SmlNode();
-    if (!this->setup_node(&message))
-      break;
-    this->messages.emplace_back(message);
+    if (!this->parse_message_(callback))
+      return false;
   }
+  return true;
 }
 
-bool SmlFile::setup_node(SmlNode *node) {
-  uint8_t type = this->buffer_[this->pos_] >> 4;      // type including overlength info
-  uint8_t length = this->buffer_[this->pos_] & 0x0f;  // length including TL bytes
-  bool is_list = (type & 0x07) == SML_LIST;
-  bool has_extended_length = type & 0x08;  // we have a long list/value (>15 entries)
-  uint8_t parse_length = length;
-  if (has_extended_length) {
-    length = (length << 4) + (this->buffer_[this->pos_ + 1] & 0x0f);
-    parse_length = length - 1;
+bool SmlFile::read_field_(Field *field) {
+  if (this->pos_ >= this->buffer_.size())
+    return false;
+  uint8_t tl = this->buffer_[this->pos_];
+  if (tl == 0x00) {  // end of message
     this->pos_ += 1;
+    *field = Field{SML_OCTET, 0, {}};
+    return true;
   }
+  field->type = (tl >> 4) & 0x07;
+  // the length continues in the next type-length byte as long as the "more" bit is set
+  size_t length = tl & 0x0f;
+  size_t tl_length = 1;
+  while (tl & 0x80) {
+    if (this->pos_ + tl_length >= this->buffer_.size())
+      return false;
+    tl = this->buffer_[this->pos_ + tl_length];
+    length = (length << 4) | (tl & 0x0f);
+    tl_length++;
+  }
+  this->pos_ += tl_length;
 
-  if (this->pos_ + parse_length >= this->buffer_.size())
+  if (field->type == SML_LIST) {
+    // the length of a list is its number of entries
+    field->length = length;
+    field->value = {};
+    return true;
+  }
+  // the length of a value includes its type-length bytes
+  if (length < tl_length || this->pos_ + length - tl_length > this->buffer_.size())
     return false;
+  field->length = length - tl_length;
+  field->value = BytesView(this->buffer_.data() + this->pos_, field->length);
+  this->pos_ += field->length;
+  return true;
+}
 
-  node->type = type & 0x07;
-  node->nodes.clear();
-  node->value_bytes.clear();
-  if (this->buffer_[this->pos_] == 0x00) {  // end of message
-    this->pos_ += 1;
-  } else if (is_list) {  // list
-    this->pos_ += 1;
-    node->nodes.reserve(parse_length);
-    for (size_t i = 0; i != parse_length; i++) {
-      SmlNode child_node = SmlNode();
-      if (!this->setup_node(&child_node))
-        return false;
-      node->nodes.emplace_back(child_node);
-    }
-  } else {  // value
-    node->value_bytes =
-        bytes(this->buffer_.begin() + this->pos_ + 1, this->buffer_.begin() + this->pos_ + parse_length);
-    this->pos_ += parse_length;
+bool SmlFile::skip_fields_(size_t count) {
+  while (count > 0) {
+    Field field;
+    if (!this->read_field_(&field))
+      return false;
+    count--;
+    if (field.type == SML_LIST)
+      count += field.length;
   }
   return true;
 }
 
-std::vector<ObisInfo> SmlFile::get_obis_info() {
-  std::vector<ObisInfo> obis_info;
-  for (auto const &message : messages) {
-    SmlNode message_body = message.nodes[3];
-    uint16_t message_type = bytes_to_uint(message_body.nodes[0].value_bytes);
-    if (message_type != SML_GET_LIST_RES)
-      continue;
-
-    SmlNode get_list_response = message_body.nodes[1];
-    bytes server_id = get_list_response.nodes[1].value_bytes;
-    SmlNode val_list = get_list_response.nodes[4];
-
-    for (auto const &val_list_entry : val_list.nodes) {
-      obis_info.emplace_back(server_id, val_list_entry);
-    }
+bool SmlFile::read_list_(size_t *entries) {
+  Field field;
+  if (!this->read_field_(&field) || field.type != SML_LIST)
+    return false;
+  *entries = field.length;
+  return true;
+}
+
+bool SmlFile::parse_message_(const std::function<void(const ObisInfo &)> &callback) {
+  // SML_Message: transactionId, groupNo, abortOnError, messageBody, crc16, endOfSmlMsg
+  size_t entries;
+  if (!this->read_list_(&entries) || entries < 4)
+    return false;
+  if (!this->skip_fields_(3))
+    return false;
+
+  // SML_MessageBody: choice tag, body
+  size_t body_entries;
+  Field message_type;
+  if (!this->read_list_(&body_entries) || body_entries != 2 || !this->read_field_(&message_type) ||
+      message_type.type == SML_LIST)
+    return false;
+  if (bytes_to_uint(message_type.value) == SML_GET_LIST_RES) {
+    if (!this->parse_get_list_response_(callback))
+      return false;
+  } else if (!this->skip_fields_(1)) {
+    return false;
   }
-  return obis_info;
+  return this->skip_fields_(entries - 4);
 }
 
-std::string bytes_repr(const bytes &buffer) {
-  std::string repr;
-  for (auto const value : buffer) {
-    repr += str_sprintf("%02x", value & 0xff);
+bool SmlFile::parse_get_list_response_(const std::function<void(const ObisInfo &)> &callback) {
+  // SML_GetList.Res: clientId, serverId, listName, actSensorTime, valList, listSignature, actGatewayTime
+  size_t entries;
+  if (!this->read_list_(&entries) || entries < 5)
+    return false;
+  Field server_id;
+  if (!this->skip_fields_(1) || !this->read_field_(&server_id) || server_id.type == SML_LIST)
+    return false;
+  size_t val_list_entries;
+  if (!this->skip_fields_(2) || !this->read_list_(&val_list_entries))
+    return false;
+  for (size_t i = 0; i < val_list_entries; i++) {
+    if (!this->parse_list_entry_(server_id.value, callback))
+      return false;
   }
-  return repr;
+  return this->skip_fields_(entries - 5);
+}
+
+bool SmlFile::parse_list_entry_(BytesView server_id, const std::function<void(const ObisInfo &)> &callback) {
+  // SML_ListEntry: objName, status, valTime, unit, scaler, value, valueSignature
+  size_t entries;
+  if (!this->read_list_(&entries) || entries < 6)
+    return false;
+  Field code, status, unit, scaler, value;
+  if (!this->read_field_(&code) || code.type == SML_LIST || !this->read_field_(&status) || status.type == SML_LIST ||
+      !this->skip_fields_(1) || !this->read_field_(&unit) || unit.type == SML_LIST || !this->read_field_(&scaler) ||
+      scaler.type == SML_LIST || !this->read_field_(&value))
+    return false;
+  if (value.type == SML_LIST && !this->skip_fields_(value.length))
+    return false;
+  if (!this->skip_fields_(entries - 6))
+    return false;
+
+  if (code.length < 5)
+    return true;  // not an OBIS code
+  ObisInfo obis_info;
+  obis_info.server_id = server_id;
+  obis_info.code = code.value;
+  obis_info.status = status.value;
+  obis_info.unit = bytes_to_uint(unit.value);
+  obis_info.scaler = bytes_to_int(scaler.value);
+  obis_info.value = value.value;
+  obis_info.value_type = value.type;
+  callback(obis_info);
+  return true;
 }
 
-uint64_t bytes_to_uint(const bytes &buffer) {
+std::string bytes_repr(const BytesView &buffer) { return format_hex(buffer.data(), buffer.size()); }
+
+uint64_t bytes_to_uint(const BytesView &buffer) {
   uint64_t val = 0;
   for (auto const value : buffer) {
     val = (val << 8) + value;
@@ -91,15 +152,15 @@ uint64_t bytes_to_uint(const bytes &buffer) {
   return val;
 }
 
-int64_t bytes_to_int(const bytes &buffer) {
+int64_t bytes_to_int(const BytesView &buffer) {
   uint64_t tmp = bytes_to_uint(buffer);
   int64_t val;
 
   // sign extension for abbreviations of leading ones (e.g. 3 byte transmissions, see 6.2.2 of SML protocol definition)
   // see https://stackoverflow.com/questions/42534749/signed-extension-from-24-bit-to-32-bit-in-c
-  if (buffer.size() < 8) {
+  if (!buffer.empty() && buffer.size() < 8) {
     const int bits = buffer.size() * 8;
-    const uint64_t m = 1u << (bits - 1);
+    const uint64_t m = 1ull << (bits - 1);
     tmp = (tmp ^ m) - m;
   }
 
@@ -107,17 +168,7 @@ int64_t bytes_to_int(const bytes &buffer) {
   return val;
 }
 
-std::string bytes_to_string(const bytes &buffer) { return std::string(buffer.begin(), buffer.end()); }
-
-ObisInfo::ObisInfo(bytes server_id, SmlNode val_list_entry) : server_id(std::move(server_id)) {
-  this->code = val_list_entry.nodes[0].value_bytes;
-  this->status = val_list_entry.nodes[1].value_bytes;
-  this->unit = bytes_to_uint(val_list_entry.nodes[3].value_bytes);
-  this->scaler = bytes_to_int(val_list_entry.nodes[4].value_bytes);
-  SmlNode value_node = val_list_entry.nodes[5];
-  this->value = value_node.value_bytes;
-  this->value_type = value_node.type;
-}
+std::string bytes_to_string(const BytesView &buffer) { return std::string(buffer.begin(), buffer.end()); }
 
 std::string ObisInfo::code_repr() const {
   return str_sprintf("%d-%d:%d.%d.%d", this->code[0], this->code[1], this->code[2], this->code[3], this->code[4]);
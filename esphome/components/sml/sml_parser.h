@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <functional>
 #include <string>
 #include <vector>
 #include "constants.h"
@@ -11,44 +12,76 @@ namespace sml {
 
 using bytes = std::vector<uint8_t>;
 
-class SmlNode {
+/// Non-owning view of a range of bytes, used to refer to values inside an SML file without copying them.
+class BytesView {
  public:
-  uint8_t type;
-  bytes value_bytes;
-  std::vector<SmlNode> nodes;
+  BytesView() = default;
+  BytesView(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+  BytesView(const bytes &buffer) : data_(buffer.data()), size_(buffer.size()) {}  // NOLINT
+
+  const uint8_t *begin() const { return this->data_; }
+  const uint8_t *end() const { return this->data_ + this->size_; }
+  const uint8_t *data() const { return this->data_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  uint8_t operator[](size_t index) const { return this->data_[index]; }
+
+ protected:
+  const uint8_t *data_{nullptr};
+  size_t size_{0};
 };
 
+/// An entry of the value list of an SML GetListResponse. Its values point into the parsed SML file.
 class ObisInfo {
  public:
-  ObisInfo(bytes server_id, SmlNode val_list_entry);
-  bytes server_id;
-  bytes code;
-  bytes status;
-  char unit;
-  char scaler;
-  bytes value;
-  uint16_t value_type;
+  BytesView server_id;
+  BytesView code;
+  BytesView status;
+  char unit{0};
+  char scaler{0};
+  BytesView value;
+  uint16_t value_type{SML_UNDEFINED};
   std::string code_repr() const;
 };
 
+/** Single-pass parser for SML files.
+ *
+ * The type-length fields are read in place, only the fields of GetListResponse messages leading to the value
+ * list entries are looked at, everything else is skipped without being copied.
+ */
 class SmlFile {
  public:
-  SmlFile(bytes buffer);
-  bool setup_node(SmlNode *node);
-  std::vector<SmlNode> messages;
-  std::vector<ObisInfo> get_obis_info();
+  explicit SmlFile(BytesView buffer) : buffer_(buffer) {}
+  /// Parse all messages and call callback for every value list entry. Returns false if the file is malformed.
+  bool parse(const std::function<void(const ObisInfo &)> &callback);
 
  protected:
-  const bytes buffer_;
-  size_t pos_;
+  struct Field {
+    uint8_t type;
+    /// Number of entries for lists, otherwise the size of value
+    size_t length;
+    BytesView value;
+  };
+
+  /// Read the field at pos_ and advance past it, for lists only past the type-length field.
+  bool read_field_(Field *field);
+  /// Skip the next count fields, including all entries of lists.
+  bool skip_fields_(size_t count);
+  bool read_list_(size_t *entries);
+  bool parse_message_(const std::function<void(const ObisInfo &)> &callback);
+  bool parse_get_list_response_(const std::function<void(const ObisInfo &)> &callback);
+  bool parse_list_entry_(BytesView server_id, const std::function<void(const ObisInfo &)> &callback);
+
+  BytesView buffer_;
+  size_t pos_{0};
 };
 
-std::string bytes_repr(const bytes &buffer);
+std::string bytes_repr(const BytesView &buffer);
 
-uint64_t bytes_to_uint(const bytes &buffer);
+uint64_t bytes_to_uint(const BytesView &buffer);
 
-int64_t bytes_to_int(const bytes &buffer);
+int64_t bytes_to_int(const BytesView &buffer);
 
-std::string bytes_to_string(const bytes &buffer);
+std::string bytes_to_string(const BytesView &buffer);
 }  // namespace sml
 }  // namespace esphome
@@ -1,4 +1,5 @@
 #pragma once
+#include <cerrno>
 #include <memory>
 #include <string>
 
@@ -20,7 +21,11 @@ class Socket {
   virtual int close() = 0;
   // not supported yet:
   // virtual int connect(const std::string &address) = 0;
-  // virtual int connect(const struct sockaddr *addr, socklen_t addrlen) = 0;
+  /// Connect to a remote address, not supported by the raw lwIP TCP implementation.
+  virtual int connect(const struct sockaddr *addr, socklen_t addrlen) {
+    errno = EOPNOTSUPP;
+    return -1;
+  }
   virtual int shutdown(int how) = 0;
 
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
@@ -27,6 +27,8 @@ from esphome.const import (
     CONF_DUMMY_RECEIVER,
     CONF_DUMMY_RECEIVER_ID,
     CONF_LAMBDA,
+    CONF_PORT,
+    PLATFORM_HOST,
 )
 from esphome.core import CORE
 
@@ -45,6 +47,7 @@ RP2040UartComponent = uart_ns.class_("RP2040UartComponent", UARTComponent, cg.Co
 LibreTinyUARTComponent = uart_ns.class_(
     "LibreTinyUARTComponent", UARTComponent, cg.Component
 )
+HostUartComponent = uart_ns.class_("HostUartComponent", UARTComponent, cg.Component)
 
 UARTDevice = uart_ns.class_("UARTDevice")
 UARTWriteAction = uart_ns.class_("UARTWriteAction", automation.Action)
@@ -98,9 +101,18 @@ def _uart_declare_type(value):
         return cv.declare_id(RP2040UartComponent)(value)
     if CORE.is_libretiny:
         return cv.declare_id(LibreTinyUARTComponent)(value)
+    if CORE.is_host:
+        return cv.declare_id(HostUartComponent)(value)
     raise NotImplementedError
 
 
+def validate_pins(config):
+    # The host UART is a (pseudo) terminal and has no pins
+    if CORE.is_host:
+        return config
+    return cv.has_at_least_one_key(CONF_TX_PIN, CONF_RX_PIN)(config)
+
+
 UARTParityOptions = uart_ns.enum("UARTParityOptions")
 UART_PARITY_OPTIONS = {
     "NONE": UARTParityOptions.UART_CONFIG_PARITY_NONE,
@@ -182,9 +194,10 @@ CONFIG_SCHEMA = cv.All(
                 "This option has been removed. Please instead use invert in the tx/rx pin schemas."
             ),
             cv.Optional(CONF_DEBUG): maybe_empty_debug,
+            cv.Optional(CONF_PORT): cv.All(cv.only_on(PLATFORM_HOST), cv.string),
         }
     ).extend(cv.COMPONENT_SCHEMA),
-    cv.has_at_least_one_key(CONF_TX_PIN, CONF_RX_PIN),
+    validate_pins,
     validate_invert_esp32,
 )
 
@@ -231,6 +244,8 @@ async def to_code(config):
     cg.add(var.set_stop_bits(config[CONF_STOP_BITS]))
     cg.add(var.set_data_bits(config[CONF_DATA_BITS]))
     cg.add(var.set_parity(config[CONF_PARITY]))
+    if CONF_PORT in config:
+        cg.add(var.set_port(config[CONF_PORT]))
 
     if CONF_DEBUG in config:
         await debug_to_code(config[CONF_DEBUG], var)
@@ -302,14 +317,15 @@ def final_validate_device_schema(
         devices = fv.full_config.get().data.setdefault(KEY_UART_DEVICES, {})
         device = devices.setdefault(uart_id, {})
 
-        if require_tx:
+        # The host UART has no pins to share
+        if require_tx and not CORE.is_host:
             hub_schema[
                 cv.Required(
                     CONF_TX_PIN,
                     msg=f"Component {name} requires this uart bus to declare a tx_pin",
                 )
             ] = validate_pin(CONF_TX_PIN, device)
-        if require_rx:
+        if require_rx and not CORE.is_host:
             hub_schema[
                 cv.Required(
                     CONF_RX_PIN,
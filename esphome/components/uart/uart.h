@@ -9,6 +9,9 @@
 namespace esphome {
 namespace uart {
 
+/// Size of the stack buffer devices use to take what has been received with read_array_available()
+static const size_t READ_CHUNK_SIZE = 64;
+
 class UARTDevice {
  public:
   UARTDevice() = default;
@@ -38,6 +41,13 @@ class UARTDevice {
     return res;
   }
 
+  size_t read_array_available(uint8_t *data, size_t max_len) {
+    return this->parent_->read_array_available(data, max_len);
+  }
+  template<size_t N> size_t read_array_available(std::array<uint8_t, N> &data) {
+    return this->parent_->read_array_available(data.data(), N);
+  }
+
   int available() { return this->parent_->available(); }
 
   void flush() { return this->parent_->flush(); }
@@ -2,9 +2,11 @@
 
 #include <vector>
 #include <cstring>
+#include <functional>
 #include "esphome/core/defines.h"
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #ifdef USE_UART_DEBUGGER
 #include "esphome/core/automation.h"
@@ -67,6 +69,13 @@ class UARTComponent {
   // @return True if the specified number of bytes were successfully read, false otherwise.
   virtual bool read_array(uint8_t *data, size_t len) = 0;
 
+  // Reads the bytes that have already been received, up to max_len, without waiting for more to arrive.
+  // Implementations override this to copy from their receive buffer in one go.
+  // @param data Pointer to the array where the read data will be stored.
+  // @param max_len Maximum number of bytes to read.
+  // @return Number of bytes read, 0 if none are available.
+  virtual size_t read_array_available(uint8_t *data, size_t max_len);
+
   // Pure virtual method to return the number of bytes available for reading.
   // @return Number of available bytes.
   virtual int available() = 0;
@@ -149,6 +158,12 @@ class UARTComponent {
   virtual void load_settings(){};
 #endif  // USE_ESP8266 || USE_ESP32
 
+  // Registers a callback that is called from the main loop after new data has been received. Only the ESP-IDF and
+  // host implementations raise this event (from the driver's receive events), on other platforms devices have to
+  // keep polling available().
+  // @param callback The callback to call.
+  void add_on_rx_callback(std::function<void()> &&callback) { this->rx_callback_.add(std::move(callback)); }
+
 #ifdef USE_UART_DEBUGGER
   void add_debug_callback(std::function<void(UARTDirection, uint8_t)> &&callback) {
     this->debug_callback_.add(std::move(callback));
@@ -166,6 +181,7 @@ class UARTComponent {
   uint8_t stop_bits_;
   uint8_t data_bits_;
   UARTParityOptions parity_;
+  CallbackManager<void()> rx_callback_{};
 #ifdef USE_UART_DEBUGGER
   CallbackManager<void(UARTDirection, uint8_t)> debug_callback_{};
 #endif
@@ -5,6 +5,7 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 #include <cinttypes>
 
 #ifdef USE_LOGGER
@@ -122,6 +123,31 @@ void IDFUARTComponent::setup() {
   xSemaphoreGive(this->lock_);
 }
 
+void IDFUARTComponent::loop() {
+  if (this->rx_callback_.size() == 0)
+    return;
+  // The driver posts an event for every chunk it moves from the RX FIFO to the ring buffer (FIFO full or
+  // RX timeout), so the callbacks run once per burst instead of the devices polling for every byte.
+  uart_event_t event;
+  bool received = false;
+  while (xQueueReceive(this->uart_event_queue_, &event, 0) == pdTRUE) {
+    switch (event.type) {
+      case UART_DATA:
+        received = true;
+        break;
+      case UART_FIFO_OVF:
+      case UART_BUFFER_FULL:
+        ESP_LOGW(TAG, "RX buffer of UART %u overflowed", this->uart_num_);
+        received = true;
+        break;
+      default:
+        break;
+    }
+  }
+  if (received)
+    this->rx_callback_.call();
+}
+
 void IDFUARTComponent::load_settings(bool dump_config) {
   uart_config_t uart_config = this->get_config_();
   esp_err_t err = uart_param_config(this->uart_num_, &uart_config);
@@ -201,6 +227,32 @@ bool IDFUARTComponent::read_array(uint8_t *data, size_t len) {
   return true;
 }
 
+size_t IDFUARTComponent::read_array_available(uint8_t *data, size_t max_len) {
+  if (max_len == 0)
+    return 0;
+  size_t len = 0;
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  if (this->has_peek_) {
+    data[len++] = this->peek_byte_;
+    this->has_peek_ = false;
+  }
+  size_t buffered;
+  uart_get_buffered_data_len(this->uart_num_, &buffered);
+  size_t length_to_read = std::min(buffered, max_len - len);
+  if (length_to_read > 0) {
+    int read = uart_read_bytes(this->uart_num_, data + len, length_to_read, 0);
+    if (read > 0)
+      len += read;
+  }
+  xSemaphoreGive(this->lock_);
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < len; i++) {
+    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+  }
+#endif
+  return len;
+}
+
 int IDFUARTComponent::available() {
   size_t available;
 
@@ -12,6 +12,7 @@ namespace uart {
 class IDFUARTComponent : public UARTComponent, public Component {
  public:
   void setup() override;
+  void loop() override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::BUS; }
 
@@ -19,11 +20,13 @@ class IDFUARTComponent : public UARTComponent, public Component {
 
   bool peek_byte(uint8_t *data) override;
   bool read_array(uint8_t *data, size_t len) override;
+  size_t read_array_available(uint8_t *data, size_t max_len) override;
 
   int available() override;
   void flush() override;
 
   uint8_t get_hw_serial_number() { return this->uart_num_; }
+  /// The driver's event queue. loop() drains it when RX callbacks have been registered, otherwise it's left alone.
   QueueHandle_t *get_uart_event_queue() { return &this->uart_event_queue_; }
 
   /**
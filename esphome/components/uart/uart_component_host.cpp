@@ -0,0 +1,268 @@
+#ifdef USE_HOST
+#include "uart_component_host.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace esphome {
+namespace uart {
+
+static const char *const TAG = "uart.host";
+
+static bool baud_rate_to_speed(uint32_t baud_rate, speed_t *speed) {
+  switch (baud_rate) {
+    case 1200:
+      *speed = B1200;
+      return true;
+    case 2400:
+      *speed = B2400;
+      return true;
+    case 4800:
+      *speed = B4800;
+      return true;
+    case 9600:
+      *speed = B9600;
+      return true;
+    case 19200:
+      *speed = B19200;
+      return true;
+    case 38400:
+      *speed = B38400;
+      return true;
+    case 57600:
+      *speed = B57600;
+      return true;
+    case 115200:
+      *speed = B115200;
+      return true;
+    case 230400:
+      *speed = B230400;
+      return true;
+#ifdef B460800
+    case 460800:
+      *speed = B460800;
+      return true;
+#endif
+#ifdef B921600
+    case 921600:
+      *speed = B921600;
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+void HostUartComponent::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up UART...");
+  if (this->port_.empty()) {
+    this->fd_ = posix_openpt(O_RDWR | O_NOCTTY);
+    if (this->fd_ < 0 || grantpt(this->fd_) != 0 || unlockpt(this->fd_) != 0) {
+      ESP_LOGE(TAG, "Creating pseudo-terminal failed: errno %d", errno);
+      this->mark_failed();
+      return;
+    }
+    this->device_path_ = ptsname(this->fd_);
+  } else {
+    this->fd_ = ::open(this->port_.c_str(), O_RDWR | O_NOCTTY);
+    if (this->fd_ < 0) {
+      ESP_LOGE(TAG, "Opening %s failed: errno %d", this->port_.c_str(), errno);
+      this->mark_failed();
+      return;
+    }
+    this->device_path_ = this->port_;
+  }
+  if (!this->configure_port_()) {
+    this->mark_failed();
+    return;
+  }
+  this->rx_buffer_.resize(std::max<size_t>(this->rx_buffer_size_, 1));
+  ESP_LOGI(TAG, "UART device: %s", this->device_path_.c_str());
+}
+
+bool HostUartComponent::configure_port_() {
+  int flags = fcntl(this->fd_, F_GETFL, 0);
+  if (flags < 0 || fcntl(this->fd_, F_SETFL, flags | O_NONBLOCK) != 0) {
+    ESP_LOGE(TAG, "Setting %s non-blocking failed: errno %d", this->device_path_.c_str(), errno);
+    return false;
+  }
+  struct termios tty;
+  if (tcgetattr(this->fd_, &tty) != 0) {
+    ESP_LOGE(TAG, "Reading the settings of %s failed: errno %d", this->device_path_.c_str(), errno);
+    return false;
+  }
+  cfmakeraw(&tty);
+  tty.c_cflag |= CLOCAL | CREAD;
+  tty.c_cflag &= ~(CSIZE | PARENB | PARODD | CSTOPB);
+  switch (this->data_bits_) {
+    case 5:
+      tty.c_cflag |= CS5;
+      break;
+    case 6:
+      tty.c_cflag |= CS6;
+      break;
+    case 7:
+      tty.c_cflag |= CS7;
+      break;
+    default:
+      tty.c_cflag |= CS8;
+      break;
+  }
+  if (this->parity_ == UART_CONFIG_PARITY_EVEN) {
+    tty.c_cflag |= PARENB;
+  } else if (this->parity_ == UART_CONFIG_PARITY_ODD) {
+    tty.c_cflag |= PARENB | PARODD;
+  }
+  if (this->stop_bits_ == 2)
+    tty.c_cflag |= CSTOPB;
+  speed_t speed;
+  if (baud_rate_to_speed(this->baud_rate_, &speed)) {
+    cfsetispeed(&tty, speed);
+    cfsetospeed(&tty, speed);
+  } else if (!this->port_.empty()) {
+    // The baud rate doesn't matter for a pseudo-terminal
+    ESP_LOGW(TAG, "Baud rate %" PRIu32 " is not supported, keeping the current one", this->baud_rate_);
+  }
+  if (tcsetattr(this->fd_, TCSANOW, &tty) != 0) {
+    ESP_LOGE(TAG, "Configuring %s failed: errno %d", this->device_path_.c_str(), errno);
+    return false;
+  }
+  return true;
+}
+
+void HostUartComponent::loop() {
+  this->fill_rx_buffer_();
+  if (this->rx_pending_) {
+    this->rx_pending_ = false;
+    this->rx_callback_.call();
+  }
+}
+
+void HostUartComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "UART Bus:");
+  ESP_LOGCONFIG(TAG, "  Device: %s", this->device_path_.c_str());
+  ESP_LOGCONFIG(TAG, "  RX Buffer Size: %zu", this->rx_buffer_size_);
+  ESP_LOGCONFIG(TAG, "  Baud Rate: %" PRIu32 " baud", this->baud_rate_);
+  ESP_LOGCONFIG(TAG, "  Data Bits: %u", this->data_bits_);
+  ESP_LOGCONFIG(TAG, "  Parity: %s", LOG_STR_ARG(parity_to_str(this->parity_)));
+  ESP_LOGCONFIG(TAG, "  Stop bits: %u", this->stop_bits_);
+}
+
+void HostUartComponent::fill_rx_buffer_() {
+  if (this->fd_ < 0)
+    return;
+  const size_t size = this->rx_buffer_.size();
+  while (this->rx_count_ < size) {
+    // read into the free space up to the end of the ring, the next iteration wraps around
+    size_t tail = (this->rx_head_ + this->rx_count_) % size;
+    size_t space = std::min(size - this->rx_count_, size - tail);
+    ssize_t len = ::read(this->fd_, &this->rx_buffer_[tail], space);
+    // EAGAIN when nothing is buffered, EIO on a pseudo-terminal while no one has the other end open
+    if (len <= 0)
+      return;
+    this->rx_count_ += len;
+    this->rx_pending_ = true;
+  }
+}
+
+size_t HostUartComponent::take_rx_buffer_(uint8_t *data, size_t len) {
+  const size_t size = this->rx_buffer_.size();
+  len = std::min(len, this->rx_count_);
+  for (size_t copied = 0; copied < len;) {
+    size_t chunk = std::min(len - copied, size - this->rx_head_);
+    memcpy(data + copied, &this->rx_buffer_[this->rx_head_], chunk);
+    copied += chunk;
+    this->rx_head_ = (this->rx_head_ + chunk) % size;
+  }
+  this->rx_count_ -= len;
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < len; i++) {
+    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+  }
+#endif
+  return len;
+}
+
+void HostUartComponent::write_array(const uint8_t *data, size_t len) {
+  if (this->fd_ < 0)
+    return;
+  size_t written = 0;
+  while (written < len) {
+    ssize_t res = ::write(this->fd_, data + written, len - written);
+    if (res < 0) {
+      if (errno == EINTR)
+        continue;
+      ESP_LOGV(TAG, "Dropping %u bytes, writing failed: errno %d", (unsigned) (len - written), errno);
+      break;
+    }
+    written += res;
+  }
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < written; i++) {
+    this->debug_callback_.call(UART_DIRECTION_TX, data[i]);
+  }
+#endif
+}
+
+bool HostUartComponent::wait_for_rx_(size_t len) {
+  if (this->rx_count_ >= len)
+    return true;
+  uint32_t start_time = millis();
+  while (true) {
+    this->fill_rx_buffer_();
+    if (this->rx_count_ >= len)
+      return true;
+    if (millis() - start_time > 100) {
+      ESP_LOGE(TAG, "Reading from UART timed out at byte %u!", (unsigned) this->rx_count_);
+      return false;
+    }
+    yield();
+  }
+}
+
+bool HostUartComponent::peek_byte(uint8_t *data) {
+  if (!this->wait_for_rx_(1))
+    return false;
+  *data = this->rx_buffer_[this->rx_head_];
+  return true;
+}
+
+bool HostUartComponent::read_array(uint8_t *data, size_t len) {
+  if (len > this->rx_buffer_.size() || !this->wait_for_rx_(len))
+    return false;
+  this->take_rx_buffer_(data, len);
+  return true;
+}
+
+size_t HostUartComponent::read_array_available(uint8_t *data, size_t max_len) {
+  if (this->rx_count_ < max_len)
+    this->fill_rx_buffer_();
+  return this->take_rx_buffer_(data, max_len);
+}
+
+int HostUartComponent::available() {
+  // Like with the hardware drivers this only reports what has been buffered (by loop() or an earlier read), so
+  // devices polling it byte by byte don't cause a system call each time.
+  if (this->rx_count_ == 0)
+    this->fill_rx_buffer_();
+  return this->rx_count_;
+}
+
+void HostUartComponent::flush() {
+  ESP_LOGVV(TAG, "    Flushing...");
+  if (this->fd_ >= 0)
+    tcdrain(this->fd_);
+}
+
+}  // namespace uart
+}  // namespace esphome
+
+#endif  // USE_HOST
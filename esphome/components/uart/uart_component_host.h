@@ -0,0 +1,63 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <string>
+#include <vector>
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "uart_component.h"
+
+namespace esphome {
+namespace uart {
+
+/** UART bus of the host platform.
+ *
+ * Without a port a pseudo-terminal is created, whose device path is logged at startup so that a simulator or
+ * a tool like socat can be attached to the other end. With a port the given serial device is opened instead.
+ */
+class HostUartComponent : public UARTComponent, public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  void write_array(const uint8_t *data, size_t len) override;
+
+  bool peek_byte(uint8_t *data) override;
+  bool read_array(uint8_t *data, size_t len) override;
+  size_t read_array_available(uint8_t *data, size_t max_len) override;
+
+  int available() override;
+  void flush() override;
+
+  void set_port(const std::string &port) { this->port_ = port; }
+  /// The device the other end has to open, the pseudo-terminal's secondary end or the configured port.
+  const std::string &get_device_path() const { return this->device_path_; }
+
+ protected:
+  void check_logger_conflict() override {}
+  bool configure_port_();
+  /// Move the bytes buffered by the kernel to rx_buffer_, as many as fit.
+  void fill_rx_buffer_();
+  size_t take_rx_buffer_(uint8_t *data, size_t len);
+  /// Wait up to 100 ms until len bytes have been received, like check_read_timeout_() does for the other platforms.
+  bool wait_for_rx_(size_t len);
+
+  std::string port_;
+  std::string device_path_;
+  int fd_{-1};
+  /// Ring buffer of rx_buffer_size_ bytes, like the RX buffers of the hardware UART drivers
+  std::vector<uint8_t> rx_buffer_;
+  size_t rx_head_{0};
+  size_t rx_count_{0};
+  /// Whether bytes have arrived since the RX callbacks were called last
+  bool rx_pending_{false};
+};
+
+}  // namespace uart
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -94,26 +94,38 @@ void VoiceAssistant::setup() {
     this->mark_failed();
     return;
   }
-
-  ExternalRAMAllocator<uint8_t> send_allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
-  this->send_buffer_ = send_allocator.allocate(SEND_BUFFER_SIZE);
-  if (send_buffer_ == nullptr) {
-    ESP_LOGW(TAG, "Could not allocate send buffer");
-    this->mark_failed();
-    return;
-  }
 }
 
 int VoiceAssistant::read_microphone_() {
   size_t bytes_read = 0;
-  if (this->mic_->is_running()) {  // Read audio into input buffer
-    bytes_read = this->mic_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-    if (bytes_read == 0) {
-      memset(this->input_buffer_, 0, INPUT_BUFFER_SIZE * sizeof(int16_t));
-      return 0;
+  if (this->mic_->is_running()) {
+    size_t to_read = INPUT_BUFFER_SIZE * sizeof(int16_t);
+    bool copy = this->ring_buffer_->free() < to_read;
+#ifdef USE_ESP_ADF
+    // VAD needs the whole frame in one piece
+    copy = copy || this->state_ == State::WAITING_FOR_VAD;
+#endif
+    if (copy) {
+      // Read into the input buffer first, so that only as much of the oldest audio is dropped as was read
+      bytes_read = this->mic_->read(this->input_buffer_, to_read);
+      if (bytes_read == 0) {
+        memset(this->input_buffer_, 0, to_read);
+        return 0;
+      }
+      this->ring_buffer_->write(this->input_buffer_, bytes_read);
+      return bytes_read;
+    }
+    // There's room for all of it, read straight into the ring buffer. The second read continues at its start if the
+    // region wrapped.
+    while (to_read > 0) {
+      RingBuffer::Span span = this->ring_buffer_->acquire_write(to_read);
+      size_t len = this->mic_->read(reinterpret_cast<int16_t *>(span.data), span.len);
+      this->ring_buffer_->commit(len);
+      bytes_read += len;
+      to_read -= len;
+      if (len < span.len)
+        break;
     }
-    // Write audio into ring buffer
-    this->ring_buffer_->write((void *) this->input_buffer_, bytes_read);
   } else {
     ESP_LOGD(TAG, "microphone not running");
   }
@@ -153,7 +165,6 @@ void VoiceAssistant::loop() {
     }
     case State::START_MICROPHONE: {
       ESP_LOGD(TAG, "Starting Microphone");
-      memset(this->send_buffer_, 0, SEND_BUFFER_SIZE);
       memset(this->input_buffer_, 0, INPUT_BUFFER_SIZE * sizeof(int16_t));
       this->mic_->start();
       this->high_freq_.start();
@@ -235,12 +246,11 @@ void VoiceAssistant::loop() {
     }
     case State::STREAMING_MICROPHONE: {
       this->read_microphone_();
-      size_t available = this->ring_buffer_->available();
-      while (available >= SEND_BUFFER_SIZE) {
-        size_t read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE, 0);
-        this->socket_->sendto(this->send_buffer_, read_bytes, 0, (struct sockaddr *) &this->dest_addr_,
-                              sizeof(this->dest_addr_));
-        available = this->ring_buffer_->available();
+      // Send straight from the ring buffer, where the data wraps around its end the packet is split in two
+      while (this->ring_buffer_->available() >= SEND_BUFFER_SIZE) {
+        RingBuffer::Span span = this->ring_buffer_->peek_read(SEND_BUFFER_SIZE);
+        this->socket_->sendto(span.data, span.len, 0, (struct sockaddr *) &this->dest_addr_, sizeof(this->dest_addr_));
+        this->ring_buffer_->consume(span.len);
       }
 
       break;
@@ -193,7 +193,7 @@ class VoiceAssistant : public Component {
   uint8_t auto_gain_;
   float volume_multiplier_;
 
-  uint8_t *send_buffer_;
+  /// Frame for VAD, and for microphone reads when ring_buffer_ is too full to read straight into it
   int16_t *input_buffer_;
 
   bool continuous_{false};
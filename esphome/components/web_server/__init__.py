@@ -1,4 +1,7 @@
 import gzip
+import hashlib
+from pathlib import Path
+
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import web_server_base
@@ -28,6 +31,9 @@ from esphome.core import CORE, coroutine_with_priority
 
 AUTO_LOAD = ["json", "web_server_base"]
 
+CONF_EVENT_INTERVAL = "event_interval"
+CONF_BROTLI = "brotli"
+
 web_server_ns = cg.esphome_ns.namespace("web_server")
 WebServer = web_server_ns.class_("WebServer", cg.Component, cg.Controller)
 
@@ -53,6 +59,20 @@ def validate_local(config):
     return config
 
 
+def validate_brotli(value):
+    value = cv.boolean(value)
+    if value:
+        try:
+            # pylint: disable-next=import-outside-toplevel,unused-import
+            import brotli  # noqa: F401
+        except ImportError as err:
+            raise cv.Invalid(
+                "The 'brotli' python package is required for Brotli compressed assets, "
+                "install it with 'pip install brotli'"
+            ) from err
+    return value
+
+
 def validate_ota(config):
     if CORE.using_esp_idf and config[CONF_OTA]:
         raise cv.Invalid("Enabling 'ota' is not supported for IDF framework yet")
@@ -94,6 +114,10 @@ CONFIG_SCHEMA = cv.All(
             ): cv.boolean,
             cv.Optional(CONF_LOG, default=True): cv.boolean,
             cv.Optional(CONF_LOCAL): cv.boolean,
+            cv.Optional(
+                CONF_EVENT_INTERVAL, default="0ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_BROTLI, default=False): validate_brotli,
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_BK72XX, PLATFORM_RTL87XX]),
@@ -103,17 +127,22 @@ CONFIG_SCHEMA = cv.All(
 )
 
 
-def build_index_html(config) -> str:
+def resource_hash(content: bytes) -> str:
+    """Short content hash, used as ETag and cache-busting query parameter."""
+    return hashlib.sha256(content).hexdigest()[:16]
+
+
+def build_index_html(config, css_hash: str = "", js_hash: str = "") -> str:
     html = "<!DOCTYPE html><html><head><meta charset=UTF-8><link rel=icon href=data:>"
     css_include = config.get(CONF_CSS_INCLUDE)
     js_include = config.get(CONF_JS_INCLUDE)
     if css_include:
-        html += "<link rel=stylesheet href=/0.css>"
+        html += f"<link rel=stylesheet href=/0.css?v={css_hash}>"
     if config[CONF_CSS_URL]:
         html += f'<link rel=stylesheet href="{config[CONF_CSS_URL]}">'
     html += "</head><body>"
     if js_include:
-        html += "<script type=module src=/0.js></script>"
+        html += f"<script type=module src=/0.js?v={js_hash}></script>"
     html += "<esp-app></esp-app>"
     if config[CONF_JS_URL]:
         html += f'<script src="{config[CONF_JS_URL]}"></script>'
@@ -121,21 +150,68 @@ def build_index_html(config) -> str:
     return html
 
 
+def add_progmem_array(name: str, data: bytes) -> None:
+    """Add a byte array and its size to progmem."""
+    size = len(data)
+    bytes_as_int = ", ".join(str(x) for x in data)
+    uint8_t = f"const uint8_t {name}[{size}] PROGMEM = {{{bytes_as_int}}}"
+    size_t = f"const size_t {name}_SIZE = {size}"
+    cg.add_global(cg.RawExpression(uint8_t))
+    cg.add_global(cg.RawExpression(size_t))
+
+
+def add_resource_hash(resource_name: str, content: bytes) -> None:
+    """Add the content hash of a resource, used by the web server as its ETag."""
+    cg.add_global(
+        cg.RawExpression(
+            f'const char ESPHOME_WEBSERVER_{resource_name}_HASH[] = "{resource_hash(content)}"'
+        )
+    )
+
+
 def add_resource_as_progmem(
-    resource_name: str, content: str, compress: bool = True
+    resource_name: str, content: str, compress: bool = True, brotli: bool = False
 ) -> None:
-    """Add a resource to progmem."""
+    """Add a resource to progmem.
+
+    The hash of the uncompressed content is always added. If brotli is set, a Brotli
+    compressed copy is added next to the gzip compressed one for clients accepting it.
+    """
     content_encoded = content.encode("utf-8")
+    add_resource_hash(resource_name, content_encoded)
+    if brotli:
+        add_progmem_array(
+            f"ESPHOME_WEBSERVER_{resource_name}_BR", brotli_compress(content_encoded)
+        )
     if compress:
         content_encoded = gzip.compress(content_encoded)
-    content_encoded_size = len(content_encoded)
-    bytes_as_int = ", ".join(str(x) for x in content_encoded)
-    uint8_t = f"const uint8_t ESPHOME_WEBSERVER_{resource_name}[{content_encoded_size}] PROGMEM = {{{bytes_as_int}}}"
-    size_t = (
-        f"const size_t ESPHOME_WEBSERVER_{resource_name}_SIZE = {content_encoded_size}"
-    )
-    cg.add_global(cg.RawExpression(uint8_t))
-    cg.add_global(cg.RawExpression(size_t))
+    add_progmem_array(f"ESPHOME_WEBSERVER_{resource_name}", content_encoded)
+
+
+def brotli_compress(content: bytes) -> bytes:
+    import brotli  # pylint: disable=import-outside-toplevel
+
+    return brotli.compress(content, quality=11)
+
+
+# The gzip compressed frontend, built by https://github.com/esphome/esphome-webserver
+SERVER_INDEX_GZ = Path(__file__).parent / "server_index.html.gz"
+
+
+def add_local_index_resources(brotli: bool) -> None:
+    """Add the frontend to progmem with its hash, and a Brotli copy if requested."""
+    index_gz = SERVER_INDEX_GZ.read_bytes()
+    content = gzip.decompress(index_gz)
+    add_resource_hash("INDEX", content)
+    add_progmem_array("ESPHOME_WEBSERVER_INDEX_GZ", index_gz)
+    if brotli:
+        add_progmem_array("ESPHOME_WEBSERVER_INDEX_BR", brotli_compress(content))
+
+
+def read_include(config, key) -> str:
+    path = CORE.relative_config_path(config[key])
+    with open(file=path, encoding="utf-8") as file:
+        return file.read()
 
 
 @coroutine_with_priority(40.0)
@@ -152,14 +228,29 @@ async def to_code(config):
     cg.add_define("USE_WEBSERVER")
     cg.add_define("USE_WEBSERVER_PORT", config[CONF_PORT])
     cg.add_define("USE_WEBSERVER_VERSION", version)
+    brotli = config[CONF_BROTLI]
+    if brotli:
+        cg.add_define("USE_WEBSERVER_BROTLI")
+    css_include = (
+        read_include(config, CONF_CSS_INCLUDE) if CONF_CSS_INCLUDE in config else ""
+    )
+    js_include = (
+        read_include(config, CONF_JS_INCLUDE) if CONF_JS_INCLUDE in config else ""
+    )
     if version == 2:
         # Don't compress the index HTML as the data sizes are almost the same.
-        add_resource_as_progmem("INDEX_HTML", build_index_html(config), compress=False)
+        index_html = build_index_html(
+            config,
+            resource_hash(css_include.encode("utf-8")),
+            resource_hash(js_include.encode("utf-8")),
+        )
+        add_resource_as_progmem("INDEX_HTML", index_html, compress=False)
     else:
         cg.add(var.set_css_url(config[CONF_CSS_URL]))
         cg.add(var.set_js_url(config[CONF_JS_URL]))
     cg.add(var.set_allow_ota(config[CONF_OTA]))
     cg.add(var.set_expose_log(config[CONF_LOG]))
+    cg.add(var.set_event_interval(config[CONF_EVENT_INTERVAL]))
     if config[CONF_ENABLE_PRIVATE_NETWORK_ACCESS]:
         cg.add_define("USE_WEBSERVER_PRIVATE_NETWORK_ACCESS")
     if CONF_AUTH in config:
@@ -167,14 +258,11 @@ async def to_code(config):
         cg.add(paren.set_auth_password(config[CONF_AUTH][CONF_PASSWORD]))
     if CONF_CSS_INCLUDE in config:
         cg.add_define("USE_WEBSERVER_CSS_INCLUDE")
-        path = CORE.relative_config_path(config[CONF_CSS_INCLUDE])
-        with open(file=path, encoding="utf-8") as css_file:
-            add_resource_as_progmem("CSS_INCLUDE", css_file.read())
+        add_resource_as_progmem("CSS_INCLUDE", css_include, brotli=brotli)
     if CONF_JS_INCLUDE in config:
         cg.add_define("USE_WEBSERVER_JS_INCLUDE")
-        path = CORE.relative_config_path(config[CONF_JS_INCLUDE])
-        with open(file=path, encoding="utf-8") as js_file:
-            add_resource_as_progmem("JS_INCLUDE", js_file.read())
+        add_resource_as_progmem("JS_INCLUDE", js_include, brotli=brotli)
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
     if CONF_LOCAL in config and config[CONF_LOCAL]:
         cg.add_define("USE_WEBSERVER_LOCAL")
+        add_local_index_resources(brotli)
@@ -11,6 +11,8 @@
 #include "StreamString.h"
 #endif
 
+#include <algorithm>
+#include <cinttypes>
 #include <cstdlib>
 
 #ifdef USE_LIGHT
@@ -25,10 +27,6 @@
 #include "esphome/components/climate/climate.h"
 #endif
 
-#ifdef USE_WEBSERVER_LOCAL
-#include "server_index.h"
-#endif
-
 namespace esphome {
 namespace web_server {
 
@@ -163,18 +161,204 @@ void WebServer::loop() {
   }
 #endif
   this->entities_iterator_.advance();
+
+  if (!this->pending_state_events_.empty() && millis() - this->last_event_flush_ >= this->event_interval_)
+    this->flush_state_events_();
 }
 void WebServer::dump_config() {
   ESP_LOGCONFIG(TAG, "Web Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->base_->get_port());
+  if (this->event_interval_ != 0)
+    ESP_LOGCONFIG(TAG, "  Event Interval: %" PRIu32 "ms", this->event_interval_);
+}
+
+bool WebServer::queue_state_event_(EntityBase *obj, StateEventType type) {
+  if (this->event_interval_ == 0)
+    return false;
+  for (auto &event : this->pending_state_events_) {
+    // The JSON is only built when flushing, so the newest state is always sent
+    if (event.obj == obj)
+      return true;
+  }
+  this->pending_state_events_.push_back(PendingStateEvent{obj, type});
+  return true;
+}
+
+void WebServer::flush_state_events_() {
+  this->last_event_flush_ = millis();
+  // Swap out first, publishing a state while building the JSON could queue another event
+  std::vector<PendingStateEvent> events;
+  events.swap(this->pending_state_events_);
+  for (auto &event : events)
+    this->events_.send(this->state_event_json_(event).c_str(), "state");
+  events.clear();
+  // Keep the allocated capacity for the next batch
+  if (this->pending_state_events_.empty())
+    this->pending_state_events_.swap(events);
+}
+
+std::string WebServer::state_event_json_(const PendingStateEvent &event) {
+  switch (event.type) {
+#ifdef USE_SENSOR
+    case StateEventType::SENSOR: {
+      auto *obj = static_cast<sensor::Sensor *>(event.obj);
+      return this->sensor_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_TEXT_SENSOR
+    case StateEventType::TEXT_SENSOR: {
+      auto *obj = static_cast<text_sensor::TextSensor *>(event.obj);
+      return this->text_sensor_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_SWITCH
+    case StateEventType::SWITCH: {
+      auto *obj = static_cast<switch_::Switch *>(event.obj);
+      return this->switch_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_BINARY_SENSOR
+    case StateEventType::BINARY_SENSOR: {
+      auto *obj = static_cast<binary_sensor::BinarySensor *>(event.obj);
+      return this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_FAN
+    case StateEventType::FAN:
+      return this->fan_json(static_cast<fan::Fan *>(event.obj), DETAIL_STATE);
+#endif
+#ifdef USE_LIGHT
+    case StateEventType::LIGHT:
+      return this->light_json(static_cast<light::LightState *>(event.obj), DETAIL_STATE);
+#endif
+#ifdef USE_COVER
+    case StateEventType::COVER:
+      return this->cover_json(static_cast<cover::Cover *>(event.obj), DETAIL_STATE);
+#endif
+#ifdef USE_NUMBER
+    case StateEventType::NUMBER: {
+      auto *obj = static_cast<number::Number *>(event.obj);
+      return this->number_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_TEXT
+    case StateEventType::TEXT: {
+      auto *obj = static_cast<text::Text *>(event.obj);
+      return this->text_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_SELECT
+    case StateEventType::SELECT: {
+      auto *obj = static_cast<select::Select *>(event.obj);
+      return this->select_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_CLIMATE
+    case StateEventType::CLIMATE:
+      return this->climate_json(static_cast<climate::Climate *>(event.obj), DETAIL_STATE);
+#endif
+#ifdef USE_LOCK
+    case StateEventType::LOCK: {
+      auto *obj = static_cast<lock::Lock *>(event.obj);
+      return this->lock_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+    case StateEventType::ALARM_CONTROL_PANEL: {
+      auto *obj = static_cast<alarm_control_panel::AlarmControlPanel *>(event.obj);
+      return this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE);
+    }
+#endif
+    default:
+      return "";
+  }
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
 
+static optional<std::string> get_request_header(AsyncWebServerRequest *request, const char *name) {
+#ifdef USE_ARDUINO
+  AsyncWebHeader *header = request->getHeader(name);
+  if (header == nullptr)
+    return {};
+  return std::string(header->value().c_str());
+#else
+  return request->get_header(name);
+#endif
+}
+
+#ifdef USE_WEBSERVER_BROTLI
+static bool accepts_brotli(AsyncWebServerRequest *request) {
+  auto accept_encoding = get_request_header(request, "Accept-Encoding");
+  if (!accept_encoding.has_value())
+    return false;
+  // A list of codings with optional weights like "gzip, br;q=0.8, *;q=0", a weight of 0 means not acceptable.
+  // An entry for br takes precedence over "*".
+  const std::string value = str_lower_case(*accept_encoding);
+  bool wildcard = false;
+  size_t start = 0;
+  while (start < value.size()) {
+    size_t end = std::min(value.find(',', start), value.size());
+    size_t params = std::min(value.find(';', start), end);
+    size_t first = value.find_first_not_of(" \t", start);
+    size_t last = value.find_last_not_of(" \t", params - 1);
+    std::string coding = first < params && last != std::string::npos && last >= first
+                             ? value.substr(first, last - first + 1)
+                             : std::string();
+    if (coding == "br" || coding == "*") {
+      bool acceptable = true;
+      size_t q = value.find("q=", params);
+      if (q < end)
+        acceptable = strtof(value.c_str() + q + 2, nullptr) > 0.0f;
+      if (coding == "br")
+        return acceptable;
+      wildcard = acceptable;
+    }
+    start = end + 1;
+  }
+  return wildcard;
+}
+#endif
+
+void WebServer::send_static_resource_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data,
+                                      size_t size, const char *encoding, const char *hash, bool immutable) {
+  // Resources are hashed before compression, so the encoding is part of the ETag to keep it unique per representation
+  std::string etag = "\"";
+  etag += hash;
+  if (encoding != nullptr) {
+    etag += '-';
+    etag += encoding;
+  }
+  etag += '"';
+  const char *cache_control = immutable ? "public, max-age=31536000, immutable" : "no-cache";
+
+  AsyncWebServerResponse *response;
+  auto if_none_match = get_request_header(request, "If-None-Match");
+  if (if_none_match.has_value() && if_none_match->find(etag) != std::string::npos) {
+    response = request->beginResponse(304, "");
+  } else {
+    response = request->beginResponse_P(200, content_type, data, size);
+    if (encoding != nullptr)
+      response->addHeader("Content-Encoding", encoding);
+  }
+  response->addHeader("ETag", etag.c_str());
+  response->addHeader("Cache-Control", cache_control);
+#ifdef USE_WEBSERVER_BROTLI
+  response->addHeader("Vary", "Accept-Encoding");
+#endif
+  request->send(response);
+}
+
 #ifdef USE_WEBSERVER_LOCAL
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
-  AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
-  response->addHeader("Content-Encoding", "gzip");
-  request->send(response);
+#ifdef USE_WEBSERVER_BROTLI
+  if (accepts_brotli(request)) {
+    this->send_static_resource_(request, "text/html", ESPHOME_WEBSERVER_INDEX_BR, ESPHOME_WEBSERVER_INDEX_BR_SIZE,
+                                "br", ESPHOME_WEBSERVER_INDEX_HASH, false);
+    return;
+  }
+#endif
+  this->send_static_resource_(request, "text/html", ESPHOME_WEBSERVER_INDEX_GZ, ESPHOME_WEBSERVER_INDEX_GZ_SIZE, "gzip",
+                              ESPHOME_WEBSERVER_INDEX_HASH, false);
 }
 #elif USE_WEBSERVER_VERSION == 1
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
@@ -185,7 +369,9 @@ void WebServer::handle_index_request(AsyncWebServerRequest *request) {
   stream->print(title.c_str());
   stream->print(F("</title>"));
 #ifdef USE_WEBSERVER_CSS_INCLUDE
-  stream->print(F("<link rel=\"stylesheet\" href=\"/0.css\">"));
+  stream->print(F("<link rel=\"stylesheet\" href=\"/0.css?v="));
+  stream->print(ESPHOME_WEBSERVER_CSS_INCLUDE_HASH);
+  stream->print(F("\">"));
 #endif
   if (strlen(this->css_url_) > 0) {
     stream->print(F(R"(<link rel="stylesheet" href=")"));
@@ -346,7 +532,9 @@ void WebServer::handle_index_request(AsyncWebServerRequest *request) {
   stream->print(F("<h2>Debug Log</h2><pre id=\"log\"></pre>"));
 #ifdef USE_WEBSERVER_JS_INCLUDE
   if (this->js_include_ != nullptr) {
-    stream->print(F("<script type=\"module\" src=\"/0.js\"></script>"));
+    stream->print(F("<script type=\"module\" src=\"/0.js?v="));
+    stream->print(ESPHOME_WEBSERVER_JS_INCLUDE_HASH);
+    stream->print(F("\"></script>"));
   }
 #endif
   if (strlen(this->js_url_) > 0) {
@@ -359,10 +547,9 @@ void WebServer::handle_index_request(AsyncWebServerRequest *request) {
 }
 #elif USE_WEBSERVER_VERSION == 2
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
-  // No gzip header here because the HTML file is so small
-  request->send(response);
+  // No gzip here because the HTML file is so small
+  this->send_static_resource_(request, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE,
+                              nullptr, ESPHOME_WEBSERVER_INDEX_HTML_HASH, false);
 }
 #endif
 
@@ -379,19 +566,29 @@ void WebServer::handle_pna_cors_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 void WebServer::handle_css_request(AsyncWebServerRequest *request) {
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
-  response->addHeader("Content-Encoding", "gzip");
-  request->send(response);
+#ifdef USE_WEBSERVER_BROTLI
+  if (accepts_brotli(request)) {
+    this->send_static_resource_(request, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE_BR,
+                                ESPHOME_WEBSERVER_CSS_INCLUDE_BR_SIZE, "br", ESPHOME_WEBSERVER_CSS_INCLUDE_HASH, true);
+    return;
+  }
+#endif
+  this->send_static_resource_(request, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE,
+                              "gzip", ESPHOME_WEBSERVER_CSS_INCLUDE_HASH, true);
 }
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
-  response->addHeader("Content-Encoding", "gzip");
-  request->send(response);
+#ifdef USE_WEBSERVER_BROTLI
+  if (accepts_brotli(request)) {
+    this->send_static_resource_(request, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE_BR,
+                                ESPHOME_WEBSERVER_JS_INCLUDE_BR_SIZE, "br", ESPHOME_WEBSERVER_JS_INCLUDE_HASH, true);
+    return;
+  }
+#endif
+  this->send_static_resource_(request, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE,
+                              ESPHOME_WEBSERVER_JS_INCLUDE_SIZE, "gzip", ESPHOME_WEBSERVER_JS_INCLUDE_HASH, true);
 }
 #endif
 
@@ -415,6 +612,8 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
+  if (this->queue_state_event_(obj, StateEventType::SENSOR))
+    return;
   this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -448,6 +647,8 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
+  if (this->queue_state_event_(obj, StateEventType::TEXT_SENSOR))
+    return;
   this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -470,6 +671,8 @@ std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std:
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
+  if (this->queue_state_event_(obj, StateEventType::SWITCH))
+    return;
   this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
@@ -531,6 +734,8 @@ void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlM
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
+  if (this->queue_state_event_(obj, StateEventType::BINARY_SENSOR))
+    return;
   this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
@@ -552,7 +757,11 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, con
 #endif
 
 #ifdef USE_FAN
-void WebServer::on_fan_update(fan::Fan *obj) { this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state"); }
+void WebServer::on_fan_update(fan::Fan *obj) {
+  if (this->queue_state_event_(obj, StateEventType::FAN))
+    return;
+  this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state");
+}
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
   return json::build_json([obj, start_config](JsonObject root) {
     set_json_icon_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state,
@@ -622,6 +831,8 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatc
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
+  if (this->queue_state_event_(obj, StateEventType::LIGHT))
+    return;
   this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -728,6 +939,8 @@ std::string WebServer::light_json(light::LightState *obj, JsonDetail start_confi
 
 #ifdef USE_COVER
 void WebServer::on_cover_update(cover::Cover *obj) {
+  if (this->queue_state_event_(obj, StateEventType::COVER))
+    return;
   this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -797,6 +1010,8 @@ std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
+  if (this->queue_state_event_(obj, StateEventType::NUMBER))
+    return;
   this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -855,6 +1070,8 @@ std::string WebServer::number_json(number::Number *obj, float value, JsonDetail
 
 #ifdef USE_TEXT
 void WebServer::on_text_update(text::Text *obj, const std::string &state) {
+  if (this->queue_state_event_(obj, StateEventType::TEXT))
+    return;
   this->events_.send(this->text_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -906,6 +1123,8 @@ std::string WebServer::text_json(text::Text *obj, const std::string &value, Json
 
 #ifdef USE_SELECT
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
+  if (this->queue_state_event_(obj, StateEventType::SELECT))
+    return;
   this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -960,6 +1179,8 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 
 #ifdef USE_CLIMATE
 void WebServer::on_climate_update(climate::Climate *obj) {
+  if (this->queue_state_event_(obj, StateEventType::CLIMATE))
+    return;
   this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
 }
 
@@ -1101,6 +1322,8 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
 
 #ifdef USE_LOCK
 void WebServer::on_lock_update(lock::Lock *obj) {
+  if (this->queue_state_event_(obj, StateEventType::LOCK))
+    return;
   this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
@@ -1137,6 +1360,8 @@ void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMat
 
 #ifdef USE_ALARM_CONTROL_PANEL
 void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
+  if (this->queue_state_event_(obj, StateEventType::ALARM_CONTROL_PANEL))
+    return;
   this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
 }
 std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
@@ -1164,18 +1389,21 @@ void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *reques
 #endif
 
 bool WebServer::canHandle(AsyncWebServerRequest *request) {
-  if (request->url() == "/")
-    return true;
-
+  bool static_resource = request->url() == "/";
 #ifdef USE_WEBSERVER_CSS_INCLUDE
-  if (request->url() == "/0.css")
-    return true;
+  static_resource |= request->url() == "/0.css";
 #endif
-
 #ifdef USE_WEBSERVER_JS_INCLUDE
-  if (request->url() == "/0.js")
-    return true;
+  static_resource |= request->url() == "/0.js";
+#endif
+  if (static_resource) {
+#ifdef USE_ARDUINO
+    // Keep the headers needed for conditional and compressed responses, see the PNA comment below.
+    request->addInterestingHeader("If-None-Match");
+    request->addInterestingHeader("Accept-Encoding");
 #endif
+    return true;
+  }
 
 #ifdef USE_WEBSERVER_PRIVATE_NETWORK_ACCESS
   if (request->method() == HTTP_OPTIONS && request->hasHeader(HEADER_CORS_REQ_PNA)) {
@@ -16,16 +16,37 @@
 #if USE_WEBSERVER_VERSION == 2
 extern const uint8_t ESPHOME_WEBSERVER_INDEX_HTML[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_INDEX_HTML_SIZE;
+extern const char ESPHOME_WEBSERVER_INDEX_HTML_HASH[];
+#endif
+
+#ifdef USE_WEBSERVER_LOCAL
+extern const uint8_t ESPHOME_WEBSERVER_INDEX_GZ[] PROGMEM;
+extern const size_t ESPHOME_WEBSERVER_INDEX_GZ_SIZE;
+extern const char ESPHOME_WEBSERVER_INDEX_HASH[];
+#ifdef USE_WEBSERVER_BROTLI
+extern const uint8_t ESPHOME_WEBSERVER_INDEX_BR[] PROGMEM;
+extern const size_t ESPHOME_WEBSERVER_INDEX_BR_SIZE;
+#endif
 #endif
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_CSS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_CSS_INCLUDE_HASH[];
+#ifdef USE_WEBSERVER_BROTLI
+extern const uint8_t ESPHOME_WEBSERVER_CSS_INCLUDE_BR[] PROGMEM;
+extern const size_t ESPHOME_WEBSERVER_CSS_INCLUDE_BR_SIZE;
+#endif
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_JS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_JS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_JS_INCLUDE_HASH[];
+#ifdef USE_WEBSERVER_BROTLI
+extern const uint8_t ESPHOME_WEBSERVER_JS_INCLUDE_BR[] PROGMEM;
+extern const size_t ESPHOME_WEBSERVER_JS_INCLUDE_BR_SIZE;
+#endif
 #endif
 
 namespace esphome {
@@ -102,6 +123,14 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    * @param expose_log.
    */
   void set_expose_log(bool expose_log) { this->expose_log_ = expose_log; }
+  /** Set the minimum interval between two flushes of state events.
+   *
+   * When set, state changes are not sent immediately. Instead only the newest pending state of each entity is
+   * kept, and all pending entities are sent together at most once per interval. Defaults to 0 (send immediately).
+   *
+   * @param event_interval The minimum interval in ms.
+   */
+  void set_event_interval(uint32_t event_interval) { this->event_interval_ = event_interval; }
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -277,6 +306,41 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool isRequestHandlerTrivial() override;
 
  protected:
+  enum class StateEventType : uint8_t {
+    SENSOR,
+    TEXT_SENSOR,
+    SWITCH,
+    BINARY_SENSOR,
+    FAN,
+    LIGHT,
+    COVER,
+    NUMBER,
+    TEXT,
+    SELECT,
+    CLIMATE,
+    LOCK,
+    ALARM_CONTROL_PANEL,
+  };
+  struct PendingStateEvent {
+    EntityBase *obj;
+    StateEventType type;
+  };
+
+  /// Queue a state event of obj if coalescing is enabled. Returns false if the event should be sent right away.
+  bool queue_state_event_(EntityBase *obj, StateEventType type);
+  /// Send the current state of all entities with pending state events.
+  void flush_state_events_();
+  /// Build the state JSON of a pending entity from its current state.
+  std::string state_event_json_(const PendingStateEvent &event);
+
+  /** Send a static resource from progmem along with its ETag and caching headers.
+   *
+   * Replies with 304 Not Modified instead if the ETag is in the request's If-None-Match header. Immutable resources
+   * are only referenced by URLs containing their hash, so browsers can cache them without ever revalidating.
+   */
+  void send_static_resource_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data,
+                             size_t size, const char *encoding, const char *hash, bool immutable);
+
   void schedule_(std::function<void()> &&f);
   friend ListEntitiesIterator;
   web_server_base::WebServerBase *base_;
@@ -295,6 +359,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool include_internal_{false};
   bool allow_ota_{true};
   bool expose_log_{true};
+  uint32_t event_interval_{0};
+  uint32_t last_event_flush_{0};
+  std::vector<PendingStateEvent> pending_state_events_;
 #ifdef USE_ESP32
   std::deque<std::function<void()>> to_schedule_;
   SemaphoreHandle_t to_schedule_lock_;
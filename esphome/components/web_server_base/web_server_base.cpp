@@ -10,6 +10,7 @@
 #endif
 #ifdef USE_ESP8266
 #include <Updater.h>
+#include "esphome/components/esp8266/preferences.h"
 #endif
 #endif
 
@@ -38,6 +39,14 @@ void report_ota_error() {
 #endif
 }
 
+#ifdef USE_ARDUINO
+static void allow_preferences_write() {
+#ifdef USE_ESP8266
+  esp8266::preferences_prevent_write(false);
+#endif
+}
+#endif
+
 void OTARequestHandler::handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index,
                                      uint8_t *data, size_t len, bool final) {
 #ifdef USE_ARDUINO
@@ -49,6 +58,10 @@ void OTARequestHandler::handleUpload(AsyncWebServerRequest *request, const Strin
     Update.runAsync(true);
     // NOLINTNEXTLINE(readability-static-accessed-through-instance)
     success = Update.begin((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000);
+    if (success) {
+      // The image is staged where the preferences log may be, keep it out of there until restart
+      esp8266::preferences_prevent_write(true);
+    }
 #endif
 #if defined(USE_ESP32_FRAMEWORK_ARDUINO) || defined(USE_LIBRETINY)
     if (Update.isRunning()) {
@@ -68,6 +81,7 @@ void OTARequestHandler::handleUpload(AsyncWebServerRequest *request, const Strin
   success = Update.write(data, len) == len;
   if (!success) {
     report_ota_error();
+    allow_preferences_write();
     return;
   }
   this->ota_read_length_ += len;
@@ -89,6 +103,7 @@ void OTARequestHandler::handleUpload(AsyncWebServerRequest *request, const Strin
       this->parent_->set_timeout(100, []() { App.safe_reboot(); });
     } else {
       report_ota_error();
+      allow_preferences_write();
     }
   }
 #endif
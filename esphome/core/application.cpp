@@ -2,6 +2,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/metrics.h"
 
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
@@ -68,9 +69,14 @@ void Application::loop() {
 
   this->scheduler.call();
   this->feed_wdt();
-  for (Component *component : this->looping_components_) {
+  for (size_t i = 0; i < this->looping_components_.size(); i++) {
+    Component *component = this->looping_components_[i];
     {
+#ifdef USE_RUNTIME_METRICS
+      WarnIfComponentBlockingGuard guard{component, metrics::global_metrics.get_component_loop_time(i)};
+#else
       WarnIfComponentBlockingGuard guard{component};
+#endif
       component->call();
     }
     new_app_state |= component->get_component_state();
@@ -150,6 +156,9 @@ void Application::calculate_looping_components_() {
     if (obj->has_overridden_loop())
       this->looping_components_.push_back(obj);
   }
+#ifdef USE_RUNTIME_METRICS
+  metrics::global_metrics.register_looping_components(this->looping_components_);
+#endif
 }
 
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -4,6 +4,7 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include "esphome/core/metrics.h"
 #include <utility>
 
 namespace esphome {
@@ -206,12 +207,20 @@ uint32_t PollingComponent::get_update_interval() const { return this->update_int
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
 WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
-    : started_(millis()), component_(component) {}
+    : started_(micros()), component_(component) {}
+#ifdef USE_RUNTIME_METRICS
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, metrics::Histogram *histogram)
+    : started_(micros()), component_(component), histogram_(histogram) {}
+#endif
 WarnIfComponentBlockingGuard::~WarnIfComponentBlockingGuard() {
-  uint32_t now = millis();
-  if (now - started_ > 50) {
+  uint32_t duration = micros() - started_;
+#ifdef USE_RUNTIME_METRICS
+  if (this->histogram_ != nullptr)
+    this->histogram_->record(duration);
+#endif
+  if (duration > 50000) {
     const char *src = component_ == nullptr ? "<null>" : component_->get_component_source();
-    ESP_LOGW(TAG, "Component %s took a long time for an operation (%.2f s).", src, (now - started_) / 1e3f);
+    ESP_LOGW(TAG, "Component %s took a long time for an operation (%.2f s).", src, duration / 1e6f);
     ESP_LOGW(TAG, "Components should block for at most 20-30ms.");
     ;
   }
@@ -5,6 +5,7 @@
 #include <functional>
 #include <string>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -319,14 +320,25 @@ class PollingComponent : public Component {
   uint32_t update_interval_;
 };
 
+namespace metrics {
+class Histogram;
+}  // namespace metrics
+
 class WarnIfComponentBlockingGuard {
  public:
   WarnIfComponentBlockingGuard(Component *component);
+#ifdef USE_RUNTIME_METRICS
+  /// Additionally record the measured duration into the given histogram (may be nullptr).
+  WarnIfComponentBlockingGuard(Component *component, metrics::Histogram *histogram);
+#endif
   ~WarnIfComponentBlockingGuard();
 
  protected:
   uint32_t started_;
   Component *component_;
+#ifdef USE_RUNTIME_METRICS
+  metrics::Histogram *histogram_{nullptr};
+#endif
 };
 
 }  // namespace esphome
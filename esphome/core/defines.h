@@ -32,6 +32,7 @@
 #define USE_LOGGER
 #define USE_MDNS
 #define USE_MEDIA_PLAYER
+#define USE_MODBUS_RTU
 #define USE_MQTT
 #define USE_NUMBER
 #define USE_OTA
@@ -41,6 +42,7 @@
 #define USE_OUTPUT
 #define USE_POWER_SUPPLY
 #define USE_QR_CODE
+#define USE_RUNTIME_METRICS
 #define USE_SELECT
 #define USE_SENSOR
 #define USE_STATUS_LED
@@ -0,0 +1,83 @@
+#include "esphome/core/metrics.h"
+
+#ifdef USE_RUNTIME_METRICS
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+namespace metrics {
+
+const uint32_t Histogram::BUCKET_BOUNDS[Histogram::BUCKET_COUNT - 1] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000,
+};
+
+void HOT Histogram::record(uint32_t value_us) {
+  uint8_t i = 0;
+  while (i < BUCKET_COUNT - 1 && value_us > BUCKET_BOUNDS[i])
+    i++;
+  this->buckets_[i]++;
+  this->count_++;
+  this->sum_ += value_us;
+  if (value_us > this->max_)
+    this->max_ = value_us;
+}
+
+void Histogram::reset() { *this = Histogram(); }
+
+uint32_t Histogram::get_percentile(float quantile) const {
+  if (this->count_ == 0)
+    return 0;
+  // rank of the requested sample, 1-based
+  uint32_t rank = (uint32_t) ceilf(quantile * this->count_);
+  if (rank == 0)
+    rank = 1;
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i < BUCKET_COUNT - 1; i++) {
+    cumulative += this->buckets_[i];
+    if (cumulative >= rank)
+      return std::min(BUCKET_BOUNDS[i], this->max_);
+  }
+  return this->max_;
+}
+
+void MetricsRegistry::register_looping_components(const std::vector<Component *> &components) {
+  this->components_.clear();
+  this->components_.reserve(components.size());
+  for (auto *component : components)
+    this->components_.push_back(ComponentMetrics{component, {}});
+}
+
+std::string ComponentMetrics::describe() const { return this->component->get_component_source(); }
+
+std::string SchedulerItemMetrics::describe() const {
+  std::string ret = this->component == nullptr ? "<null>" : this->component->get_component_source();
+  ret += '/';
+  ret += this->name.empty() ? "<anonymous>" : this->name;
+  return ret;
+}
+
+Histogram *MetricsRegistry::get_scheduler_item_run_time(Component *component, const std::string &name) {
+  for (auto &item : this->scheduler_items_) {
+    if (item.component == component && item.name == name)
+      return &item.run_time;
+  }
+  if (this->scheduler_items_.size() >= MAX_SCHEDULER_ITEMS) {
+    this->scheduler_items_untracked++;
+    return nullptr;
+  }
+  if (this->scheduler_items_.empty())
+    this->scheduler_items_.reserve(MAX_SCHEDULER_ITEMS);
+  this->scheduler_items_.push_back(SchedulerItemMetrics{component, name, {}});
+  return &this->scheduler_items_.back().run_time;
+}
+
+MetricsRegistry global_metrics;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace metrics
+}  // namespace esphome
+
+#endif  // USE_RUNTIME_METRICS
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_RUNTIME_METRICS
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+
+class Component;
+
+namespace metrics {
+
+/** A histogram of durations in microseconds with fixed bucket bounds.
+ *
+ * Recording a value is a short linear search over the bucket bounds plus a couple of additions, so it is
+ * cheap enough to be done around every component loop() call. The bucket counts are stored non-cumulatively,
+ * exporters have to sum them up if their format requires cumulative buckets (like Prometheus).
+ */
+class Histogram {
+ public:
+  /// Number of buckets, the last one being the overflow (+Inf) bucket.
+  static const uint8_t BUCKET_COUNT = 11;
+  /// Inclusive upper bounds of all buckets but the last in microseconds.
+  static const uint32_t BUCKET_BOUNDS[BUCKET_COUNT - 1];
+
+  void record(uint32_t value_us);
+  void reset();
+
+  /** Estimate a percentile from the bucket counts.
+   *
+   * @param quantile The quantile to estimate, between 0 and 1 (e.g. 0.99).
+   * @return The upper bound of the bucket containing the quantile in microseconds, capped at the recorded maximum.
+   */
+  uint32_t get_percentile(float quantile) const;
+
+  uint32_t get_bucket(uint8_t index) const { return this->buckets_[index]; }
+  uint32_t get_count() const { return this->count_; }
+  uint64_t get_sum() const { return this->sum_; }
+  uint32_t get_max() const { return this->max_; }
+
+ protected:
+  uint32_t buckets_[BUCKET_COUNT]{};
+  uint32_t count_{0};
+  uint32_t max_{0};
+  uint64_t sum_{0};
+};
+
+/// Bookkeeping of a single looping component.
+struct ComponentMetrics {
+  Component *component;
+  Histogram loop_time;
+
+  /// Human-readable description (the component source) of the component.
+  std::string describe() const;
+};
+
+/// Bookkeeping of a named scheduler item (timeout/interval) of a component.
+struct SchedulerItemMetrics {
+  Component *component;
+  std::string name;
+  Histogram run_time;
+
+  /// Human-readable "component_source/item_name" description of the item.
+  std::string describe() const;
+};
+
+/** Registry for the device's own performance telemetry.
+ *
+ * Populated by the core (application loop, scheduler) and some components (API, logger) while running and
+ * read by exporters like the prometheus component. All members but log_lines must only be accessed from the main
+ * loop.
+ */
+class MetricsRegistry {
+ public:
+  /// Set up one loop-time histogram per looping component, in the same order as the application loops over them.
+  void register_looping_components(const std::vector<Component *> &components);
+
+  Histogram *get_component_loop_time(size_t index) { return &this->components_[index].loop_time; }
+  const std::vector<ComponentMetrics> &get_components() const { return this->components_; }
+
+  /** Get the histogram for the run time of a scheduler item, creating it if it does not exist yet.
+   *
+   * Items are identified by their component and name. The table has a fixed size, when it is full nullptr is
+   * returned and the item is only counted in scheduler_items_untracked.
+   */
+  Histogram *get_scheduler_item_run_time(Component *component, const std::string &name);
+  const std::vector<SchedulerItemMetrics> &get_scheduler_items() const { return this->scheduler_items_; }
+
+  /// Maximum number of distinct scheduler items tracked.
+  static const uint8_t MAX_SCHEDULER_ITEMS = 32;
+
+  Histogram scheduler_lateness;
+  uint32_t scheduler_items{0};
+  uint32_t scheduler_executed{0};
+  uint32_t scheduler_items_untracked{0};
+
+  uint32_t api_messages_sent{0};
+  uint32_t api_messages_dropped{0};
+  /// 64 bit, a busy connection would wrap 32 bits within days
+  uint64_t api_bytes_sent{0};
+
+  /// Incremented by every task that logs
+  std::atomic<uint32_t> log_lines{0};
+
+ protected:
+  std::vector<ComponentMetrics> components_;
+  std::vector<SchedulerItemMetrics> scheduler_items_;
+};
+
+extern MetricsRegistry global_metrics;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace metrics
+}  // namespace esphome
+
+#endif  // USE_RUNTIME_METRICS
@@ -3,9 +3,10 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
-#ifdef USE_ESP32
+#if defined(USE_ESP32) || defined(USE_HOST)
 
-#include "helpers.h"
+#include <algorithm>
+#include <cstring>
 
 namespace esphome {
 
@@ -15,35 +16,88 @@ std::unique_ptr<RingBuffer> RingBuffer::create(size_t len) {
   std::unique_ptr<RingBuffer> rb = make_unique<RingBuffer>();
 
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
-  rb->storage_ = allocator.allocate(len + 1);
+  rb->storage_ = allocator.allocate(len);
   if (rb->storage_ == nullptr) {
     return nullptr;
   }
+  rb->size_ = len;
 
-  rb->handle_ = xStreamBufferCreateStatic(len + 1, 0, rb->storage_, &rb->structure_);
-  ESP_LOGD(TAG, "Created ring buffer with size %u", len);
+  ESP_LOGD(TAG, "Created ring buffer with size %zu", len);
   return rb;
 }
 
-size_t RingBuffer::read(void *data, size_t len, TickType_t ticks_to_wait) {
-  return xStreamBufferReceive(this->handle_, data, len, ticks_to_wait);
+RingBuffer::~RingBuffer() {
+  if (this->storage_ != nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    allocator.deallocate(this->storage_, this->size_);
+  }
+}
+
+size_t RingBuffer::read(void *data, size_t len) {
+  size_t read = this->peek(data, len);
+  this->consume(read);
+  return read;
+}
+
+size_t RingBuffer::peek(void *data, size_t len) const {
+  len = std::min(len, this->available());
+  size_t first = std::min(len, this->size_ - this->read_pos_);
+  memcpy(data, this->storage_ + this->read_pos_, first);
+  memcpy(static_cast<uint8_t *>(data) + first, this->storage_, len - first);
+  return len;
+}
+
+size_t RingBuffer::write(const void *data, size_t len) {
+  if (this->size_ == 0)
+    return 0;
+  if (len > this->size_) {
+    // only the newest data fits
+    data = static_cast<const uint8_t *>(data) + (len - this->size_);
+    len = this->size_;
+  }
+  size_t written = 0;
+  while (written < len) {
+    Span span = this->acquire_write(len - written, true);
+    memcpy(span.data, static_cast<const uint8_t *>(data) + written, span.len);
+    this->commit(span.len);
+    written += span.len;
+  }
+  return written;
 }
 
-size_t RingBuffer::write(void *data, size_t len) {
-  size_t free = this->free();
-  if (free < len) {
-    size_t needed = len - free;
-    uint8_t discard[needed];
-    xStreamBufferReceive(this->handle_, discard, needed, 0);
+RingBuffer::Span RingBuffer::acquire_write(size_t max_len, bool discard_oldest) {
+  size_t space = this->free();
+  if (discard_oldest && space < max_len) {
+    this->consume(std::min(max_len, this->size_) - space);
+    space = this->free();
   }
-  return xStreamBufferSend(this->handle_, data, len, 0);
+  return {this->storage_ + this->write_pos_, std::min({max_len, space, this->size_ - this->write_pos_})};
 }
 
-size_t RingBuffer::available() const { return xStreamBufferBytesAvailable(this->handle_); }
+void RingBuffer::commit(size_t len) {
+  this->write_pos_ += len;
+  if (this->write_pos_ >= this->size_)
+    this->write_pos_ -= this->size_;
+  // release: the written bytes are visible before the consumer sees the new count
+  this->count_.fetch_add(len, std::memory_order_release);
+}
 
-size_t RingBuffer::free() const { return xStreamBufferSpacesAvailable(this->handle_); }
+RingBuffer::Span RingBuffer::peek_read(size_t max_len) const {
+  return {this->storage_ + this->read_pos_, std::min({max_len, this->available(), this->size_ - this->read_pos_})};
+}
 
-BaseType_t RingBuffer::reset() { return xStreamBufferReset(this->handle_); }
+void RingBuffer::consume(size_t len) {
+  this->read_pos_ += len;
+  if (this->read_pos_ >= this->size_)
+    this->read_pos_ -= this->size_;
+  this->count_.fetch_sub(len, std::memory_order_acq_rel);
+}
+
+void RingBuffer::reset() {
+  this->read_pos_ = 0;
+  this->write_pos_ = 0;
+  this->count_.store(0, std::memory_order_release);
+}
 
 }  // namespace esphome
 
@@ -1,32 +1,72 @@
 #pragma once
 
-#ifdef USE_ESP32
-
-#include <freertos/FreeRTOS.h>
-#include <freertos/stream_buffer.h>
+#if defined(USE_ESP32) || defined(USE_HOST)
 
+#include <atomic>
 #include <cinttypes>
+#include <cstddef>
 #include <memory>
 
 namespace esphome {
 
+/** Single-producer single-consumer byte ring buffer.
+ *
+ * Besides the copying read() and write(), contiguous regions can be handed out so that producers fill the buffer
+ * in place (acquire_write() and commit()) and consumers process it in place (peek_read() and consume()). The read
+ * and write positions are owned by one side each, the shared fill level is an atomic, so the producer and consumer
+ * may run in different tasks without locking.
+ *
+ * write() and acquire_write() with discard_oldest drop the oldest data to make room, that moves the read position
+ * and is only safe when the consumer doesn't run concurrently (like the audio components which do both from loop()).
+ */
 class RingBuffer {
  public:
-  size_t read(void *data, size_t len, TickType_t ticks_to_wait = 0);
+  /// A contiguous region of the buffer.
+  struct Span {
+    uint8_t *data{nullptr};
+    size_t len{0};
+  };
+
+  /// Read up to len bytes, without waiting for data.
+  size_t read(void *data, size_t len);
+  /// Copy up to len bytes without consuming them.
+  size_t peek(void *data, size_t len) const;
+
+  /// Write len bytes, dropping the oldest data if there isn't enough room.
+  size_t write(const void *data, size_t len);
 
-  size_t write(void *data, size_t len);
+  /// Get the contiguous free region at the write position, at most max_len bytes. It's shorter when the region
+  /// wraps around the end of the buffer, the rest is handed out by the next call after commit(). With discard_oldest
+  /// the oldest data is dropped first if less than max_len bytes are free.
+  Span acquire_write(size_t max_len, bool discard_oldest = false);
+  /// Make len bytes written to the region of acquire_write() available to the consumer.
+  void commit(size_t len);
 
-  size_t available() const;
-  size_t free() const;
+  /// Get the contiguous readable region at the read position, at most max_len bytes. Like with acquire_write() it's
+  /// shorter when the data wraps around the end of the buffer.
+  Span peek_read(size_t max_len) const;
+  /// Drop len bytes at the read position, after they have been processed in place.
+  void consume(size_t len);
 
-  BaseType_t reset();
+  size_t available() const { return this->count_.load(std::memory_order_acquire); }
+  size_t free() const { return this->size_ - this->available(); }
+  size_t capacity() const { return this->size_; }
+
+  /// Drop all data. Neither side may use the buffer at the same time.
+  void reset();
 
   static std::unique_ptr<RingBuffer> create(size_t len);
 
+  ~RingBuffer();
+
  protected:
-  StreamBufferHandle_t handle_;
-  StaticStreamBuffer_t structure_;
-  uint8_t *storage_;
+  uint8_t *storage_{nullptr};
+  size_t size_{0};
+  /// Owned by the consumer
+  size_t read_pos_{0};
+  /// Owned by the producer
+  size_t write_pos_{0};
+  std::atomic<size_t> count_{0};
 };
 
 }  // namespace esphome
@@ -226,11 +226,30 @@ void HOT Scheduler::call() {
                 item->get_type_str(), item->name.c_str(), item->interval, item->last_execution, now);
 #endif
 
+#ifdef USE_RUNTIME_METRICS
+      if (!item->run_time_resolved) {
+        item->run_time = metrics::global_metrics.get_scheduler_item_run_time(item->component, item->name);
+        item->run_time_resolved = true;
+      }
+      {
+        // Measured in microseconds, most of the lateness is below a millisecond. millis() and micros() share their
+        // time base, so the due time converts exactly.
+        const uint64_t due_ms = (uint64_t(major) << 32) | item->next_execution();
+        const int32_t lateness_us = int32_t(micros() - uint32_t(due_ms * 1000));
+        metrics::global_metrics.scheduler_lateness.record(std::max<int32_t>(lateness_us, 0));
+      }
+      metrics::global_metrics.scheduler_executed++;
+#endif
+
       // Warning: During callback(), a lot of stuff can happen, including:
       //  - timeouts/intervals get added, potentially invalidating vector pointers
       //  - timeouts/intervals get cancelled
       {
+#ifdef USE_RUNTIME_METRICS
+        WarnIfComponentBlockingGuard guard{item->component, item->run_time};
+#else
         WarnIfComponentBlockingGuard guard{item->component};
+#endif
         item->callback();
       }
     }
@@ -267,6 +286,9 @@ void HOT Scheduler::call() {
   }
 
   this->process_to_add();
+#ifdef USE_RUNTIME_METRICS
+  metrics::global_metrics.scheduler_items = this->items_.size() - this->to_remove_;
+#endif
 }
 void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
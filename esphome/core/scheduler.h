@@ -5,6 +5,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/metrics.h"
 
 namespace esphome {
 
@@ -40,6 +41,11 @@ class Scheduler {
     std::function<void()> callback;
     bool remove;
     uint8_t last_execution_major;
+#ifdef USE_RUNTIME_METRICS
+    // Looked up lazily from the loop task, as items can be created from other tasks
+    bool run_time_resolved{false};
+    metrics::Histogram *run_time{nullptr};
+#endif
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
     inline uint8_t next_execution_major() {
@@ -0,0 +1,166 @@
+// Replays scan results through the two ways the proxy encodes raw advertisements: building a
+// BluetoothLERawAdvertisementsResponse per tracker batch like before, and encoding each scan result straight into the
+// reserved batch buffer like BluetoothProxy::encode_raw_advertisement_(). bluetooth_proxy.cpp needs the ESP-IDF BLE
+// headers, so the encoding is repeated here field by field. Counts the heap allocations of both, checks that the
+// batches decode back to the same advertisements and times them.
+
+#include "esphome/components/api/api_pb2.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <vector>
+
+static size_t allocations = 0;
+void *operator new(size_t size) {
+  allocations++;
+  if (void *p = malloc(size))
+    return p;
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+namespace esphome {
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome::api;
+
+// The fields of esp_ble_gap_cb_param_t::ble_scan_result_evt_param the proxy uses
+struct ScanResult {
+  uint8_t bda[6];
+  int rssi;
+  uint8_t ble_addr_type;
+  uint8_t ble_adv[62];
+  uint8_t adv_data_len;
+  uint8_t scan_rsp_len;
+};
+
+// Same values as in bluetooth_proxy.h
+static const uint8_t RAW_ADVERTISEMENTS_BATCH_SIZE = 16;
+static const uint8_t RAW_ADVERTISEMENT_MAX_ENCODED_SIZE = 79;
+// The tracker hands over a couple of scan results at a time
+static const size_t TRACKER_BATCH = 2;
+static const size_t ADVERTISEMENTS = 1000;
+
+static uint64_t address(const ScanResult &result) {
+  uint64_t u = 0;
+  for (uint8_t b : result.bda)
+    u = (u << 8) | b;
+  return u;
+}
+
+// Before: a response with a data string per advertisement for every tracker batch
+static void encode_messages(const std::vector<ScanResult> &results, std::vector<uint8_t> &out) {
+  std::vector<uint8_t> frame;
+  for (size_t i = 0; i < results.size(); i += TRACKER_BATCH) {
+    BluetoothLERawAdvertisementsResponse resp;
+    for (size_t j = i; j < i + TRACKER_BATCH && j < results.size(); j++) {
+      auto &result = results[j];
+      BluetoothLERawAdvertisement adv;
+      adv.address = address(result);
+      adv.rssi = result.rssi;
+      adv.address_type = result.ble_addr_type;
+      uint8_t length = result.adv_data_len + result.scan_rsp_len;
+      adv.data.reserve(length);
+      for (uint16_t k = 0; k < length; k++)
+        adv.data.push_back(result.ble_adv[k]);
+      resp.advertisements.push_back(std::move(adv));
+    }
+    frame.clear();
+    resp.encode(ProtoWriteBuffer(&frame));
+    out.insert(out.end(), frame.begin(), frame.end());
+  }
+}
+
+// After: straight into the batch buffer, sent every RAW_ADVERTISEMENTS_BATCH_SIZE advertisements
+static void encode_batched(const std::vector<ScanResult> &results, std::vector<uint8_t> &batch,
+                           std::vector<uint8_t> &out) {
+  uint8_t count = 0;
+  for (auto &result : results) {
+    ProtoWriteBuffer buffer(&batch);
+    buffer.encode_field_raw(1, 2);
+    const size_t length_index = batch.size();
+    buffer.write(0);
+    buffer.encode_uint64(1, address(result));
+    buffer.encode_sint32(2, result.rssi);
+    buffer.encode_uint32(3, result.ble_addr_type);
+    buffer.encode_bytes(4, result.ble_adv, result.adv_data_len + result.scan_rsp_len);
+    batch[length_index] = batch.size() - length_index - 1;
+    if (++count == RAW_ADVERTISEMENTS_BATCH_SIZE || &result == &results.back()) {
+      out.insert(out.end(), batch.begin(), batch.end());
+      batch.clear();
+      count = 0;
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  std::mt19937 rng(35);
+  std::vector<ScanResult> results(ADVERTISEMENTS);
+  for (auto &result : results) {
+    for (auto &b : result.bda)
+      b = rng();
+    result.rssi = -int(rng() % 100);
+    result.ble_addr_type = rng() % 2;
+    // Up to the 31 bytes of advertisement data and of scan response each
+    result.adv_data_len = 3 + rng() % 29;
+    result.scan_rsp_len = rng() % 2 ? rng() % 32 : 0;
+    for (auto &b : result.ble_adv)
+      b = rng();
+  }
+  results[0].adv_data_len = results[0].scan_rsp_len = 31;
+
+  const bool check = argc > 1 && strcmp(argv[1], "check") == 0;
+  const int rounds = check ? 1 : 200;
+  std::vector<uint8_t> batch;
+  batch.reserve(RAW_ADVERTISEMENTS_BATCH_SIZE * RAW_ADVERTISEMENT_MAX_ENCODED_SIZE);
+  std::vector<uint8_t> messages, batched;
+  messages.reserve(ADVERTISEMENTS * RAW_ADVERTISEMENT_MAX_ENCODED_SIZE);
+  batched.reserve(ADVERTISEMENTS * RAW_ADVERTISEMENT_MAX_ENCODED_SIZE);
+
+  size_t allocs[2];
+  double us[2];
+  for (int mode = 0; mode < 2; mode++) {
+    size_t before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+      auto &out = mode == 0 ? messages : batched;
+      out.clear();
+      if (mode == 0) {
+        encode_messages(results, out);
+      } else {
+        encode_batched(results, batch, out);
+      }
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    us[mode] = elapsed.count() / rounds;
+    allocs[mode] = (allocations - before) / rounds;
+  }
+
+  // Repeated fields concatenate, so both streams decode as one response
+  bool ok = allocs[1] == 0 && messages == batched;
+  BluetoothLERawAdvertisementsResponse decoded;
+  decoded.decode(batched.data(), batched.size());
+  ok &= decoded.advertisements.size() == results.size();
+  for (size_t i = 0; ok && i < results.size(); i++) {
+    auto &adv = decoded.advertisements[i];
+    auto &result = results[i];
+    size_t length = result.adv_data_len + result.scan_rsp_len;
+    ok = adv.address == address(result) && adv.rssi == result.rssi && adv.address_type == result.ble_addr_type &&
+         adv.data.size() == length && memcmp(adv.data.data(), result.ble_adv, length) == 0;
+    if (!ok)
+      printf("advertisement %zu doesn't match\n", i);
+  }
+  printf("%zu advertisements, %zu per tracker batch: %zu allocations (%.0f/s at 100 adverts/s) %.1f us before, "
+         "%zu allocations %.1f us batched\n",
+         results.size(), TRACKER_BATCH, allocs[0], allocs[0] * 100.0 / results.size(), us[0], allocs[1], us[1]);
+  puts(ok ? "raw advertisements ok" : "raw advertisements FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,13 @@
+#!/usr/bin/env bash
+# Check that encoding raw advertisements straight into the batch gives the same payload without allocating under
+# ASan/UBSan, then compare its allocations and time with building the response messages
+source "$(dirname "$0")/../common.sh"
+
+srcs=("$here/raw_advertisements_bench.cpp" "$repo"/esphome/components/api/{api_pb2,proto}.cpp
+  "$repo"/esphome/core/{helpers,string_ref}.cpp)
+# encode_sint32() shifts negative values left, which GCC defines as two's complement
+g++ "${host_flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize=shift -fno-sanitize-recover=all "${srcs[@]}" \
+  -o "$build/test_asan"
+"$build/test_asan" check
+g++ "${host_flags[@]}" -O2 "${srcs[@]}" -o "$build/bench"
+"$build/bench"
@@ -0,0 +1,12 @@
+# Sourced by the run.sh of every host test: sets up the paths, a build directory that is removed on exit and the
+# compiler flags shared by the tests
+set -euo pipefail
+
+here="$(cd "$(dirname "${BASH_SOURCE[1]}")" && pwd)"
+repo="$(cd "$here/../../.." && pwd)"
+build="$(mktemp -d)"
+trap 'rm -rf "$build"' EXIT
+
+# The stub directory comes first, its defines.h replaces the one of the repo
+stub_flags=(-std=gnu++17 -I"$repo/tests/host/stub" -I"$repo")
+host_flags=("${stub_flags[@]}" -DUSE_HOST '-DUSE_ESPHOME_HOST_MAC_ADDRESS={0,0,0,0,0,0}')
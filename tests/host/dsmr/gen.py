@@ -0,0 +1,62 @@
+"""Generate the DSMR telegrams in telegrams.txt.
+
+They alternate between DSMR 4 and DSMR 5 meters with the usual electricity, voltage,
+current and gas lines, a long text message in every third one and a wrong CRC in
+every seventh one. The lines are stored with LF, the test sends them with CRLF like the
+meters do and the CRC is computed over that. Run it from this directory.
+"""
+
+import random
+
+
+def crc16(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+    return crc
+
+
+def telegram(i):
+    r = random.random
+    v5 = i % 2 == 1
+    message = "303132333435363738393A3B3C3D3E3F" * 4 if i % 3 == 0 else ""
+    lines = [
+        "/ISk5\\2MT382-1000" if v5 else "/KFM5KAIFA-METER",
+        "",
+        "1-3:0.2.8(%s)" % ("50" if v5 else "42"),
+        "0-0:1.0.0(1910%02d%02d%02d%02dS)" % (1 + i % 28, i % 24, i % 60, i % 60),
+        "0-0:96.1.1(4B384547303034303436333935353037)",
+        "1-0:1.8.1(%010.3f*kWh)" % (123456.789 + i * r()),
+        "1-0:1.8.2(%010.3f*kWh)" % (123456.789 + i * r()),
+        "1-0:2.8.1(%010.3f*kWh)" % (1234.5 + i * r()),
+        "1-0:2.8.2(%010.3f*kWh)" % (1234.5 + i * r()),
+        "0-0:96.14.0(%04d)" % (1 + i % 2),
+        "1-0:1.7.0(%06.3f*kW)" % (r() * 10),
+        "1-0:2.7.0(%06.3f*kW)" % r(),
+        "0-0:96.7.21(00004)",
+        "1-0:99.97.0(2)(0-0:96.7.19)(101208152415W)(0000000240*s)(101208151004W)"
+        "(0000000301*s)",
+        "1-0:32.32.0(00002)",
+        "1-0:32.7.0(%05.1f*V)" % (220 + r() * 20),
+        "1-0:52.7.0(%05.1f*V)" % (220 + r() * 20),
+        "1-0:72.7.0(%05.1f*V)" % (220 + r() * 20),
+        "1-0:31.7.0(%03d*A)" % (r() * 40),
+        "1-0:21.7.0(%06.3f*kW)" % (r() * 5),
+        "0-0:96.13.0(%s)" % message,
+        "0-1:24.1.0(003)",
+        "0-1:96.1.0(3232323241424344313233343536373839)",
+        "0-1:24.2.1(101209112500W)(%09.3f*m3)" % (12785.123 + i * r()),
+    ]
+    body = "\n".join(lines) + "\n!"
+    crc = crc16(body.replace("\n", "\r\n").encode())
+    if i % 7 == 6:
+        crc ^= 1
+    return body + "%04X\n" % crc
+
+
+random.seed(39)
+with open("telegrams.txt", "w") as f:
+    for i in range(20):
+        f.write(telegram(i) + "===\n")
@@ -0,0 +1,4 @@
+#pragma once
+// Only the type parameter of GCM, the cipher itself is in GCM.h
+
+class AES128 {};
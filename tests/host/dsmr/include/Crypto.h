@@ -0,0 +1,2 @@
+#pragma once
+// Stands in for rweather/Crypto, GCM.h has the part dsmr uses
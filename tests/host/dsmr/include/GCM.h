@@ -0,0 +1,35 @@
+#pragma once
+// GCM decryption like rweather/Crypto's, streaming and without checking the tag, on top of OpenSSL's AES-128-CTR
+
+#include <openssl/evp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+template<typename T> class GCM {
+ public:
+  GCM() { this->ctx_ = EVP_CIPHER_CTX_new(); }
+  ~GCM() { EVP_CIPHER_CTX_free(this->ctx_); }
+  size_t keySize() const { return 16; }
+  bool setKey(const uint8_t *key, size_t len) {
+    memcpy(this->key_, key, sizeof(this->key_));
+    return len == sizeof(this->key_);
+  }
+  bool setIV(const uint8_t *iv, size_t len) {
+    // The counter of the first block of ciphertext for a 96 bit IV
+    uint8_t counter[16] = {0};
+    memcpy(counter, iv, 12);
+    counter[15] = 2;
+    EVP_DecryptInit_ex(this->ctx_, EVP_aes_128_ctr(), nullptr, this->key_, counter);
+    return len == 12;
+  }
+  void decrypt(uint8_t *output, const uint8_t *input, size_t len) {
+    int output_len = 0;
+    EVP_DecryptUpdate(this->ctx_, output, &output_len, input, int(len));
+  }
+
+ private:
+  EVP_CIPHER_CTX *ctx_;
+  uint8_t key_[16];
+};
@@ -0,0 +1,11 @@
+#pragma once
+// Arduino's String, as far as the dsmr library uses it
+
+#include <string>
+
+class String : public std::string {
+ public:
+  using std::string::string;
+  String() = default;
+  String(const std::string &s) : std::string(s) {}
+};
@@ -0,0 +1,97 @@
+#pragma once
+// Stands in for the fields of the glmnet/Dsmr library: string fields and float fields taken from the last
+// parenthesised group (value*unit), enough for the telegrams of gen.py
+
+#include "parser.h"
+
+#include <type_traits>
+
+namespace dsmr {
+
+template<typename... Ts> struct ParsedData;
+
+template<> struct ParsedData<> {
+  ParseResult<void> parse_line(const ObisId &, const char *str, const char *) { return ParseResult<void>().until(str); }
+};
+
+template<typename T, typename... Ts> struct ParsedData<T, Ts...> : public T, public ParsedData<Ts...> {
+  ParseResult<void> parse_line(const ObisId &id, const char *str, const char *end) {
+    if (id == T::id) {
+      if (T::present())
+        return ParseResult<void>().fail("Duplicate field", str);
+      T::present() = true;
+      return this->T::parse(str, end);
+    }
+    return ParsedData<Ts...>::parse_line(id, str, end);
+  }
+};
+
+namespace fields {
+
+inline void assign_value(String &dest, const char *start, const char *end) { dest = String(start, end); }
+inline void assign_value(float &dest, const char *start, const char *end) {
+  const char *unit = static_cast<const char *>(memchr(start, '*', end - start));
+  dest = strtof(String(start, unit != nullptr ? unit : end).c_str(), nullptr);
+}
+
+template<bool IsString, uint8_t A, uint8_t B, uint8_t C, uint8_t D, uint8_t E, uint8_t F = 255> struct Field {
+  static constexpr ObisId id{A, B, C, D, E, F};
+
+  ParseResult<void> parse_value(typename std::conditional<IsString, String, float>::type &value, const char *str,
+                                const char *end) {
+    ParseResult<void> res;
+    // The identification line is the whole value
+    if (id == ObisId(255, 255, 255, 255, 255, 255)) {
+      assign_value(value, str, end);
+      return res.until(end);
+    }
+    const char *last_open = nullptr;
+    const char *last_close = nullptr;
+    for (const char *open = str; open < end;) {
+      if (*open != '(')
+        return res.fail("Missing (", open);
+      const char *close = static_cast<const char *>(memchr(open, ')', end - open));
+      if (close == nullptr)
+        return res.fail("Missing )", end);
+      last_open = open + 1;
+      last_close = close;
+      open = close + 1;
+    }
+    if (last_open == nullptr)
+      return res.fail("Missing (", str);
+    assign_value(value, last_open, last_close);
+    return res.until(end);
+  }
+};
+
+#define DSMR_STUB_FIELD(name, is_string, ...) \
+  struct name : Field<is_string, __VA_ARGS__> { \
+    std::conditional<is_string, String, float>::type name{}; \
+    bool name##_present = false; \
+    bool &present() { return this->name##_present; } \
+    ParseResult<void> parse(const char *str, const char *end) { return this->parse_value(this->name, str, end); } \
+  };
+
+DSMR_STUB_FIELD(identification, true, 255, 255, 255, 255, 255, 255)
+DSMR_STUB_FIELD(p1_version, true, 1, 3, 0, 2, 8)
+DSMR_STUB_FIELD(timestamp, true, 0, 0, 1, 0, 0)
+DSMR_STUB_FIELD(equipment_id, true, 0, 0, 96, 1, 1)
+DSMR_STUB_FIELD(energy_delivered_tariff1, false, 1, 0, 1, 8, 1)
+DSMR_STUB_FIELD(energy_delivered_tariff2, false, 1, 0, 1, 8, 2)
+DSMR_STUB_FIELD(energy_returned_tariff1, false, 1, 0, 2, 8, 1)
+DSMR_STUB_FIELD(energy_returned_tariff2, false, 1, 0, 2, 8, 2)
+DSMR_STUB_FIELD(electricity_tariff, true, 0, 0, 96, 14, 0)
+DSMR_STUB_FIELD(power_delivered, false, 1, 0, 1, 7, 0)
+DSMR_STUB_FIELD(power_returned, false, 1, 0, 2, 7, 0)
+DSMR_STUB_FIELD(voltage_l1, false, 1, 0, 32, 7, 0)
+DSMR_STUB_FIELD(voltage_l2, false, 1, 0, 52, 7, 0)
+DSMR_STUB_FIELD(voltage_l3, false, 1, 0, 72, 7, 0)
+DSMR_STUB_FIELD(current_l1, false, 1, 0, 31, 7, 0)
+DSMR_STUB_FIELD(power_delivered_l1, false, 1, 0, 21, 7, 0)
+DSMR_STUB_FIELD(gas_delivered, false, 0, 1, 24, 2, 1)
+DSMR_STUB_FIELD(message_long, true, 0, 0, 96, 13, 0)
+
+#undef DSMR_STUB_FIELD
+
+}  // namespace fields
+}  // namespace dsmr
@@ -0,0 +1,181 @@
+#pragma once
+// Stands in for the parser of the glmnet/Dsmr library, with the same interface and behavior for the parts dsmr uses
+
+#include <WString.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace dsmr {
+
+static inline uint16_t _crc16_update(uint16_t crc, uint8_t a) {
+  crc ^= a;
+  for (int i = 0; i < 8; ++i)
+    crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : (crc >> 1);
+  return crc;
+}
+
+template<typename T> struct ParseResult;
+
+template<typename P, typename T> struct _ParseResult {
+  T result;
+  P &succeed(T &res) {
+    this->result = res;
+    return *static_cast<P *>(this);
+  }
+};
+template<typename P> struct _ParseResult<P, void> {};
+
+template<typename T> struct ParseResult : public _ParseResult<ParseResult<T>, T> {
+  const char *next = nullptr;
+  const char *err = nullptr;
+  const char *ctx = nullptr;
+
+  ParseResult() = default;
+  template<typename T2> ParseResult(const ParseResult<T2> &other) : next(other.next), err(other.err), ctx(other.ctx) {}
+
+  ParseResult &fail(const char *error, const char *context = nullptr) {
+    this->err = error;
+    this->ctx = context;
+    return *this;
+  }
+  ParseResult &until(const char *next) {
+    this->next = next;
+    return *this;
+  }
+  String fullError(const char *start, const char *end) const {
+    String res;
+    if (this->ctx != nullptr && start != nullptr && end != nullptr) {
+      res += std::string(start, end) + "\n";
+      res += std::string(this->ctx - start, ' ') + "^\n";
+    }
+    res += this->err;
+    return res;
+  }
+};
+
+struct ObisId {
+  uint8_t v[6];
+  constexpr ObisId(uint8_t a, uint8_t b = 255, uint8_t c = 255, uint8_t d = 255, uint8_t e = 255, uint8_t f = 255)
+      : v{a, b, c, d, e, f} {}
+  ObisId() : v() {}
+  bool operator==(const ObisId &other) const { return memcmp(this->v, other.v, sizeof(this->v)) == 0; }
+};
+
+struct ObisIdParser {
+  static ParseResult<ObisId> parse(const char *str, const char *end) {
+    ParseResult<ObisId> res;
+    ObisId id;
+    uint8_t part = 0;
+    const char *s = str;
+    while (s < end && *s >= '0' && *s <= '9') {
+      int value = 0;
+      while (s < end && *s >= '0' && *s <= '9')
+        value = value * 10 + (*s++ - '0');
+      if (value > 255)
+        return res.fail("Obis ID part too large", s);
+      id.v[part++] = value;
+      if (s == end || part == 6 || (*s != '-' && *s != ':' && *s != '.' && *s != '*'))
+        break;
+      s++;
+    }
+    if (part == 0)
+      return res.fail("OBIS id Empty", str);
+    for (; part < 6; part++)
+      id.v[part] = 255;
+    res.result = id;
+    return res.until(s);
+  }
+};
+
+struct CrcParser {
+  static ParseResult<uint16_t> parse(const char *str, const char *end) {
+    ParseResult<uint16_t> res;
+    if (end - str < 4)
+      return res.fail("No checksum found", str);
+    char buf[5] = {0};
+    memcpy(buf, str, 4);
+    char *buf_end;
+    res.result = strtoul(buf, &buf_end, 16);
+    if (buf_end != buf + 4)
+      return res.fail("Incomplete or malformed checksum", str);
+    return res.until(str + 4);
+  }
+};
+
+struct P1Parser {
+  template<typename Data>
+  static ParseResult<void> parse(Data *data, const char *str, size_t n, bool unknown_error = false,
+                                 bool check_crc = true) {
+    ParseResult<void> res;
+    if (n == 0 || str[0] != '/')
+      return res.fail("Data should start with /", str);
+    const char *data_start = str + 1;
+    const char *data_end = data_start;
+    uint16_t crc = _crc16_update(0, *str);
+    while (data_end < str + n && *data_end != '!')
+      crc = _crc16_update(crc, *data_end++);
+    if (data_end >= str + n)
+      return res.fail("No checksum found", data_end);
+    crc = _crc16_update(crc, *data_end);
+    if (check_crc) {
+      ParseResult<uint16_t> check_res = CrcParser::parse(data_end + 1, str + n);
+      if (check_res.err)
+        return check_res;
+      if (check_res.result != crc)
+        return res.fail("Checksum mismatch", data_end + 1);
+    }
+    return parse_data(data, data_start, data_end, unknown_error);
+  }
+
+  template<typename Data>
+  static ParseResult<void> parse_data(Data *data, const char *str, const char *end, bool unknown_error = false) {
+    ParseResult<void> res;
+    const char *line_start = str;
+    const char *line_end = str;
+    // The identification line
+    for (; line_end < end; line_end++) {
+      if (*line_end == '\r' || *line_end == '\n') {
+        if (line_start + 3 >= line_end || (line_start[3] != '5' && line_start[3] != '3'))
+          return res.fail("Invalid identification string", line_start);
+        ParseResult<void> tmp = data->parse_line(ObisId(255, 255, 255, 255, 255, 255), line_start, line_end);
+        if (tmp.err)
+          return tmp;
+        line_start = ++line_end;
+        break;
+      }
+    }
+    for (; line_end < end; line_end++) {
+      if (*line_end == '\r' || *line_end == '\n') {
+        ParseResult<void> tmp = parse_line(data, line_start, line_end, unknown_error);
+        if (tmp.err)
+          return tmp;
+        line_start = line_end + 1;
+      }
+    }
+    if (line_end != line_start)
+      return res.fail("Last dataline not CRLF terminated", line_end);
+    return res;
+  }
+
+  template<typename Data>
+  static ParseResult<void> parse_line(Data *data, const char *line, const char *end, bool unknown_error) {
+    ParseResult<void> res;
+    if (line == end)
+      return res;
+    ParseResult<ObisId> idres = ObisIdParser::parse(line, end);
+    if (idres.err)
+      return idres;
+    ParseResult<void> datares = data->parse_line(idres.result, idres.next, end);
+    if (datares.err)
+      return datares;
+    if (datares.next != idres.next && datares.next != end)
+      return res.fail("Trailing characters on data line", datares.next);
+    if (datares.next == idres.next && unknown_error)
+      return res.fail("Unknown field", line);
+    return res.until(end);
+  }
+};
+
+}  // namespace dsmr
@@ -0,0 +1,12 @@
+#pragma once
+// The shared stub plus what the code generator adds for a dsmr configuration
+#include_next "esphome/core/defines.h"
+#define USE_TEXT_SENSOR
+#define DSMR_SENSOR_LIST(F, sep) \
+  F(energy_delivered_tariff1) \
+  sep F(energy_delivered_tariff2) sep F(energy_returned_tariff1) sep F(energy_returned_tariff2) sep F(power_delivered) \
+  sep F(power_returned) sep F(voltage_l1) sep F(voltage_l2) sep F(voltage_l3) sep F(current_l1) \
+  sep F(power_delivered_l1) sep F(gas_delivered)
+#define DSMR_TEXT_SENSOR_LIST(F, sep) \
+  F(identification) \
+  sep F(p1_version) sep F(timestamp) sep F(equipment_id) sep F(electricity_tariff) sep F(message_long)
@@ -0,0 +1,25 @@
+#!/usr/bin/env bash
+# Check the values dsmr publishes for the telegrams made by gen.py, plain and encrypted, under ASan/UBSan, then
+# measure its worst loop() and heap
+source "$(dirname "$0")/../common.sh"
+
+# The include directory stands in for the dsmr and Crypto libraries and adds the sensor lists to defines.h
+flags=(-I"$here/include" "${host_flags[@]}" -DUSE_ARDUINO)
+srcs=("$here/telegram_test.cpp" "$repo"/esphome/components/dsmr/dsmr.cpp
+  "$repo"/esphome/components/uart/{uart,uart_component}.cpp
+  "$repo"/esphome/components/sensor/{sensor,filter}.cpp "$repo"/esphome/components/text_sensor/{text_sensor,filter}.cpp
+  "$repo"/esphome/core/{application,component,entity_base,helpers,scheduler,string_ref,util}.cpp)
+g++ "${flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all "${srcs[@]}" -lcrypto \
+  -o "$build/test_asan"
+g++ "${flags[@]}" -O2 "${srcs[@]}" -lcrypto -o "$build/bench"
+
+cd "$here"
+# The sensors and the component live until the end like in an application
+export ASAN_OPTIONS=detect_leaks=0
+"$build/test_asan" print | diff -u expected.txt -
+"$build/test_asan" print encrypted | diff -u expected.txt -
+echo "published values match expected.txt"
+"$build/test_asan" nocrc
+for mode in plain encrypted; do
+  "$build/bench" "$mode"
+done
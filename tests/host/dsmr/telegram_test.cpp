@@ -0,0 +1,230 @@
+// Sends the telegrams of gen.py to dsmr at 115200 baud, one per second with loop() every 16 ms, plain or encrypted
+// like the Luxembourg meters do. With "print" every published value is printed for the comparison with expected.txt,
+// otherwise the worst loop() per telegram and the peak heap of the component are measured.
+
+#include "esphome/components/dsmr/dsmr.h"
+
+#include <openssl/evp.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <string>
+#include <vector>
+
+// Track the live heap, the size is kept in front of every allocation
+static size_t heap_live = 0;
+static size_t heap_peak = 0;
+void *operator new(size_t size) {
+  auto *p = static_cast<size_t *>(malloc(size + 2 * sizeof(size_t)));
+  if (p == nullptr)
+    throw std::bad_alloc();
+  p[0] = size;
+  heap_live += size;
+  heap_peak = std::max(heap_peak, heap_live);
+  return p + 2;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept {
+  if (p == nullptr)
+    return;
+  auto *q = static_cast<size_t *>(p) - 2;
+  heap_live -= q[0];
+  free(q);
+}
+void operator delete[](void *p) noexcept { operator delete(p); }
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
+void operator delete[](void *p, size_t) noexcept { operator delete(p); }
+
+namespace esphome {
+static uint64_t now_us = 0;
+uint32_t millis() { return now_us / 1000; }
+uint32_t micros() { return now_us; }
+void delay(uint32_t ms) { now_us += ms * 1000ull; }
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() {}
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome;
+
+/// Hands out the bytes once their arrival time has passed
+class TelegramUart : public uart::UARTComponent {
+ public:
+  void add(const std::vector<uint8_t> &bytes, uint64_t start_us) {
+    for (size_t i = 0; i < bytes.size(); i++) {
+      this->stream_.push_back(bytes[i]);
+      // 10 bits per byte at 115200 baud
+      this->arrival_.push_back(start_us + i * 86800 / 1000);
+    }
+  }
+  bool done() const { return this->pos_ == this->stream_.size(); }
+
+  void write_array(const uint8_t *, size_t) override {}
+  bool peek_byte(uint8_t *data) override {
+    if (this->available() == 0)
+      return false;
+    *data = this->stream_[this->pos_];
+    return true;
+  }
+  bool read_array(uint8_t *data, size_t len) override {
+    if (size_t(this->available()) < len)
+      return false;
+    memcpy(data, &this->stream_[this->pos_], len);
+    this->pos_ += len;
+    return true;
+  }
+  int available() override {
+    size_t end = this->pos_;
+    while (end < this->stream_.size() && this->arrival_[end] <= now_us)
+      end++;
+    return end - this->pos_;
+  }
+  void flush() override {}
+  void check_logger_conflict() override {}
+
+ protected:
+  std::vector<uint8_t> stream_;
+  std::vector<uint64_t> arrival_;
+  size_t pos_{0};
+};
+
+static const uint8_t KEY[16] = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+                                0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA};
+
+/// AES-128-GCM encrypted telegram in a frame like the Luxembourg meters send
+static std::vector<uint8_t> encrypt(const std::string &plain, uint32_t frame_counter) {
+  const uint8_t system_title[8] = {'S', 'A', 'G', 'y', 0x00, 0x01, 0x02, 0x03};
+  uint8_t iv[12];
+  memcpy(iv, system_title, 8);
+  for (int i = 0; i < 4; i++)
+    iv[8 + i] = frame_counter >> (24 - 8 * i);
+  std::vector<uint8_t> ciphertext(plain.size());
+  uint8_t tag[16];
+  int len;
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_EncryptInit_ex(ctx, EVP_aes_128_gcm(), nullptr, nullptr, nullptr);
+  EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, sizeof(iv), nullptr);
+  EVP_EncryptInit_ex(ctx, nullptr, nullptr, KEY, iv);
+  EVP_EncryptUpdate(ctx, ciphertext.data(), &len, reinterpret_cast<const uint8_t *>(plain.data()), plain.size());
+  EVP_EncryptFinal_ex(ctx, tag, &len);
+  EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, sizeof(tag), tag);
+  EVP_CIPHER_CTX_free(ctx);
+
+  // Security byte, frame counter, ciphertext and a 12 byte tag
+  size_t length = plain.size() + 5 + 12;
+  std::vector<uint8_t> frame{0xDB, 0x08};
+  frame.insert(frame.end(), system_title, system_title + 8);
+  frame.insert(frame.end(), {0x82, uint8_t(length >> 8), uint8_t(length), 0x30});
+  frame.insert(frame.end(), iv + 8, iv + 12);
+  frame.insert(frame.end(), ciphertext.begin(), ciphertext.end());
+  frame.insert(frame.end(), tag, tag + 12);
+  return frame;
+}
+
+/// The telegrams of telegrams.txt, each followed by a line "===", with CRLF line endings
+static std::vector<std::string> load_telegrams(const char *path) {
+  std::ifstream f(path);
+  std::string all((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+  std::vector<std::string> telegrams;
+  std::string telegram;
+  for (size_t pos = 0, end; (end = all.find('\n', pos)) != std::string::npos; pos = end + 1) {
+    std::string line = all.substr(pos, end - pos);
+    if (line == "===") {
+      telegrams.push_back(telegram);
+      telegram.clear();
+    } else {
+      telegram += line + "\r\n";
+    }
+  }
+  return telegrams;
+}
+
+int main(int argc, char **argv) {
+  bool print = false, encrypted = false, crc_check = true;
+  for (int i = 1; i < argc; i++) {
+    print |= strcmp(argv[i], "print") == 0;
+    encrypted |= strcmp(argv[i], "encrypted") == 0;
+    crc_check &= strcmp(argv[i], "nocrc") != 0;
+  }
+  auto telegrams = load_telegrams("telegrams.txt");
+  const int rounds = print ? 1 : 20;
+
+  TelegramUart uart;
+  uint64_t start_us = 1005000;
+  uint32_t frame_counter = 1;
+  for (int r = 0; r < rounds; r++) {
+    for (auto &telegram : telegrams) {
+      uart.add(encrypted ? encrypt(telegram, frame_counter++) : std::vector<uint8_t>(telegram.begin(), telegram.end()),
+               start_us);
+      start_us += 1000000;
+    }
+  }
+
+  const size_t heap_before = heap_live;
+  heap_peak = heap_live;
+  auto *dsmr = new esphome::dsmr::Dsmr(&uart, crc_check);
+  dsmr->set_max_telegram_length(1500);
+  dsmr->set_request_interval(0);
+  dsmr->set_receive_timeout(200);
+  if (encrypted)
+    dsmr->set_decryption_key("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA");
+  int published = 0;
+#define DSMR_TEST_SENSOR(s) \
+  auto *s = new sensor::Sensor(); \
+  s->add_on_state_callback([print](float state) { \
+    if (print) \
+      printf(#s "=%.3f\n", state); \
+  }); \
+  dsmr->set_##s(s);
+  DSMR_SENSOR_LIST(DSMR_TEST_SENSOR, )
+#define DSMR_TEST_TEXT_SENSOR(s) \
+  auto *s = new text_sensor::TextSensor(); \
+  s->add_on_state_callback([print, &published](const std::string &state) { \
+    if (print) \
+      printf(#s "=%s\n", state.c_str()); \
+    published += strcmp(#s, "identification") == 0; \
+  }); \
+  dsmr->set_##s(s);
+  DSMR_TEXT_SENSOR_LIST(DSMR_TEST_TEXT_SENSOR, )
+  dsmr->setup();
+  const size_t heap_setup = heap_live;
+
+  // The worst loop() while each telegram comes in
+  double worst_sum = 0, worst = 0;
+  uint64_t second = now_us / 1000000;
+  while (!uart.done() || now_us < start_us) {
+    auto begin = std::chrono::steady_clock::now();
+    dsmr->loop();
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - begin;
+    if (now_us / 1000000 != second) {
+      worst_sum += worst;
+      worst = 0;
+      second = now_us / 1000000;
+    }
+    worst = std::max(worst, elapsed.count());
+    now_us += 16000;
+  }
+
+  // Telegrams with a wrong CRC are dropped when it is checked
+  size_t corrupt = 0;
+  for (size_t i = 0; i < telegrams.size(); i++)
+    corrupt += i % 7 == 6;
+  const int expected = rounds * (crc_check ? telegrams.size() - corrupt : telegrams.size());
+  bool ok = published == expected;
+  if (!ok)
+    fprintf(stderr, "%d telegrams published, expected %d\n", published, expected);
+  if (!print) {
+    printf("%s, crc_check %s: worst loop() per telegram %.1f us, heap %zu bytes after setup, %zu at the peak\n",
+           encrypted ? "encrypted" : "plain", crc_check ? "on" : "off", worst_sum / (rounds * telegrams.size()),
+           heap_setup - heap_before, heap_peak - heap_before);
+  }
+  if (!ok)
+    puts("telegrams FAILED");
+  return ok ? 0 : 1;
+}
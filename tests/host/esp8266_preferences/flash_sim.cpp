@@ -0,0 +1,318 @@
+// Host simulator of the ESP8266 flash for esp8266/preferences.cpp.
+//
+// The flash lives in shared memory and every boot of the "device" runs in a forked child, so a boot can be cut off
+// at any flash operation like a power loss, and the next boot sees the flash exactly as it was left. Writes only
+// clear bits like NOR flash, an interrupted erase or write leaves partially changed data behind.
+//
+// Modes:
+//   amp [steps] [changes]     sync `steps` times with `changes` changed preferences each, print the flash wear
+//   powerloss [steps] [step]  cut the power at every `step`th flash operation, then check the restored values
+//   write <steps>             like amp, without the report, to prepare a flash image
+//   ota                       save, start an OTA update, overwrite the sectors below FS_start and check
+//   fs                        like amp, checking that a filesystem below the legacy sector is left alone
+//   verify                    boot and check the restored values
+// FLASH_IN and FLASH_OUT name files to load the flash image from and store it to. V=1 logs the preferences code.
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
+#include "esphome/components/esp8266/preferences.h"
+extern "C" {
+#include "spi_flash.h"
+}
+#include "Esp.h"
+
+using namespace esphome;
+
+static const uint32_t FLASH_SIZE = 1 << 20;
+// Sector of _SPIFFS_end, see the --defsym in run.sh
+static const uint32_t END_SECTOR = 0xFB;
+extern "C" uint32_t _SPIFFS_start;  // NOLINT
+
+struct Shared {
+  uint8_t flash[FLASH_SIZE];
+  long budget;  ///< Flash operations until the power is cut, negative for none
+  long ops;
+  long erases[256];
+  long bytes_written;
+  long syncs;
+  uint32_t committed[8][8];  ///< Values of the last successful sync
+  uint32_t pending[8][8];    ///< Values of the sync in progress
+  bool has_committed;
+};
+static Shared *sh;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static const bool VERBOSE = getenv("V") != nullptr;
+
+uint32_t sim_sketch_size = 500 * 1024;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+EspClass ESP;                           // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace esphome {
+InterruptLock::InterruptLock() {}
+InterruptLock::~InterruptLock() {}
+void esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {
+  if (!VERBOSE)
+    return;
+  va_list args;
+  va_start(args, format);
+  printf("[%s] ", tag);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+  fflush(stdout);
+}
+}  // namespace esphome
+
+static void tick(const std::function<void()> &partial) {
+  sh->ops++;
+  if (sh->budget >= 0 && sh->budget-- == 0) {
+    partial();
+    _exit(3);
+  }
+}
+
+SpiFlashOpResult spi_flash_erase_sector(uint16_t sec) {
+  uint8_t *p = sh->flash + sec * SPI_FLASH_SEC_SIZE;
+  tick([p]() { memset(p, 0xFF, rand() % SPI_FLASH_SEC_SIZE); });
+  memset(p, 0xFF, SPI_FLASH_SEC_SIZE);
+  sh->erases[sec & 0xFF]++;
+  return SPI_FLASH_RESULT_OK;
+}
+SpiFlashOpResult spi_flash_write(uint32_t addr, uint32_t *src, uint32_t size) {
+  for (uint32_t i = 0; i < size / 4; i++) {
+    uint32_t *dst = reinterpret_cast<uint32_t *>(sh->flash + addr) + i;
+    tick([dst, src, i]() { *dst &= src[i] | (uint32_t) rand(); });
+    *dst &= src[i];
+  }
+  sh->bytes_written += size;
+  return SPI_FLASH_RESULT_OK;
+}
+SpiFlashOpResult spi_flash_read(uint32_t addr, uint32_t *dst, uint32_t size) {
+  memcpy(dst, sh->flash + addr, size);
+  return SPI_FLASH_RESULT_OK;
+}
+
+// Preferences like a device has them: light states, globals, counters, two with the same type
+static const int NUM_PREFS = 7;
+static const uint32_t TYPES[NUM_PREFS] = {0x1111, 0x2222, 0x3333, 0x4444, 0x4444, 0x5555, 0x6666};
+static const uint32_t WORDS[NUM_PREFS] = {4, 1, 2, 1, 1, 8, 3};
+
+/// Gives access to the backend, to save and load values of any length
+struct BackendAccess : ESPPreferenceObject {
+  ESPPreferenceBackend *backend() { return this->backend_; }
+};
+
+struct Device {
+  ESPPreferenceObject prefs[NUM_PREFS];
+  Device() {
+    esp8266::setup_preferences();
+    for (int i = 0; i < NUM_PREFS; i++)
+      prefs[i] = global_preferences->make_preference(WORDS[i] * 4, TYPES[i], true);
+  }
+  ESPPreferenceBackend *backend(int i) { return static_cast<BackendAccess &>(prefs[i]).backend(); }
+  bool load(int i, uint32_t *v) { return this->backend(i)->load(reinterpret_cast<uint8_t *>(v), WORDS[i] * 4); }
+  bool save(int i, const uint32_t *v) {
+    return this->backend(i)->save(reinterpret_cast<const uint8_t *>(v), WORDS[i] * 4);
+  }
+};
+
+// A device running for a while: every step changes some preferences and syncs
+static void run_workload(long steps, unsigned seed, int changes_per_sync) {
+  Device d;
+  srand(seed);
+  uint32_t values[NUM_PREFS][8];
+  for (int i = 0; i < NUM_PREFS; i++) {
+    if (!d.load(i, values[i])) {
+      memset(values[i], 0, sizeof(values[i]));
+      d.save(i, values[i]);
+    }
+  }
+  for (long step = 0; step < steps; step++) {
+    for (int c = 0; c < changes_per_sync; c++) {
+      int i = rand() % NUM_PREFS;
+      values[i][rand() % WORDS[i]] = rand();
+      d.save(i, values[i]);
+    }
+    memcpy(sh->pending, values, sizeof(values));
+    if (!global_preferences->sync()) {
+      printf("sync failed\n");
+      fflush(stdout);
+      _exit(1);
+    }
+    sh->syncs++;
+    memcpy(sh->committed, values, sizeof(values));
+    sh->has_committed = true;
+  }
+  _exit(0);
+}
+
+// Every preference must have the value of the last sync, or of the sync that was cut off
+static int verify() {
+  Device d;
+  int errors = 0;
+  for (int i = 0; i < NUM_PREFS; i++) {
+    uint32_t v[8] = {};
+    bool ok = d.load(i, v);
+    bool is_committed = ok && memcmp(v, sh->committed[i], WORDS[i] * 4) == 0;
+    bool is_pending = ok && memcmp(v, sh->pending[i], WORDS[i] * 4) == 0;
+    if (sh->has_committed && !is_committed && !is_pending) {
+      printf("pref %d: %s\n", i, ok ? "wrong value" : "lost");
+      fflush(stdout);
+      errors++;
+    }
+  }
+  return errors;
+}
+
+static int in_child(const std::function<void()> &fn) {
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    fn();
+    _exit(0);
+  }
+  int status;
+  waitpid(pid, &status, 0);
+  return WEXITSTATUS(status);
+}
+
+static void load_image(const char *path) {
+  FILE *f = fopen(path, "rb");
+  if (f == nullptr || fread(sh->flash, 1, FLASH_SIZE, f) != FLASH_SIZE ||
+      fread(sh->committed, 1, sizeof(sh->committed), f) != sizeof(sh->committed)) {
+    printf("could not read %s\n", path);
+    exit(2);
+  }
+  fclose(f);
+  memcpy(sh->pending, sh->committed, sizeof(sh->committed));
+  sh->has_committed = true;
+}
+
+static void store_image(const char *path) {
+  FILE *f = fopen(path, "wb");
+  if (f == nullptr)
+    return;
+  fwrite(sh->flash, 1, FLASH_SIZE, f);
+  fwrite(sh->committed, 1, sizeof(sh->committed), f);
+  fclose(f);
+}
+
+static int run(const std::string &mode, int argc, char **argv) {
+  if (mode == "amp") {
+    long steps = argc > 2 ? atol(argv[2]) : 1000;
+    int changes = argc > 3 ? atoi(argv[3]) : 1;
+    in_child([&]() { run_workload(steps, 1, changes); });
+    long erases = 0;
+    for (long e : sh->erases)
+      erases += e;
+    printf("syncs %ld, erases %ld (max per sector %ld), bytes written %ld (%.1f per sync), flash ops %ld\n", sh->syncs,
+           erases, *std::max_element(sh->erases, sh->erases + 256), sh->bytes_written,
+           (double) sh->bytes_written / sh->syncs, sh->ops);
+    int errors = in_child([]() { _exit(verify()); });
+    printf("restore after reboot: %s\n", errors ? "FAILED" : "ok");
+    return errors;
+  }
+  if (mode == "powerloss") {
+    long steps = argc > 2 ? atol(argv[2]) : 300;
+    long stride = argc > 3 ? atol(argv[3]) : 1;
+    in_child([&]() { run_workload(steps, 7, 2); });
+    long total = sh->ops;
+    printf("reference run: %ld flash operations\n", total);
+    long failures = 0;
+    for (long cut = 0; cut < total; cut += stride) {
+      memset(sh->flash, 0xFF, FLASH_SIZE);
+      memset(sh->erases, 0, sizeof(sh->erases));
+      sh->has_committed = false;
+      sh->ops = 0;
+      sh->budget = cut;
+      srand(cut);
+      int rc = in_child([&]() { run_workload(steps, 7, 2); });
+      sh->budget = -1;
+      int errors = in_child([]() { _exit(verify()); });
+      // The device has to keep working after the power loss
+      int rc2 = in_child([&]() { run_workload(20, 99, 2); });
+      int errors2 = in_child([]() { _exit(verify()); });
+      if (errors || errors2 || rc2 != 0 || (rc != 3 && rc != 0)) {
+        printf("cut %ld: rc %d, errors %d, after more writes %d (rc %d)\n", cut, rc, errors, errors2, rc2);
+        failures++;
+      }
+    }
+    printf("power loss at %ld points: %ld failures\n", (total + stride - 1) / stride, failures);
+    return failures != 0;
+  }
+  if (mode == "write") {
+    in_child([&]() { run_workload(argc > 2 ? atol(argv[2]) : 100, 3, 1); });
+    return 0;
+  }
+  if (mode == "ota") {
+    // Changes not synced yet are written when the update starts, the update then overwrites the sectors below
+    // FS_start with the new image
+    in_child([&]() {
+      Device d;
+      uint32_t values[NUM_PREFS][8] = {};
+      for (int i = 0; i < NUM_PREFS; i++) {
+        d.load(i, values[i]);
+        values[i][0] += 1000;
+        d.save(i, values[i]);
+      }
+      memcpy(sh->pending, values, sizeof(values));
+      esp8266::preferences_prevent_write(true);
+      // Nothing is written anymore until restart
+      global_preferences->sync();
+      memcpy(sh->committed, values, sizeof(values));
+      sh->has_committed = true;
+    });
+    for (uint32_t i = 100 * SPI_FLASH_SEC_SIZE; i < END_SECTOR * SPI_FLASH_SEC_SIZE; i++)
+      sh->flash[i] = rand();
+    int errors = in_child([]() { _exit(verify()); });
+    int rc = in_child([&]() { run_workload(500, 5, 2); });
+    errors += in_child([]() { _exit(verify()); });
+    printf("ota %s\n", errors || rc ? "FAILED" : "ok");
+    return errors || rc;
+  }
+  if (mode == "fs") {
+    const uint32_t fs_start = (reinterpret_cast<uintptr_t>(&_SPIFFS_start) - 0x40200000) & (FLASH_SIZE - 1);
+    for (uint32_t i = fs_start; i < END_SECTOR * SPI_FLASH_SEC_SIZE; i++)
+      sh->flash[i] = i % 251;
+    int rc = in_child([&]() { run_workload(argc > 2 ? atol(argv[2]) : 1000, 1, 1); });
+    int errors = in_child([]() { _exit(verify()); });
+    for (uint32_t i = fs_start; i < END_SECTOR * SPI_FLASH_SEC_SIZE; i++) {
+      if (sh->flash[i] != i % 251) {
+        printf("filesystem changed at 0x%X\n", i);
+        errors++;
+        break;
+      }
+    }
+    printf("fs %s\n", errors || rc ? "FAILED" : "ok");
+    return errors || rc;
+  }
+  if (mode == "verify") {
+    int errors = in_child([]() { _exit(verify()); });
+    printf("verify %s\n", errors ? "FAILED" : "ok");
+    return errors;
+  }
+  printf("unknown mode %s\n", mode.c_str());
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  sh = static_cast<Shared *>(
+      mmap(nullptr, sizeof(Shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));  // NOLINT
+  memset(sh->flash, 0xFF, FLASH_SIZE);
+  sh->budget = -1;
+  if (getenv("FLASH_IN") != nullptr)
+    load_image(getenv("FLASH_IN"));
+  int rc = run(argc > 1 ? argv[1] : "amp", argc, argv);
+  if (getenv("FLASH_OUT") != nullptr)
+    store_image(getenv("FLASH_OUT"));
+  return rc;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env bash
+# Build the flash simulator against esp8266/preferences.cpp and run wear, power loss and OTA checks
+source "$(dirname "$0")/../common.sh"
+
+g++ "${stub_flags[@]}" -O1 -g -DUSE_ESP8266 -DESPHOME_LOG_LEVEL=6 \
+  -I"$repo/esphome/components/esp8266" -no-pie -Wl,--defsym=_SPIFFS_start=0x402FB000,--defsym=_SPIFFS_end=0x402FB000 \
+  "$here/flash_sim.cpp" "$repo/esphome/components/esp8266/preferences.cpp" -o "$build/flash_sim"
+# The same with a 64 KiB filesystem right below the legacy sector
+g++ "${stub_flags[@]}" -O1 -g -DUSE_ESP8266 -DESPHOME_LOG_LEVEL=6 \
+  -I"$repo/esphome/components/esp8266" -no-pie -Wl,--defsym=_SPIFFS_start=0x402EB000,--defsym=_SPIFFS_end=0x402FB000 \
+  "$here/flash_sim.cpp" "$repo/esphome/components/esp8266/preferences.cpp" -o "$build/flash_sim_fs"
+
+"$build/flash_sim" amp 1000 1
+"$build/flash_sim" amp 1000 3
+"$build/flash_sim" powerloss 300 "${STRIDE:-7}"
+"$build/flash_sim_fs" fs 1000
+
+# Start OTA updates at every fill level of the preferences sectors
+for n in $(seq 1 2 700); do
+  FLASH_OUT="$build/flash.bin" "$build/flash_sim" write "$n"
+  if ! FLASH_IN="$build/flash.bin" "$build/flash_sim" ota | grep -q 'ota ok'; then
+    echo "ota after $n syncs FAILED"
+    exit 1
+  fi
+done
+echo "ota ok"
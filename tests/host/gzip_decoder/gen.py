@@ -0,0 +1,72 @@
+"""Generate the gzip streams the decoder test decompresses.
+
+Every input is compressed by the gzip module and by zlib at levels 0, 1 and 9, once
+with the fixed Huffman codes only, and once with every optional header field set. The
+inputs are the firmware given on the command line, random bytes, log text, zeros and
+nothing. NAME.raw holds an input, NAME.VARIANT.gz its compressed streams.
+
+Usage: gen.py OUTPUT_DIR FIRMWARE
+"""
+
+import gzip
+import os
+import random
+import struct
+import sys
+import zlib
+
+
+def deflate(data, level, strategy=zlib.Z_DEFAULT_STRATEGY, wbits=31):
+    z = zlib.compressobj(level, zlib.DEFLATED, wbits, 9, strategy)
+    return z.compress(data) + z.flush()
+
+
+def with_header_fields(data):
+    """gzip stream with FEXTRA, FNAME, FCOMMENT and FHCRC set."""
+    extra = b"ES" + struct.pack("<H", 5) + b"host!"
+    header = b"\x1f\x8b\x08\x1e" + struct.pack("<I", 1700000000) + b"\x02\x03"
+    header += struct.pack("<H", len(extra)) + extra
+    header += b"firmware.bin\x00" + b"built by gen.py\x00"
+    header += struct.pack("<H", zlib.crc32(header) & 0xFFFF)
+    trailer = struct.pack("<II", zlib.crc32(data), len(data) & 0xFFFFFFFF)
+    return header + deflate(data, 6, wbits=-15) + trailer
+
+
+def inputs(firmware):
+    rng = random.Random(46)
+    with open(firmware, "rb") as f:
+        yield "firmware", f.read()
+    yield "random", rng.randbytes(300000)
+    lines = []
+    for i in range(8000):
+        level = rng.choice("DIWE")
+        state = rng.uniform(-40, 120)
+        lines.append(
+            f"[{i // 3600 % 24:02d}:{i // 60 % 60:02d}:{i % 60:02d}][{level}]"
+            f"[sensor:{rng.randrange(200):03d}]: 'Sensor {rng.randrange(16)}': "
+            f"Sending state {state:.2f} with {rng.randrange(3)} decimals"
+        )
+    yield "text", "\n".join(lines).encode()
+    yield "zeros", bytes(200000)
+    yield "empty", b""
+
+
+def main():
+    out, firmware = sys.argv[1], sys.argv[2]
+    for name, data in inputs(firmware):
+        streams = {
+            "header": with_header_fields(data),
+            "fixed": deflate(data, 9, zlib.Z_FIXED),
+        }
+        for level in (0, 1, 9):
+            streams["gzip%d" % level] = gzip.compress(data, level, mtime=0)
+            streams["zlib%d" % level] = deflate(data, level)
+        with open(os.path.join(out, name + ".raw"), "wb") as f:
+            f.write(data)
+        for variant, stream in streams.items():
+            with open(os.path.join(out, "%s.%s.gz" % (name, variant)), "wb") as f:
+                f.write(stream)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,132 @@
+// Decompresses the streams of gen.py with GzipDecoder. With "check" each is fed whole, byte by byte and in random
+// chunks of up to 5000 bytes and must give back its input, a truncated stream must not finish, an output callback that
+// fails must stop the decoder and no corrupted stream may finish with output that differs from the input. Otherwise
+// the throughput is measured with the whole stream and with the 4 KiB chunks the OTA component reads.
+
+#include "esphome/components/ota/gzip_decoder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace esphome {
+uint32_t millis() { return 0; }
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() {}
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using esphome::ota::GzipDecoder;
+
+static std::vector<uint8_t> load(const std::string &path) {
+  std::ifstream f(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>()};
+}
+
+/// Feed the stream in chunks of the sizes `chunk` returns until it ends, fails or runs out
+template<typename F>
+static GzipDecoder::Result decode(GzipDecoder &decoder, const std::vector<uint8_t> &gz, size_t len,
+                                  std::vector<uint8_t> &out, F chunk) {
+  out.clear();
+  decoder.init([&out](const uint8_t *data, size_t len) {
+    out.insert(out.end(), data, data + len);
+    return true;
+  });
+  GzipDecoder::Result result = GzipDecoder::GZIP_NEED_INPUT;
+  for (size_t pos = 0; pos < len && result == GzipDecoder::GZIP_NEED_INPUT;) {
+    size_t n = std::min<size_t>(chunk(), len - pos);
+    result = decoder.feed(gz.data() + pos, n);
+    pos += n;
+  }
+  return result;
+}
+
+static bool check(const std::string &path, const std::vector<uint8_t> &gz, const std::vector<uint8_t> &raw,
+                  std::mt19937 &rng) {
+  GzipDecoder decoder;
+  std::vector<uint8_t> out;
+  bool ok = true;
+  auto fail = [&ok, &path](const char *what) {
+    printf("%s: %s\n", path.c_str(), what);
+    ok = false;
+  };
+
+  if (decode(decoder, gz, gz.size(), out, [&gz] { return gz.size(); }) != GzipDecoder::GZIP_DONE || out != raw)
+    fail("whole stream not decoded");
+  if (decoder.get_output_size() != raw.size())
+    fail("wrong output size");
+  if (decode(decoder, gz, gz.size(), out, [] { return 1; }) != GzipDecoder::GZIP_DONE || out != raw)
+    fail("byte by byte not decoded");
+  for (int run = 0; run < 10; run++) {
+    if (decode(decoder, gz, gz.size(), out, [&rng] { return 1 + rng() % 5000; }) != GzipDecoder::GZIP_DONE ||
+        out != raw)
+      fail("random chunks not decoded");
+  }
+  if (decode(decoder, gz, gz.size() - 1, out, [] { return 700; }) != GzipDecoder::GZIP_NEED_INPUT)
+    fail("truncated stream finished");
+
+  if (!raw.empty()) {
+    decoder.init([](const uint8_t *, size_t) { return false; });
+    if (decoder.feed(gz.data(), gz.size()) != GzipDecoder::GZIP_ERROR ||
+        decoder.feed(gz.data(), gz.size()) != GzipDecoder::GZIP_ERROR)
+      fail("failing output not reported");
+  }
+
+  // The modification time, extra flags and OS in the first 10 bytes aren't checked by gzip
+  for (int run = 0; run < 100; run++) {
+    auto corrupt = gz;
+    corrupt[10 + rng() % (corrupt.size() - 10)] ^= 1 << (rng() % 8);
+    if (decode(decoder, corrupt, corrupt.size(), out, [&rng] { return 1 + rng() % 5000; }) == GzipDecoder::GZIP_DONE &&
+        out != raw)
+      fail("corrupted stream finished with wrong output");
+  }
+  return ok;
+}
+
+static void bench(const std::string &path, const std::vector<uint8_t> &gz, const std::vector<uint8_t> &raw) {
+  GzipDecoder decoder;
+  std::vector<uint8_t> out;
+  out.reserve(raw.size());
+  printf("%-28s %8zu -> %8zu bytes", path.substr(path.rfind('/') + 1).c_str(), gz.size(), raw.size());
+  for (size_t chunk : {gz.size(), size_t(4096)}) {
+    const int rounds = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+      decode(decoder, gz, gz.size(), out, [chunk] { return chunk; });
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    printf(", %s %6.1f MB/s", chunk == 4096 ? "4 KiB chunks" : "whole", rounds * raw.size() / elapsed.count() / 1e6);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  bool full_check = argc > 1 && strcmp(argv[1], "check") == 0;
+  std::mt19937 rng(46);
+  int failed = 0;
+  for (int i = full_check ? 2 : 1; i < argc; i++) {
+    // NAME.VARIANT.gz decompresses to NAME.raw
+    std::string path = argv[i];
+    auto gz = load(path);
+    auto raw = load(path.substr(0, path.find('.', path.rfind('/') + 1)) + ".raw");
+    if (!full_check) {
+      if (!raw.empty())
+        bench(path, gz, raw);
+    } else if (!check(path, gz, raw, rng)) {
+      failed++;
+    }
+  }
+  if (full_check)
+    printf(failed != 0 ? "gzip decoder FAILED on %d streams\n" : "gzip decoder ok on %d streams\n",
+           failed != 0 ? failed : argc - 2);
+  return failed != 0 ? 1 : 0;
+}
@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+# Decompress gzip and zlib output of firmware, random, text, zero and empty inputs with the OTA gzip decoder under
+# ASan/UBSan in chunks of any size, then measure its throughput
+source "$(dirname "$0")/../common.sh"
+
+srcs=("$here/gzip_decoder_test.cpp" "$repo"/esphome/components/ota/gzip_decoder.cpp "$repo"/esphome/core/helpers.cpp)
+g++ "${host_flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all "${srcs[@]}" \
+  -o "$build/test_asan"
+g++ "${host_flags[@]}" -O2 "${srcs[@]}" -o "$build/bench"
+
+# The benchmark binary stands in for a firmware image
+mkdir "$build/streams"
+python3 "$here/gen.py" "$build/streams" "$build/bench"
+"$build/test_asan" check "$build"/streams/*.gz
+"$build/bench" "$build"/streams/*.gz
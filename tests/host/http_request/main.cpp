@@ -0,0 +1,271 @@
+// Host app for run.sh: checks the asynchronous requests of http_request against server.py, then posts a sample
+// every INTERVAL ms through a send action, or with a blocking request like before, and measures the longest gap
+// between loops of the other components
+
+#include "esphome/components/http_request/http_request.h"
+#include "esphome/components/host/preferences.h"
+#include "esphome/components/logger/logger.h"
+#include "esphome/core/application.h"
+#include "esphome/core/automation.h"
+#include "esphome/core/base_automation.h"
+#include "esphome/core/log.h"
+#include <arpa/inet.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+using namespace esphome;
+using namespace esphome::http_request;
+
+static int port;
+static bool blocking;
+static uint32_t max_gap;
+
+class Ticker : public Component {
+ public:
+  void loop() override {
+    uint32_t now = millis();
+    if (this->last_ != 0 && now - this->last_ > this->max_gap_)
+      this->max_gap_ = now - this->last_;
+    this->last_ = now;
+    this->loops_++;
+  }
+  uint32_t last_{0}, max_gap_{0}, loops_{0};
+};
+
+// What the old synchronous request amounts to: connect, send, wait for the whole response, close
+static int blocking_post(const std::string &path, const std::string &body) {
+  int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  if (::connect(fd, (sockaddr *) &addr, sizeof(addr)) != 0)
+    return -1;
+  std::string req = "POST " + path + " HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: close\r\nContent-Length: " +
+                    std::to_string(body.size()) + "\r\n\r\n" + body;
+  ::write(fd, req.data(), req.size());
+  char buf[1024];
+  std::string resp;
+  ssize_t n;
+  while ((n = ::read(fd, buf, sizeof(buf))) > 0) {
+    resp.append(buf, n);
+    size_t end = resp.find("\r\n\r\n");
+    size_t cl = resp.find("Content-Length: ");
+    if (end != std::string::npos && cl != std::string::npos &&
+        resp.size() >= end + 4 + (size_t) atoi(resp.c_str() + cl + 16))
+      break;
+  }
+  ::close(fd);
+  return atoi(resp.c_str() + 9);
+}
+
+static int failures = 0;
+#define CHECK(cond, ...) \
+  do { \
+    if (!(cond)) { \
+      failures++; \
+      fprintf(stderr, "FAIL: " __VA_ARGS__); \
+      fprintf(stderr, "\n"); \
+    } \
+  } while (0)
+
+class Driver : public Component {
+ public:
+  HttpRequestComponent *http;
+  Ticker *ticker;
+  HttpRequestSendAction<> *post;
+  // A script that is restarted while its request is in flight: send, then read the body without on_response
+  ActionList<> script;
+  int script_runs{0};
+  std::string script_body;
+  int step{0};
+  int pending{0};
+  uint32_t phase_start{0}, next_post{0};
+  int posts_sent{0}, posts_done{0}, posts_ok{0};
+  uint32_t duration_sum{0}, duration_max{0};
+  int count{30};
+  uint32_t interval{100};
+
+  void request(const std::string &method, const std::string &path, std::function<void(int, std::string &)> check,
+               int p = 0) {
+    auto req = make_unique<AsyncRequest>();
+    req->set_url("http://127.0.0.1:" + std::to_string(p ? p : port) + path);
+    req->method = method;
+    auto body = std::make_shared<std::string>();
+    req->on_data = [body](const uint8_t *data, size_t len) { body->append((const char *) data, len); };
+    req->on_complete = [this, body, check](int status, uint32_t) {
+      check(status, *body);
+      this->pending--;
+    };
+    this->pending++;
+    this->http->send_async(std::move(req));
+  }
+
+  void loop() override {
+    uint32_t now = millis();
+    switch (this->step) {
+      case 0:
+        this->script.play();
+        this->request("POST", "/echo?a=1", [](int s, std::string &b) {
+          CHECK(s == 200 && b == "POST /echo?a=1 ", "echo %d '%s'", s, b.c_str());
+        });
+        this->request("GET", "/chunked", [](int s, std::string &b) {
+          size_t expected = 0;
+          for (int i = 0; i < 200; i++)
+            expected += 97 + i;
+          CHECK(s == 200 && b.size() == expected && b[0] == 'A' && b.back() == 'A' + 199 % 26, "chunked %d %zu", s,
+                b.size());
+        });
+        this->request("GET", "/close", [](int s, std::string &b) {
+          CHECK(s == 200 && b == std::string(5000, 'z'), "close %d %zu", s, b.size());
+        });
+        this->request("GET", "/redirect", [](int s, std::string &b) {
+          CHECK(s == 200 && b == "GET /echo?redirected ", "redirect %d '%s'", s, b.c_str());
+        });
+        this->request("GET", "/rel/a?q", [](int s, std::string &b) {
+          CHECK(s == 200 && b == "GET /rel/b?x ", "relative redirect %d '%s'", s, b.c_str());
+        });
+        this->request("GET", "/rel/q", [](int s, std::string &b) {
+          CHECK(s == 200 && b == "GET /rel/q?y ", "query redirect %d '%s'", s, b.c_str());
+        });
+        this->request("GET", "/emptyloc", [](int s, std::string &b) {
+          CHECK(s == 302, "empty location %d", s);
+        });
+        this->request("DELETE", "/nocontent", [](int s, std::string &b) {
+          CHECK(s == 204 && b.empty(), "nocontent %d", s);
+        });
+        this->request("PUT", "/continue", [](int s, std::string &b) {
+          CHECK(s == 201 && b == "ok", "continue %d '%s'", s, b.c_str());
+        });
+        this->request("HEAD", "/echo", [](int s, std::string &b) { CHECK(s == 200 && b.empty(), "head %d", s); });
+        this->request(
+            "GET", "/", [](int s, std::string &b) { CHECK(s == HTTP_ERROR_CONNECTION_REFUSED, "refused %d", s); },
+            port + 1);
+        // The response of the stopped run arrives first
+        this->script.stop();
+        this->script.play();
+        this->pending++;
+        this->step = 1;
+        break;
+      case 1:
+        if (this->pending == 1 && this->script_runs == 1 && !this->script.is_running()) {
+          CHECK(this->script_body == "GET /echo?script2 ", "script body '%s'", this->script_body.c_str());
+          this->pending--;
+          // Responses of the stopped run must not have run the following actions
+          this->phase_start = now;
+        }
+        if (this->pending == 0 && now - this->phase_start > 500) {
+          CHECK(this->script_runs == 1, "script ran %d times", this->script_runs);
+          fprintf(stderr, "FUNCTIONAL done, failures=%d\n", failures);
+          this->step = 2;
+          this->phase_start = now;
+          this->next_post = now;
+          this->ticker->max_gap_ = 0;
+          this->ticker->loops_ = 0;
+        }
+        break;
+      case 2:
+        if (this->posts_sent < this->count && (int32_t) (now - this->next_post) >= 0) {
+          this->next_post += this->interval;
+          this->posts_sent++;
+          if (blocking) {
+            uint32_t start = millis();
+            int s = blocking_post("/write", "temperature value=21.5");
+            this->on_response(s, millis() - start, "");
+          } else {
+            this->post->play_complex();
+          }
+        }
+        if (this->posts_done == this->count) {
+          fprintf(stderr,
+                  "METRICS %s: %d/%d ok, avg %.1f ms, max %u ms per request; main loop max gap %u ms, %u loops in "
+                  "%u ms\n",
+                  blocking ? "blocking" : "async", this->posts_ok, this->count,
+                  (float) this->duration_sum / this->count, this->duration_max, this->ticker->max_gap_,
+                  this->ticker->loops_, now - this->phase_start);
+          CHECK(this->posts_ok == this->count, "%d of %d posts failed", this->count - this->posts_ok, this->count);
+          CHECK(max_gap == 0 || this->ticker->max_gap_ <= max_gap, "main loop blocked for %u ms",
+                this->ticker->max_gap_);
+          this->request("GET", "/stats", [](int s, std::string &b) {
+            fprintf(stderr, "SERVER connections/requests: %s\n", b.c_str());
+          });
+          this->step = 3;
+        }
+        break;
+      case 3:
+        if (this->pending == 0) {
+          fprintf(stderr, "DONE failures=%d\n", failures);
+          exit(failures != 0);
+        }
+        break;
+    }
+  }
+
+  void on_response(int status, uint32_t duration, const char *body) {
+    this->posts_done++;
+    if (status == 200 && (blocking || strcmp(body, "POST /write temperature value=21.5") == 0))
+      this->posts_ok++;
+    else
+      fprintf(stderr, "post failed: %d '%s'\n", status, body);
+    this->duration_sum += duration;
+    if (duration > this->duration_max)
+      this->duration_max = duration;
+  }
+};
+
+void setup() {
+  port = atoi(getenv("HTTP_PORT"));
+  blocking = getenv("BLOCKING") != nullptr;
+  if (getenv("MAX_GAP"))
+    max_gap = atoi(getenv("MAX_GAP"));
+  host::setup_preferences();
+  App.pre_setup("httptest", "httptest", "", "", __DATE__, false);
+  auto *log = new logger::Logger(115200, 512);
+  logger::global_logger = log;
+  App.register_component(log);
+  auto *ticker = new Ticker();
+  App.register_component(ticker);
+  auto *http = new HttpRequestComponent();
+  http->set_timeout(5000);
+  http->set_useragent("ESPHome");
+  http->set_follow_redirects(true);
+  http->set_redirect_limit(3);
+  if (getenv("MAX_CONNECTIONS"))
+    http->set_max_connections(atoi(getenv("MAX_CONNECTIONS")));
+  App.register_component(http);
+
+  auto *driver = new Driver();
+  driver->http = http;
+  driver->ticker = ticker;
+  if (getenv("COUNT"))
+    driver->count = atoi(getenv("COUNT"));
+  if (getenv("INTERVAL"))
+    driver->interval = atoi(getenv("INTERVAL"));
+  auto *post = new HttpRequestSendAction<>(http);
+  post->set_url("http://127.0.0.1:" + std::to_string(port) + "/write");
+  post->set_method("POST");
+  post->set_body(std::string("temperature value=21.5"));
+  auto *trigger = new HttpRequestResponseTrigger();
+  post->register_response_trigger(trigger);
+  auto *automation = new Automation<int32_t, uint32_t>(trigger);
+  automation->add_actions({new LambdaAction<int32_t, uint32_t>([driver, http](int32_t status, uint32_t duration) {
+    driver->on_response(status, duration, http->get_string());
+  })});
+  driver->post = post;
+  auto *get = new HttpRequestSendAction<>(http);
+  get->set_url([]() {
+    static int run = 0;
+    return "http://127.0.0.1:" + std::to_string(port) + "/echo?script" + std::to_string(++run);
+  });
+  get->set_method("GET");
+  driver->script.add_actions({get, new LambdaAction<>([driver, http]() {
+                                driver->script_runs++;
+                                driver->script_body = http->get_string();
+                              })});
+  App.register_component(driver);
+  App.setup();
+}
+void loop() { App.loop(); }
@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+# Build a host app that checks the asynchronous requests of http_request against a local server, then compare how
+# long posting a sample blocks the main loop with and without them, also with a server that closes idle connections
+source "$(dirname "$0")/../common.sh"
+
+trap 'kill $(jobs -p) 2>/dev/null || true; rm -rf "$build"' EXIT
+
+srcs=(
+  core/application.cpp core/component.cpp core/helpers.cpp core/log.cpp core/scheduler.cpp core/util.cpp
+  core/string_ref.cpp components/host/core.cpp components/host/preferences.cpp
+  components/preferences/keyed_preferences.cpp components/network/util.cpp components/logger/logger.cpp
+  components/logger/logger_host.cpp
+)
+g++ "${host_flags[@]}" -O1 "$here/main.cpp" "${srcs[@]/#/$repo/esphome/}" "$repo"/esphome/components/socket/*.cpp \
+  "$repo"/esphome/components/http_request/*.cpp -o "$build/http_test"
+
+run() {
+  local port=$1
+  shift
+  env "$@" python3 "$here/server.py" "$port" &
+  local server=$!
+  sleep 0.5
+  # The app exits with an error when a check failed, the log is left out
+  (cd "$build" && env "$@" HTTP_PORT="$port" timeout 120 ./http_test 2>&1 | grep -v '^\[')
+  kill $server
+  wait $server 2>/dev/null || true
+}
+
+# A post every 500 ms to a server that takes 300 ms to answer
+run 18088 LATENCY=0.3 COUNT=10 INTERVAL=500 MAX_GAP=100
+run 18088 LATENCY=0.3 COUNT=10 INTERVAL=500 BLOCKING=1
+# A post every 100 ms, with the connection closed by the server when idle for 20 ms
+run 18089 LATENCY=0.05 COUNT=30 INTERVAL=100 MAX_GAP=100
+run 18089 LATENCY=0.05 COUNT=30 INTERVAL=100 IDLE_CLOSE=0.02
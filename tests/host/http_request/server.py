@@ -0,0 +1,95 @@
+"""Local HTTP/1.1 server with keep-alive for the http_request host test.
+
+Answers after LATENCY seconds and closes idle connections after IDLE_CLOSE seconds
+when it is set. The paths cover chunked, close-delimited, redirected, 204 and
+100-continue responses, /stats counts connections and requests, anything else
+echoes the request line and body.
+"""
+
+import asyncio
+import os
+import sys
+
+LATENCY = float(os.environ.get("LATENCY", "0.05"))
+IDLE_CLOSE = float(os.environ.get("IDLE_CLOSE", "0"))
+stats = {"connections": 0, "requests": 0}
+
+
+def response(status, payload=b"", headers=b""):
+    return (
+        b"HTTP/1.1 %s\r\n%sContent-Length: %d\r\n\r\n" % (status, headers, len(payload))
+        + payload
+    )
+
+
+async def chunked(writer):
+    writer.write(b"HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n")
+    for i in range(200):
+        chunk = bytes([65 + i % 26]) * (97 + i)
+        writer.write(b"%x;ext=1\r\n" % len(chunk) + chunk + b"\r\n")
+        if i % 50 == 0:
+            await writer.drain()
+            await asyncio.sleep(0.01)
+    writer.write(b"0\r\nX-Trailer: 1\r\n\r\n")
+
+
+async def handle(reader, writer):
+    stats["connections"] += 1
+    try:
+        while True:
+            try:
+                line = await asyncio.wait_for(reader.readline(), IDLE_CLOSE or None)
+            except asyncio.TimeoutError:
+                break
+            if not line:
+                break
+            method, path, _ = line.decode().split(" ", 2)
+            headers = {}
+            while h := (await reader.readline()).decode().strip():
+                k, v = h.split(":", 1)
+                headers[k.strip().lower()] = v.strip()
+            length = int(headers.get("content-length", "0"))
+            body = await reader.readexactly(length)
+            stats["requests"] += 1
+            await asyncio.sleep(LATENCY)
+            if path.startswith("/stats"):
+                counts = f"{stats['connections']} {stats['requests']}"
+                writer.write(response(b"200 OK", counts.encode()))
+            elif path.startswith("/chunked"):
+                await chunked(writer)
+            elif path.startswith("/close"):
+                writer.write(b"HTTP/1.0 200 OK\r\n\r\n" + b"z" * 5000)
+                await writer.drain()
+                break
+            elif path.startswith("/redirect"):
+                location = b"Location: /echo?redirected\r\n"
+                writer.write(response(b"302 Found", b"moved", location))
+            elif path == "/rel/a?q":
+                writer.write(response(b"301 Moved", headers=b"Location: b?x\r\n"))
+            elif path == "/rel/q":
+                writer.write(response(b"301 Moved", headers=b"Location: ?y\r\n"))
+            elif path == "/emptyloc":
+                writer.write(response(b"302 Found"))
+            elif path.startswith("/nocontent"):
+                writer.write(b"HTTP/1.1 204 No Content\r\n\r\n")
+            elif path.startswith("/continue"):
+                writer.write(b"HTTP/1.1 100 Continue\r\n\r\n")
+                writer.write(response(b"201 Created", b"ok"))
+            else:
+                payload = method.encode() + b" " + path.encode() + b" " + body
+                reply = response(b"200 OK", payload)
+                # A HEAD response has the headers of the GET response, but no body
+                writer.write(reply[: -len(payload)] if method == "HEAD" else reply)
+            await writer.drain()
+    except (ConnectionError, asyncio.IncompleteReadError):
+        pass
+    writer.close()
+
+
+async def main():
+    server = await asyncio.start_server(handle, "127.0.0.1", int(sys.argv[1]))
+    async with server:
+        await server.serve_forever()
+
+
+asyncio.run(main())
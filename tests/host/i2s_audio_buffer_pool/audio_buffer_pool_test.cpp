@@ -0,0 +1,309 @@
+// Checks AudioBufferPool with a producer and a consumer thread, then compares the handoff through the pool with the
+// previous one, where every 1 KiB chunk was copied into a DataEvent, through a queue and into a sample buffer.
+
+#include "esphome/components/i2s_audio/speaker/audio_buffer_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <random>
+#include <sched.h>
+#include <thread>
+#include <vector>
+
+namespace esphome {
+uint32_t millis() { return 0; }
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome::i2s_audio;
+
+static const size_t BUFFER_SIZE = 1024;
+static const size_t BUFFER_COUNT = 20;
+
+/// The previous queue item, copied into and out of the queue by value
+struct DataEvent {
+  bool stop;
+  size_t len;
+  uint8_t data[BUFFER_SIZE];
+};
+
+/// Stands in for a FreeRTOS queue of DataEvent: items are copied in and out under a lock
+struct CopyQueue {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<DataEvent> slots = std::vector<DataEvent>(BUFFER_COUNT);
+  size_t head = 0, count = 0;
+
+  bool send(const DataEvent &event) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (this->count == BUFFER_COUNT)
+      return false;
+    memcpy(&this->slots[(this->head + this->count) % BUFFER_COUNT], &event, sizeof(event));
+    this->count++;
+    this->cv.notify_one();
+    return true;
+  }
+  bool receive(DataEvent *event) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (!this->cv.wait_for(lock, std::chrono::milliseconds(100), [this] { return this->count > 0; }))
+      return false;
+    memcpy(event, &this->slots[this->head], sizeof(*event));
+    this->head = (this->head + 1) % BUFFER_COUNT;
+    this->count--;
+    return true;
+  }
+};
+
+/// Stands in for the task notification of the player task
+struct Notification {
+  std::mutex mutex;
+  std::condition_variable cv;
+  unsigned count = 0;
+
+  void give() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->count++;
+    this->cv.notify_one();
+  }
+  unsigned take(int timeout_ms) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this] { return this->count > 0; });
+    unsigned count = this->count;
+    this->count = 0;
+    return count;
+  }
+};
+
+/// Expand 16-bit mono samples into stereo frames like the player task does
+static void expand(const uint8_t *data, size_t len, uint32_t *frames) {
+  const auto *samples = reinterpret_cast<const uint16_t *>(data);
+  for (size_t i = 0; i < len / 2; i++)
+    frames[i] = (uint32_t(samples[i]) << 16) | samples[i];
+}
+
+static double cpu_seconds() {
+  timespec t;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Buffers of random length go through two threads in order and unchanged, in_use() and reset() keep track
+static bool test_pool() {
+  AudioBufferPool pool;
+  if (!pool.init(BUFFER_COUNT, BUFFER_SIZE) || pool.init(0, 1) || pool.init(256, 1) ||
+      !pool.init(BUFFER_COUNT, BUFFER_SIZE)) {
+    puts("init FAILED");
+    return false;
+  }
+  std::atomic<bool> failed{false};
+  const uint32_t count = 200000;
+  std::thread consumer([&] {
+    for (uint32_t expected = 0; expected < count;) {
+      auto *b = pool.receive();
+      if (b == nullptr) {
+        std::this_thread::yield();
+        continue;
+      }
+      uint32_t seq;
+      memcpy(&seq, b->data, 4);
+      if (seq != expected || b->len != 4 + seq % 1000)
+        failed = true;
+      for (size_t i = 4; i < b->len; i++) {
+        if (b->data[i] != uint8_t(seq + i))
+          failed = true;
+      }
+      pool.release(b);
+      expected++;
+    }
+  });
+  for (uint32_t seq = 0; seq < count;) {
+    auto *b = pool.acquire();
+    if (b == nullptr) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (b->len != 0 || pool.in_use() == 0)
+      failed = true;
+    memcpy(b->data, &seq, 4);
+    b->len = 4 + seq % 1000;
+    for (size_t i = 4; i < b->len; i++)
+      b->data[i] = uint8_t(seq + i);
+    pool.submit(b);
+    seq++;
+  }
+  consumer.join();
+  if (pool.in_use() != 0)
+    failed = true;
+  for (size_t i = 0; i < BUFFER_COUNT; i++) {
+    if (pool.acquire() == nullptr)
+      failed = true;
+  }
+  if (pool.acquire() != nullptr || pool.in_use() != BUFFER_COUNT)
+    failed = true;
+  pool.reset();
+  if (pool.in_use() != 0)
+    failed = true;
+  puts(failed ? "pool FAILED" : "pool ok");
+  return !failed;
+}
+
+// Handoff and expansion of one buffer without threads, the queue reduced to its copies
+static void bench_handoff(const std::vector<uint8_t> &src) {
+  const size_t iterations = 4000000;
+  const size_t chunks = src.size() / BUFFER_SIZE;
+  std::vector<DataEvent> slots(BUFFER_COUNT);
+  uint32_t frames[BUFFER_SIZE / 2];
+  uint64_t sum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t k = 0; k < iterations; k++) {
+    DataEvent event;
+    event.stop = false;
+    event.len = BUFFER_SIZE;
+    memcpy(event.data, &src[(k % chunks) * BUFFER_SIZE], BUFFER_SIZE);
+    memcpy(&slots[k % BUFFER_COUNT], &event, sizeof(event));
+    asm volatile("" ::"r"(slots.data()) : "memory");
+    DataEvent received;
+    memcpy(&received, &slots[k % BUFFER_COUNT], sizeof(received));
+    int16_t buffer[BUFFER_SIZE / 2];
+    memmove(buffer, received.data, received.len);
+    expand(reinterpret_cast<uint8_t *>(buffer), received.len, frames);
+    asm volatile("" ::"r"(frames) : "memory");
+    sum += frames[k % 512];
+  }
+  std::chrono::duration<double, std::nano> by_value = std::chrono::steady_clock::now() - start;
+
+  AudioBufferPool pool;
+  pool.init(BUFFER_COUNT, BUFFER_SIZE);
+  start = std::chrono::steady_clock::now();
+  for (size_t k = 0; k < iterations; k++) {
+    auto *b = pool.acquire();
+    memcpy(b->data, &src[(k % chunks) * BUFFER_SIZE], BUFFER_SIZE);
+    b->len = BUFFER_SIZE;
+    pool.submit(b);
+    b = pool.receive();
+    expand(b->data, b->len, frames);
+    pool.release(b);
+    asm volatile("" ::"r"(frames) : "memory");
+    sum += frames[k % 512];
+  }
+  std::chrono::duration<double, std::nano> pooled = std::chrono::steady_clock::now() - start;
+  printf("per 1 KiB buffer, one thread: by value %.0f ns, pool %.0f ns (%llu)\n", by_value.count() / iterations,
+         pooled.count() / iterations, (unsigned long long) sum);
+}
+
+static void report(const char *name, size_t total, double wall, double cpu, uint64_t sum) {
+  // 16 kHz 16-bit mono is 32000 bytes per second
+  printf("%s: %6.0f MB/s, %.2f us CPU per second of 16 kHz audio (%llx)\n", name, total / wall / 1e6,
+         cpu / (total / 32000.0) * 1e6, (unsigned long long) sum);
+}
+
+// Continuous playback with a producer and a player thread
+static void bench_playback(const std::vector<uint8_t> &src, size_t total) {
+  {
+    CopyQueue queue;
+    uint64_t sum = 0;
+    double cpu_start = cpu_seconds();
+    auto start = std::chrono::steady_clock::now();
+    std::thread player([&] {
+      DataEvent event;
+      int16_t buffer[BUFFER_SIZE / 2];
+      uint32_t frames[BUFFER_SIZE / 2];
+      while (queue.receive(&event) && !event.stop) {
+        memmove(buffer, event.data, event.len);
+        expand(reinterpret_cast<uint8_t *>(buffer), event.len, frames);
+        sum += frames[event.len / 2 - 1];
+      }
+    });
+    DataEvent event;
+    event.stop = false;
+    event.len = BUFFER_SIZE;
+    for (size_t done = 0; done < total;) {
+      memcpy(event.data, &src[done % src.size()], BUFFER_SIZE);
+      if (!queue.send(event)) {
+        std::this_thread::yield();
+        continue;
+      }
+      done += BUFFER_SIZE;
+    }
+    event.stop = true;
+    while (!queue.send(event))
+      std::this_thread::yield();
+    player.join();
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+    report("by-value queue", total, wall.count(), cpu_seconds() - cpu_start, sum);
+  }
+  {
+    AudioBufferPool pool;
+    pool.init(BUFFER_COUNT, BUFFER_SIZE);
+    Notification notification;
+    std::atomic<bool> stop{false};
+    uint64_t sum = 0;
+    double cpu_start = cpu_seconds();
+    auto start = std::chrono::steady_clock::now();
+    std::thread player([&] {
+      uint32_t frames[BUFFER_SIZE / 2];
+      while (!stop) {
+        auto *b = pool.receive();
+        if (b == nullptr) {
+          notification.take(100);
+          continue;
+        }
+        expand(b->data, b->len, frames);
+        sum += frames[b->len / 2 - 1];
+        pool.release(b);
+      }
+    });
+    for (size_t done = 0; done < total;) {
+      auto *b = pool.acquire();
+      if (b == nullptr) {
+        std::this_thread::yield();
+        continue;
+      }
+      memcpy(b->data, &src[done % src.size()], BUFFER_SIZE);
+      b->len = BUFFER_SIZE;
+      pool.submit(b);
+      notification.give();
+      done += BUFFER_SIZE;
+    }
+    while (pool.in_use() > 0)
+      std::this_thread::yield();
+    stop = true;
+    notification.give();
+    player.join();
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+    report("buffer pool   ", total, wall.count(), cpu_seconds() - cpu_start, sum);
+  }
+}
+
+int main(int argc, char **argv) {
+  if (!test_pool())
+    return 1;
+  if (argc > 1 && strcmp(argv[1], "check") == 0)
+    return 0;
+
+  std::vector<uint8_t> src(1 << 20);
+  std::mt19937 rng(5);
+  for (auto &b : src)
+    b = rng();
+  // 512 MiB, about 4.5 h of 16 kHz mono audio
+  size_t total = size_t(512) << 20;
+  if (getenv("PLAYBACK_MIB") != nullptr)
+    total = size_t(atoi(getenv("PLAYBACK_MIB"))) << 20;
+  for (int round = 0; round < 2; round++) {
+    bench_handoff(src);
+    bench_playback(src, total);
+  }
+  return 0;
+}
@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+# Check AudioBufferPool under TSan, then time the handoff at -O2 and -Os. PLAYBACK_MIB sets the amount of audio
+# played through two threads, 512 by default.
+source "$(dirname "$0")/../common.sh"
+
+flags=("${host_flags[@]}" -pthread)
+srcs=("$here/audio_buffer_pool_test.cpp" "$repo/esphome/components/i2s_audio/speaker/audio_buffer_pool.cpp"
+  "$repo/esphome/core/helpers.cpp")
+g++ "${flags[@]}" -O1 -g -fsanitize=thread "${srcs[@]}" -o "$build/test_tsan"
+"$build/test_tsan" check
+for opt in -O2 -Os; do
+  g++ "${flags[@]}" "$opt" "${srcs[@]}" -o "$build/test"
+  echo "$opt:"
+  "$build/test"
+done
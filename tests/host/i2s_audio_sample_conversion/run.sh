@@ -0,0 +1,12 @@
+#!/usr/bin/env bash
+# Check convert_samples() under ASan/UBSan, then time it at -O2 and -Os
+source "$(dirname "$0")/../common.sh"
+
+srcs=("$here/sample_conversion_test.cpp" "$repo/esphome/components/i2s_audio/microphone/sample_conversion.cpp")
+g++ "${host_flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all "${srcs[@]}" -o "$build/test_asan"
+NO_BENCH=1 "$build/test_asan"
+for opt in -O2 -Os; do
+  g++ "${host_flags[@]}" "$opt" "${srcs[@]}" -o "$build/test"
+  echo "$opt:"
+  "$build/test"
+done
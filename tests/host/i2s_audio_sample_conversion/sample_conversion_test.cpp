@@ -0,0 +1,187 @@
+// Checks convert_samples() against the conversion I2SAudioMicrophone::read() did before it and for every option,
+// then times it with 256-sample reads like voice_assistant makes.
+
+#include "esphome/components/i2s_audio/microphone/sample_conversion.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace esphome::i2s_audio;
+
+// The conversion before convert_samples(), for 32-bit microphones
+static size_t previous_read(int16_t *buf, size_t bytes_read) {
+  std::vector<int16_t> samples;
+  size_t samples_read = bytes_read / sizeof(int32_t);
+  samples.resize(samples_read);
+  for (size_t i = 0; i < samples_read; i++) {
+    int32_t temp = reinterpret_cast<int32_t *>(buf)[i] >> 14;
+    samples[i] = std::max<int32_t>(INT16_MIN, std::min<int32_t>(temp, INT16_MAX));
+  }
+  memcpy(buf, samples.data(), samples_read * sizeof(int16_t));
+  return samples_read * sizeof(int16_t);
+}
+
+static int failures = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      printf("FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); \
+      failures++; \
+    } \
+  } while (0)
+
+static SampleConversion conversion_32_bit() {
+  SampleConversion c;
+  c.bits_per_sample = 32;
+  c.shift = 14;
+  return c;
+}
+
+static void test_matches_previous(std::mt19937 &rng) {
+  for (int it = 0; it < 100; it++) {
+    size_t n = rng() % 600;
+    std::vector<int32_t> a(n);
+    for (auto &v : a)
+      v = (int32_t) rng();
+    std::vector<int32_t> b = a;
+    size_t previous_len = previous_read(reinterpret_cast<int16_t *>(a.data()), n * 4);
+    int64_t dc = 0;
+    size_t len = convert_samples(conversion_32_bit(), &dc, b.data(), n * 4);
+    CHECK(previous_len == len && memcmp(a.data(), b.data(), len) == 0);
+  }
+}
+
+static void test_16_bit_passthrough() {
+  std::vector<int16_t> a = {1, -2, 3, 32767, -32768};
+  auto b = a;
+  SampleConversion c;
+  int64_t dc = 0;
+  CHECK(convert_samples(c, &dc, a.data(), 10) == 10 && a == b);
+  // The partial sample is dropped
+  CHECK(convert_samples(c, &dc, a.data(), 9) == 8);
+}
+
+static void test_gain() {
+  std::vector<int16_t> a = {100, -100, 20000, -20000};
+  SampleConversion c;
+  c.gain_factor = 2;
+  int64_t dc = 0;
+  convert_samples(c, &dc, a.data(), 8);
+  CHECK(a[0] == 200 && a[1] == -200 && a[2] == 32767 && a[3] == -32768);
+}
+
+static void test_channel_selection() {
+  std::vector<int32_t> a = {1 << 16, 2 << 16, 3 << 16, 4 << 16, 5 << 16, 6 << 16};
+  SampleConversion c;
+  c.bits_per_sample = 32;
+  c.shift = 16;
+  c.channels = 2;
+  c.channel = 1;
+  int64_t dc = 0;
+  size_t len = convert_samples(c, &dc, a.data(), a.size() * 4);
+  auto *out = reinterpret_cast<int16_t *>(a.data());
+  CHECK(len == 6 && out[0] == 2 && out[1] == 4 && out[2] == 6);
+
+  // A channel out of range picks the last one
+  std::vector<int16_t> s = {10, 20, 30, 40};
+  c.bits_per_sample = 16;
+  c.shift = 0;
+  c.channel = 5;
+  len = convert_samples(c, &dc, s.data(), 8);
+  CHECK(len == 4 && s[0] == 20 && s[1] == 40);
+}
+
+static void test_dc_offset() {
+  // A 1 kHz square wave at 16 kHz with an offset of 3000, converted in 20 ms reads
+  const int n = 16000;
+  std::vector<int16_t> a(n);
+  for (int i = 0; i < n; i++)
+    a[i] = 3000 + ((i / 8) % 2 ? 1000 : -1000);
+  SampleConversion c;
+  c.correct_dc_offset = true;
+  int64_t dc = 0;
+  for (int offset = 0; offset < n; offset += 320)
+    convert_samples(c, &dc, a.data() + offset, 320 * 2);
+  // The offset is gone after a second, the signal stays
+  long sum = 0;
+  int peak = 0;
+  for (int i = n - 1600; i < n; i++) {
+    sum += a[i];
+    peak = std::max(peak, std::abs((int) a[i]));
+  }
+  CHECK(std::abs(sum / 1600) < 20);
+  CHECK(peak > 900 && peak < 1100);
+  CHECK((dc >> 10) > 2980 && (dc >> 10) < 3020);
+}
+
+static void test_no_overflow() {
+  std::vector<int32_t> a = {INT32_MAX, INT32_MIN};
+  SampleConversion c;
+  c.bits_per_sample = 32;
+  c.gain_factor = 64;
+  c.correct_dc_offset = true;
+  int64_t dc = 0;
+  convert_samples(c, &dc, a.data(), 8);
+  auto *out = reinterpret_cast<int16_t *>(a.data());
+  CHECK(out[0] == 32767 && out[1] == -32768);
+}
+
+static void test_unsupported_width() {
+  int32_t x = 0;
+  SampleConversion c;
+  c.bits_per_sample = 24;
+  int64_t dc = 0;
+  CHECK(convert_samples(c, &dc, &x, 4) == 0);
+}
+
+template<typename F> static void bench(const char *name, std::vector<int32_t> &buf, const std::vector<int32_t> &src,
+                                       F convert) {
+  const size_t iterations = 400000;
+  auto start = std::chrono::steady_clock::now();
+  uint32_t acc = 0;
+  for (size_t i = 0; i < iterations; i++) {
+    memcpy(buf.data(), src.data(), src.size() * 4);
+    acc += convert();
+    acc += reinterpret_cast<int16_t *>(buf.data())[i % src.size()];
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  printf("%-24s %5.2f ns/sample (%u)\n", name, elapsed.count() / (iterations * src.size()), acc);
+}
+
+int main() {
+  std::mt19937 rng(3);
+  test_matches_previous(rng);
+  test_16_bit_passthrough();
+  test_gain();
+  test_channel_selection();
+  test_dc_offset();
+  test_no_overflow();
+  test_unsupported_width();
+  printf(failures ? "%d failures\n" : "all ok\n", failures);
+  if (failures != 0 || getenv("NO_BENCH") != nullptr)
+    return failures != 0;
+
+  const size_t samples = 256;
+  std::vector<int32_t> src(samples), buf(samples);
+  for (auto &v : src)
+    v = (int32_t) rng();
+  int64_t dc = 0;
+  SampleConversion c = conversion_32_bit();
+  SampleConversion gain = c;
+  gain.gain_factor = 4;
+  SampleConversion dc_offset = c;
+  dc_offset.correct_dc_offset = true;
+  for (int round = 0; round < 2; round++) {
+    bench("previous (vector copy)", buf, src,
+          [&] { return previous_read(reinterpret_cast<int16_t *>(buf.data()), samples * 4); });
+    bench("shift 14", buf, src, [&] { return convert_samples(c, &dc, buf.data(), samples * 4); });
+    bench("shift 14, gain 4", buf, src, [&] { return convert_samples(gain, &dc, buf.data(), samples * 4); });
+    bench("shift 14, dc offset", buf, src, [&] { return convert_samples(dc_offset, &dc, buf.data(), samples * 4); });
+  }
+  return 0;
+}
@@ -0,0 +1,87 @@
+// Host app for run.sh: two sensors at 50 Hz written through the influxdb component to a local receiver
+
+#include "esphome/components/influxdb/influxdb.h"
+#include "esphome/components/host/preferences.h"
+#include "esphome/components/logger/logger.h"
+#include "esphome/core/application.h"
+#include "esphome/core/log.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+using namespace esphome;
+
+class HostTime : public time::RealTimeClock {
+ public:
+  void update() override {}
+};
+
+// Produces a sample every period ms, a ramp so that gaps and reordering show up at the receiver
+class Source : public Component {
+ public:
+  sensor::Sensor *sensor;
+  uint32_t period, next{0};
+  int produced{0}, limit;
+  void loop() override {
+    uint32_t now = millis();
+    if (this->produced < this->limit && (int32_t) (now - this->next) >= 0) {
+      this->next = (this->next == 0 ? now : this->next) + this->period;
+      this->sensor->publish_state(this->produced++);
+    }
+  }
+};
+
+class Ticker : public Component {
+ public:
+  void loop() override {
+    uint32_t now = millis();
+    if (this->last_ != 0 && now - this->last_ > this->max_gap_)
+      this->max_gap_ = now - this->last_;
+    this->last_ = now;
+    if (now > this->end_) {
+      fprintf(stderr, "TICKER max gap %u ms\n", this->max_gap_);
+      exit(0);
+    }
+  }
+  uint32_t last_{0}, max_gap_{0}, end_;
+};
+
+void setup() {
+  int port = atoi(getenv("PORT"));
+  host::setup_preferences();
+  App.pre_setup("influxtest", "influxtest", "", "", __DATE__, false);
+  auto *log = new logger::Logger(115200, 512);
+  logger::global_logger = log;
+  App.register_component(log);
+  auto *http = new http_request::HttpRequestComponent();
+  http->set_timeout(5000);
+  http->set_useragent("ESPHome");
+  http->set_follow_redirects(true);
+  http->set_redirect_limit(3);
+  App.register_component(http);
+  auto *clock = new HostTime();
+  App.register_component(clock);
+
+  auto *writer = new influxdb::InfluxDBWriter(http, clock);
+  writer->set_update_interval(1000);
+  writer->set_url("http://127.0.0.1:" + std::to_string(port) + "/write?db=test");
+  writer->add_header("Authorization", "Token secret");
+  writer->set_buffer_size(atoi(getenv("BUFFER") ? getenv("BUFFER") : "512"));
+  writer->set_max_batch_size(100);
+  int duration = atoi(getenv("DURATION") ? getenv("DURATION") : "10");
+  const char *series[] = {"temperature,room=kitchen value=", "humidity,room=kitchen\\ 2 value="};
+  for (int i = 0; i < 2; i++) {
+    auto *s = new sensor::Sensor();
+    auto *src = new Source();
+    src->sensor = s;
+    src->period = 20;  // 50 Hz per sensor
+    src->limit = duration * 50;
+    writer->add_sensor(s, series[i], false);
+    App.register_component(src);
+  }
+  App.register_component(writer);
+  auto *ticker = new Ticker();
+  ticker->end_ = millis() + (duration + 4) * 1000;
+  App.register_component(ticker);
+  App.setup();
+}
+void loop() { App.loop(); }
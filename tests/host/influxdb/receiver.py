@@ -0,0 +1,88 @@
+"""Stand-in InfluxDB /write endpoint: parses line protocol, can fail for a while."""
+import asyncio
+import json
+import os
+import sys
+import time
+
+FAIL_FROM = float(os.environ.get("FAIL_FROM", "-1"))  # seconds after start
+FAIL_FOR = float(os.environ.get("FAIL_FOR", "0"))
+start = time.time()
+stats = {
+    "connections": 0,
+    "requests": 0,
+    "failed": 0,
+    "lines": 0,
+    "bad": 0,
+    "series": {},
+    "bytes": 0,
+}
+
+
+async def handle(reader, writer):
+    stats["connections"] += 1
+    try:
+        while True:
+            line = await reader.readline()
+            if not line:
+                break
+            method, path, _ = line.decode().split(" ", 2)
+            headers = {}
+            while True:
+                h = (await reader.readline()).decode().strip()
+                if not h:
+                    break
+                k, v = h.split(":", 1)
+                headers[k.strip().lower()] = v.strip()
+            body = await reader.readexactly(int(headers.get("content-length", "0")))
+            stats["requests"] += 1
+            if path.startswith("/stats"):
+                diffs = []
+                for pts in stats["series"].values():
+                    pts = sorted(pts, key=lambda p: p[1])
+                    diffs += [b[0] - a[0] for a, b in zip(pts, pts[1:])]
+                    values = [p[1] for p in pts]
+                    assert values == sorted(values)
+                stats["ts_diff_min_max"] = [min(diffs), max(diffs)] if diffs else []
+                counts = {k: len(v) for k, v in stats["series"].items()}
+                summary = {k: v for k, v in stats.items() if k != "series"}
+                payload = json.dumps(summary | {"series": counts}).encode()
+                writer.write(
+                    b"HTTP/1.1 200 OK\r\nContent-Length: %d\r\n\r\n" % len(payload)
+                    + payload
+                )
+            elif 0 <= FAIL_FROM <= time.time() - start < FAIL_FROM + FAIL_FOR:
+                stats["failed"] += 1
+                writer.write(
+                    b"HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n"
+                )
+            else:
+                assert "precision=ms" in path, path
+                assert headers.get("authorization") == "Token secret", headers
+                stats["bytes"] += len(body)
+                now_ms = time.time() * 1000
+                for entry in body.decode().splitlines():
+                    try:
+                        series, field, ts = entry.rsplit(" ", 2)
+                        ts = int(ts)
+                        value = float(field.split("=", 1)[1])
+                        assert abs(ts - now_ms) < 120000, (ts, now_ms)
+                        stats["series"].setdefault(series, []).append((ts, value))
+                        stats["lines"] += 1
+                    except Exception as e:
+                        stats["bad"] += 1
+                        print("bad line", entry, e, file=sys.stderr)
+                writer.write(b"HTTP/1.1 204 No Content\r\n\r\n")
+            await writer.drain()
+    except (ConnectionError, asyncio.IncompleteReadError):
+        pass
+    writer.close()
+
+
+async def main():
+    server = await asyncio.start_server(handle, "127.0.0.1", int(sys.argv[1]))
+    async with server:
+        await server.serve_forever()
+
+
+asyncio.run(main())
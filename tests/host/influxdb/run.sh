@@ -0,0 +1,41 @@
+#!/usr/bin/env bash
+# Build a host app that writes two 50 Hz sensors through the influxdb component and check what a local line
+# protocol receiver gets, once with a healthy receiver and once with one that answers 503 for 4 s
+source "$(dirname "$0")/../common.sh"
+
+trap 'kill $(jobs -p) 2>/dev/null || true; rm -rf "$build"' EXIT
+
+srcs=(
+  core/application.cpp core/component.cpp core/helpers.cpp core/log.cpp core/scheduler.cpp core/util.cpp
+  core/string_ref.cpp core/time.cpp components/host/core.cpp components/host/preferences.cpp
+  components/preferences/keyed_preferences.cpp components/network/util.cpp components/logger/logger.cpp
+  components/logger/logger_host.cpp components/sensor/sensor.cpp components/sensor/filter.cpp
+  components/sensor/automation.cpp components/time/real_time_clock.cpp components/time/automation.cpp
+  components/influxdb/influxdb.cpp
+)
+g++ "${host_flags[@]}" -O1 -DESPHOME_LOG_LEVEL=4 "$here/main.cpp" "${srcs[@]/#/$repo/esphome/}" \
+  "$repo"/esphome/components/socket/*.cpp "$repo"/esphome/components/http_request/*.cpp -o "$build/influx_test"
+
+run() {
+  local port=$1
+  shift
+  env "$@" python3 "$here/receiver.py" "$port" &
+  local receiver=$!
+  sleep 0.5
+  (cd "$build" && PORT=$port DURATION=10 BUFFER=${BUFFER:-512} ./influx_test > /dev/null)
+  python3 - "$port" <<'PY'
+import json, sys, urllib.request
+stats = json.load(urllib.request.urlopen(f"http://127.0.0.1:{sys.argv[1]}/stats"))
+print(json.dumps(stats))
+# Every sample arrives once, in order, even when writes have to be retried
+assert stats["lines"] == 1000 and stats["bad"] == 0, "samples lost"
+assert all(n == 500 for n in stats["series"].values()), "samples lost"
+assert 0 < stats["ts_diff_min_max"][0] and stats["ts_diff_min_max"][1] < 40, "timestamps off"
+PY
+  kill $receiver
+  wait $receiver 2>/dev/null || true
+}
+
+run 18086
+# Writes back off 1 s, 2 s, 4 s, so the buffer has to hold about 7 s of samples
+BUFFER=1024 run 18087 FAIL_FROM=3 FAIL_FOR=4
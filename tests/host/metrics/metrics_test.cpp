@@ -0,0 +1,173 @@
+// Checks the histograms and the scheduler item table of the metrics registry, then times Histogram::record() and
+// the application loop with 20 looping components and 10 intervals. run.sh builds this with and without
+// USE_RUNTIME_METRICS, the difference of the loop times is the bookkeeping cost.
+
+#include "esphome/core/application.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/metrics.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sched.h>
+#include <vector>
+
+namespace esphome {
+static const auto START = std::chrono::steady_clock::now();
+uint32_t micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - START).count();
+}
+uint32_t millis() { return micros() / 1000; }
+void delay(uint32_t) {}
+void arch_init() {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome;
+
+static bool failed = false;
+
+static void check(bool ok, const char *what) {
+  if (!ok) {
+    printf("%s FAILED\n", what);
+    failed = true;
+  }
+}
+
+class Idle : public Component {
+ public:
+  void loop() override { this->loops++; }
+  uint32_t loops{0};
+};
+
+#ifdef USE_RUNTIME_METRICS
+using metrics::Histogram;
+
+static void test_histogram() {
+  Histogram h;
+  check(h.get_percentile(0.5f) == 0, "empty percentile");
+  // One value on each bound, one just above it and one in the overflow bucket
+  for (uint32_t bound : Histogram::BUCKET_BOUNDS) {
+    h.record(bound);
+    h.record(bound + 1);
+  }
+  for (uint8_t i = 0; i < Histogram::BUCKET_COUNT; i++)
+    check(h.get_bucket(i) == (i == 0 ? 1 : 2) - (i == Histogram::BUCKET_COUNT - 1 ? 1 : 0), "bucket counts");
+  check(h.get_count() == 2 * (Histogram::BUCKET_COUNT - 1), "count");
+  check(h.get_max() == 100001, "max");
+  uint64_t sum = 0;
+  for (uint32_t bound : Histogram::BUCKET_BOUNDS)
+    sum += 2 * uint64_t(bound) + 1;
+  check(h.get_sum() == sum, "sum");
+
+  h.reset();
+  for (uint32_t i = 1; i <= 100; i++)
+    h.record(i * 10);
+  check(h.get_percentile(0.0f) == 100, "p0");
+  check(h.get_percentile(0.5f) == 500, "p50");
+  check(h.get_percentile(0.9f) == 1000, "p90 capped at max");
+  check(h.get_percentile(1.0f) == 1000, "p100");
+  // Large values stay in the overflow bucket, the sum does not wrap
+  h.reset();
+  for (int i = 0; i < 10; i++)
+    h.record(UINT32_MAX);
+  check(h.get_bucket(Histogram::BUCKET_COUNT - 1) == 10 && h.get_sum() == 10ull * UINT32_MAX, "overflow");
+  check(h.get_percentile(0.5f) == UINT32_MAX, "overflow percentile");
+}
+
+static void test_registry() {
+  metrics::MetricsRegistry registry;
+  Idle a, b;
+  Histogram *h = registry.get_scheduler_item_run_time(&a, "update");
+  check(h != nullptr && registry.get_scheduler_item_run_time(&a, "update") == h, "same item");
+  check(registry.get_scheduler_item_run_time(&b, "update") != h, "other component");
+  check(registry.get_scheduler_item_run_time(&a, "") != h, "anonymous item");
+  // The table is reserved once, pointers handed out before stay valid
+  for (int i = 0; i < 100; i++)
+    registry.get_scheduler_item_run_time(&a, "item" + std::to_string(i));
+  check(registry.get_scheduler_items().size() == metrics::MetricsRegistry::MAX_SCHEDULER_ITEMS, "table size");
+  check(registry.scheduler_items_untracked == 100 - (metrics::MetricsRegistry::MAX_SCHEDULER_ITEMS - 3), "untracked");
+  check(registry.get_scheduler_item_run_time(&a, "update") == h, "pointer stable");
+  check(registry.get_scheduler_item_run_time(&a, "item99") == nullptr, "full table");
+
+  std::vector<Component *> looping{&a, &b};
+  registry.register_looping_components(looping);
+  registry.get_component_loop_time(1)->record(5);
+  check(registry.get_components()[1].component == &b && registry.get_components()[1].loop_time.get_count() == 1,
+        "component histograms");
+}
+
+static void bench_record() {
+  Histogram h;
+  std::mt19937 rng(1);
+  // Mostly short loop times with a long tail, like on a device
+  std::vector<uint32_t> values(1 << 16);
+  for (auto &v : values)
+    v = rng() % 8 == 0 ? rng() % 200000 : rng() % 400;
+  const int rounds = 200;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (uint32_t v : values)
+      h.record(v);
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  printf("Histogram::record: %.1f ns (%u)\n", elapsed.count() / (rounds * values.size()), h.get_count());
+}
+#endif
+
+// The loop of an application without any work to do, only the bookkeeping around the calls is left
+static void bench_loop() {
+  App.pre_setup("metrics", "metrics", "", "", __DATE__, false);
+  App.set_loop_interval(0);
+  std::vector<Idle *> components;
+  for (int i = 0; i < 20; i++) {
+    components.push_back(new Idle());
+    App.register_component(components.back());
+  }
+  uint32_t intervals = 0;
+  for (int i = 0; i < 10; i++)
+    App.scheduler.set_interval(components[i], "tick", 1, [&intervals] { intervals++; });
+  HighFrequencyLoopRequester high_frequency;
+  high_frequency.start();
+  App.setup();
+
+  const uint32_t loops = 200000;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    App.loop();
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  check(components.back()->loops >= loops, "components looped");
+  check(intervals > 0, "intervals ran");
+  printf("Application::loop: %.0f ns, %.1f ns per component, %u interval runs\n", elapsed.count() / loops,
+         elapsed.count() / loops / components.size(), intervals);
+#ifdef USE_RUNTIME_METRICS
+  const auto &metrics = metrics::global_metrics;
+  check(metrics.get_components().size() == components.size(), "looping components registered");
+  check(metrics.get_components()[0].loop_time.get_count() >= loops, "loop times recorded");
+  check(metrics.get_scheduler_items().size() == 10, "scheduler items registered");
+  check(metrics.scheduler_executed == intervals && metrics.scheduler_lateness.get_count() == intervals,
+        "scheduler runs recorded");
+  printf("  scheduler lateness p50 %u us, p99 %u us\n", metrics.scheduler_lateness.get_percentile(0.5f),
+         metrics.scheduler_lateness.get_percentile(0.99f));
+#endif
+}
+
+int main(int argc, char **argv) {
+#ifdef USE_RUNTIME_METRICS
+  test_histogram();
+  test_registry();
+  if (failed)
+    return 1;
+  puts("metrics ok");
+  if (argc > 1 && strcmp(argv[1], "check") == 0)
+    return 0;
+  bench_record();
+#endif
+  bench_loop();
+  return failed ? 1 : 0;
+}
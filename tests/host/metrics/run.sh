@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+# Check the metrics registry under ASan/UBSan, then time the application loop at -O2 without and with
+# USE_RUNTIME_METRICS to see what the bookkeeping costs
+source "$(dirname "$0")/../common.sh"
+
+srcs=("$here/metrics_test.cpp"
+  "$repo"/esphome/core/{application,component,helpers,metrics,scheduler,string_ref,util}.cpp)
+g++ "${host_flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all -DUSE_RUNTIME_METRICS \
+  "${srcs[@]}" -o "$build/test_asan"
+"$build/test_asan" check
+g++ "${host_flags[@]}" -O2 "${srcs[@]}" -o "$build/test_plain"
+g++ "${host_flags[@]}" -O2 -DUSE_RUNTIME_METRICS "${srcs[@]}" -o "$build/test"
+echo "without metrics:"
+"$build/test_plain"
+echo "with metrics:"
+"$build/test"
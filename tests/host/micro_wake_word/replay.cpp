@@ -0,0 +1,187 @@
+// Replays WAV files through micro_wake_word. The audio is read from a fake microphone into the ring buffer like on
+// the device, every 20 ms slice runs the shared preprocessor and all models. Prints the detections with their
+// position in the file, and the time per slice for the preprocessor plus all models.
+//
+// Usage: replay <model>... <file.wav>...
+// A model is given as <file.tflite>:<wake word>:<probability cutoff>:<sliding window size>:<tensor arena size>,
+// run.sh makes these from the manifests. The WAV files have to be 16 kHz 16 bit mono.
+
+#include "esphome/components/micro_wake_word/micro_wake_word.h"
+#include "esphome/components/microphone/microphone.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sched.h>
+#include <string>
+#include <vector>
+
+namespace esphome {
+static const auto START = std::chrono::steady_clock::now();
+uint32_t micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - START).count();
+}
+uint32_t millis() { return micros() / 1000; }
+void delay(uint32_t) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+// Only errors and warnings are built in, e.g. for a model that doesn't load
+void esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "[%s] ", tag);
+  vfprintf(stderr, format, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+}
+}  // namespace esphome
+
+using namespace esphome;
+using namespace esphome::micro_wake_word;
+
+/// Hands out the samples of a WAV file, as fast as they are read
+class WavMicrophone : public microphone::Microphone {
+ public:
+  void start() override { this->state_ = microphone::STATE_RUNNING; }
+  void stop() override { this->state_ = microphone::STATE_STOPPED; }
+  size_t read(int16_t *buf, size_t len) override {
+    size_t count = std::min(len / sizeof(int16_t), this->samples.size() - this->position);
+    std::copy_n(this->samples.data() + this->position, count, buf);
+    this->position += count;
+    return count * sizeof(int16_t);
+  }
+
+  bool load(const char *path) {
+    std::ifstream f(path, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 || memcmp(data.data() + 8, "WAVE", 4) != 0)
+      return false;
+    bool format_ok = false;
+    for (size_t pos = 12; pos + 8 <= data.size();) {
+      uint32_t len;
+      memcpy(&len, data.data() + pos + 4, 4);
+      const uint8_t *chunk = data.data() + pos + 8;
+      len = std::min<size_t>(len, data.size() - pos - 8);
+      if (memcmp(data.data() + pos, "fmt ", 4) == 0 && len >= 16) {
+        uint16_t format, channels, bits;
+        uint32_t rate;
+        memcpy(&format, chunk, 2);
+        memcpy(&channels, chunk + 2, 2);
+        memcpy(&rate, chunk + 4, 4);
+        memcpy(&bits, chunk + 14, 2);
+        format_ok = format == 1 && channels == 1 && rate == AUDIO_SAMPLE_FREQUENCY && bits == 16;
+      } else if (memcmp(data.data() + pos, "data", 4) == 0 && format_ok) {
+        this->samples.resize(len / sizeof(int16_t));
+        memcpy(this->samples.data(), chunk, this->samples.size() * sizeof(int16_t));
+        this->position = 0;
+        return true;
+      }
+      pos += 8 + len + (len & 1);
+    }
+    return false;
+  }
+
+  std::vector<int16_t> samples;
+  size_t position{0};
+};
+
+class Replay : public MicroWakeWord {
+ public:
+  /// Feed the whole file through the models, returns the number of detections
+  int run(const char *name) {
+    this->ring_buffer_->reset();
+    this->reset_models_();
+    std::vector<uint32_t> times;
+    int detections = 0;
+    while (true) {
+      int bytes_read = this->read_microphone_();
+      while (this->slice_available_()) {
+        uint32_t start = micros();
+        bool detected = this->detect_wake_word_();
+        times.push_back(micros() - start);
+        if (detected) {
+          // Position of the end of the slice's window
+          size_t samples = times.size() * NEW_SAMPLES_TO_GET + HISTORY_SAMPLES_TO_KEEP;
+          float seconds = samples / float(AUDIO_SAMPLE_FREQUENCY);
+          printf("%s: '%s' detected at %.2f s\n", name, this->detected_wake_word_.c_str(), seconds);
+          detections++;
+        }
+      }
+      if (bytes_read == 0)
+        break;
+    }
+    if (times.empty()) {
+      printf("%s: too short\n", name);
+      return 0;
+    }
+    std::vector<uint32_t> sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+    uint64_t sum = 0;
+    for (uint32_t t : times)
+      sum += t;
+    printf("%s: %zu slices, %d detections, per slice %.1f us average, %u us p99, %u us max\n", name, times.size(),
+           detections, float(sum) / times.size(), sorted[sorted.size() * 99 / 100], sorted.back());
+    return detections;
+  }
+};
+
+static bool ends_with(const std::string &s, const char *suffix) {
+  size_t n = strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+int main(int argc, char **argv) {
+  Replay replay;
+  WavMicrophone mic;
+  replay.set_microphone(&mic);
+  std::vector<const char *> files;
+  // The models are referenced by the component, they stay around until the end
+  std::vector<std::vector<uint8_t>> models;
+  models.reserve(argc);
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (ends_with(arg, ".wav")) {
+      files.push_back(argv[i]);
+      continue;
+    }
+    char path[256], wake_word[64];
+    float cutoff;
+    unsigned window, arena;
+    if (sscanf(argv[i], "%255[^:]:%63[^:]:%f:%u:%u", path, wake_word, &cutoff, &window, &arena) != 5) {
+      fprintf(stderr, "Not a model or WAV file: %s\n", argv[i]);
+      return 2;
+    }
+    std::ifstream f(path, std::ios::binary);
+    models.emplace_back((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    if (models.back().empty()) {
+      fprintf(stderr, "Could not read %s\n", path);
+      return 2;
+    }
+    replay.add_wake_word_model(models.back().data(), cutoff, window, wake_word, arena);
+  }
+  if (models.empty() || files.empty()) {
+    fprintf(stderr, "Usage: %s <model>... <file.wav>...\n", argv[0]);
+    return 2;
+  }
+
+  replay.setup();
+  if (replay.is_failed())
+    return 1;
+  mic.start();
+  int detections = 0;
+  for (const char *file : files) {
+    if (!mic.load(file)) {
+      fprintf(stderr, "%s: not a 16 kHz 16 bit mono WAV file\n", file);
+      return 2;
+    }
+    detections += replay.run(file);
+  }
+  printf("%d detections in %zu files\n", detections, files.size());
+  return 0;
+}
@@ -0,0 +1,37 @@
+#!/usr/bin/env bash
+# Replay WAV files through micro_wake_word with TFLite Micro built for the host and print the detections and the
+# time per slice. Needs TFLITE_MICRO, a checkout of https://github.com/tensorflow/tflite-micro, MODELS, the manifest
+# files of the models to run, and WAVS, the 16 kHz 16 bit mono files to replay. It's skipped without them.
+source "$(dirname "$0")/../common.sh"
+
+if [ -z "${TFLITE_MICRO:-}" ] || [ -z "${MODELS:-}" ] || [ -z "${WAVS:-}" ]; then
+  echo "TFLITE_MICRO, MODELS and WAVS are not set, skipping"
+  exit 0
+fi
+
+make -C "$TFLITE_MICRO" -f tensorflow/lite/micro/tools/make/Makefile -j"$(nproc)" microlite > /dev/null
+lib="$(ls "$TFLITE_MICRO"/gen/*/lib/libtensorflow-microlite.a | head -n 1)"
+downloads="$TFLITE_MICRO/tensorflow/lite/micro/tools/make/downloads"
+mww="$repo/esphome/components/micro_wake_word"
+g++ "${host_flags[@]}" -O2 -DESPHOME_LOG_LEVEL=2 -DTF_LITE_STATIC_MEMORY -I"$TFLITE_MICRO" \
+  -I"$downloads/flatbuffers/include" -I"$downloads/gemmlowp" "$here/replay.cpp" "$mww"/*.cpp \
+  "$repo"/esphome/core/{application,component,helpers,ring_buffer,scheduler,string_ref,util}.cpp "$lib" \
+  -o "$build/replay"
+
+# <file.tflite>:<wake word>:<probability cutoff>:<sliding window size>:<tensor arena size> for each manifest
+models=()
+for manifest in $MODELS; do
+  models+=("$(python3 - "$manifest" <<'PY'
+import json, os, sys
+manifest = json.load(open(sys.argv[1]))
+micro = manifest["micro"]
+model = os.path.join(os.path.dirname(sys.argv[1]), manifest["model"])
+window = micro["sliding_window_average_size"]
+arena = micro.get("tensor_arena_size", 64000)
+print(f"{model}:{manifest['wake_word']}:{micro['probability_cutoff']}:{window}:{arena}")
+PY
+  )")
+done
+
+# shellcheck disable=SC2086
+"$build/replay" "${models[@]}" $WAVS
@@ -0,0 +1,211 @@
+// Drives modbus_controller against a simulated Modbus RTU slave on a fake UART with a simulated clock: 18 power
+// registers needed every second and 40 configuration registers needed hourly, for 10 minutes. Compares polling all of
+// them on every update with per-register poll intervals and merged ranges, and a fixed command throttle with
+// adaptive_throttle for a slave that drops frames arriving less than 40 ms after its last response.
+
+#include "esphome/components/modbus/modbus_rtu.h"
+#include "esphome/components/modbus_controller/modbus_controller.h"
+#include "esphome/core/helpers.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <sched.h>
+#include <vector>
+
+namespace esphome {
+static uint32_t now_ms = 0;
+uint32_t millis() { return now_ms; }
+uint32_t micros() { return now_ms * 1000; }
+void delay(uint32_t) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome;
+
+static const uint32_t DURATION_MS = 10 * 60 * 1000;
+
+/// Answers read requests with the low byte of each register's address, at 9600 baud (about 1 ms per byte) and after
+/// 20 ms of processing
+class SlaveUart : public uart::UARTComponent {
+ public:
+  void write_array(const uint8_t *data, size_t len) override {
+    this->requests++;
+    this->bus_ms += len;
+    if (int32_t(now_ms - this->last_response_end_) < int32_t(this->rest_ms)) {
+      this->dropped++;
+      return;
+    }
+    uint16_t start = (data[2] << 8) | data[3];
+    uint16_t count = (data[4] << 8) | data[5];
+    std::vector<uint8_t> response{data[0], data[1], uint8_t(count * 2)};
+    for (uint16_t i = 0; i < count; i++) {
+      response.push_back(0);
+      response.push_back(uint8_t(start + i));
+    }
+    uint16_t crc = crc16(response.data(), response.size());
+    response.push_back(crc & 0xFF);
+    response.push_back(crc >> 8);
+    this->ready_at_ = now_ms + len + 20 + response.size();
+    this->last_response_end_ = this->ready_at_;
+    this->bus_ms += response.size();
+    this->rx_.insert(this->rx_.end(), response.begin(), response.end());
+  }
+  bool peek_byte(uint8_t *data) override {
+    if (this->available() == 0)
+      return false;
+    *data = this->rx_.front();
+    return true;
+  }
+  bool read_array(uint8_t *data, size_t len) override {
+    for (size_t i = 0; i < len; i++) {
+      data[i] = this->rx_.front();
+      this->rx_.pop_front();
+    }
+    return true;
+  }
+  int available() override { return int32_t(now_ms - this->ready_at_) >= 0 ? this->rx_.size() : 0; }
+  void flush() override {}
+  void check_logger_conflict() override {}
+
+  uint32_t rest_ms{0};
+  uint32_t requests{0};
+  uint32_t dropped{0};
+  uint32_t bus_ms{0};
+
+ protected:
+  std::deque<uint8_t> rx_;
+  uint32_t ready_at_{0};
+  uint32_t last_response_end_{0};
+};
+
+class Item : public modbus_controller::SensorItem {
+ public:
+  Item(uint16_t address, uint32_t poll_interval) : address_(address) {
+    this->register_type = modbus_controller::ModbusRegisterType::HOLDING;
+    this->sensor_value_type = modbus_controller::SensorValueType::U_WORD;
+    this->start_address = address;
+    this->register_count = 1;
+    this->offset = 0;
+    this->bitmask = 0xFFFFFFFF;
+    this->skip_updates = 0;
+    this->poll_interval = poll_interval;
+  }
+  void parse_and_publish(const std::vector<uint8_t> &data) override {
+    if (data.size() >= this->offset + 2u && data[this->offset + 1] == uint8_t(this->address_)) {
+      this->published++;
+    } else {
+      this->wrong++;
+    }
+  }
+
+  uint32_t published{0};
+  uint32_t wrong{0};
+
+ protected:
+  // start_address becomes the one of the range the item is read with
+  uint16_t address_;
+};
+
+struct Result {
+  uint32_t requests;
+  uint32_t dropped;
+  uint32_t power_updates;
+  uint32_t config_updates;
+  bool wrong;
+};
+
+static Result run(const char *name, bool scheduled, uint16_t max_register_gap, bool adaptive, uint32_t rest_ms) {
+  now_ms = 1;
+  SlaveUart uart;
+  uart.rest_ms = rest_ms;
+  modbus::Modbus bus;
+  bus.set_uart_parent(&uart);
+  bus.set_disable_crc(false);
+  modbus_controller::ModbusController controller;
+  controller.set_parent(&bus);
+  controller.set_address(1);
+  bus.register_device(&controller);
+  controller.set_command_throttle(0);
+  controller.set_offline_skip_updates(0);
+  controller.set_max_register_gap(max_register_gap);
+  controller.set_adaptive_throttle(adaptive);
+  const uint32_t update_interval = scheduled ? 60000 : 1000;
+  controller.set_update_interval(update_interval);
+
+  // Power and energy every second with two unused registers in between, the configuration hourly
+  std::vector<Item *> power, config;
+  for (uint16_t address = 0; address < 20; address++) {
+    if (address != 10 && address != 11)
+      power.push_back(new Item(address, scheduled ? 1000 : 0));
+  }
+  for (uint16_t address = 100; address < 140; address++)
+    config.push_back(new Item(address, scheduled ? 3600000 : 0));
+  for (auto *item : power)
+    controller.add_sensor_item(item);
+  for (auto *item : config)
+    controller.add_sensor_item(item);
+  bus.setup();
+  controller.setup();
+
+  for (uint32_t next_update = 1; now_ms < DURATION_MS; now_ms++) {
+    if (now_ms == next_update) {
+      controller.update();
+      next_update += update_interval;
+    }
+    bus.loop();
+    controller.loop();
+  }
+
+  Result result{uart.requests, uart.dropped, 0, 0, false};
+  for (auto *item : power) {
+    result.power_updates += item->published;
+    result.wrong |= item->wrong != 0;
+  }
+  for (auto *item : config) {
+    result.config_updates += item->published;
+    result.wrong |= item->wrong != 0;
+  }
+  result.power_updates /= power.size();
+  result.config_updates /= config.size();
+  printf("%-36s %5u requests, bus %4.1f%% busy, %3u power and %3u config updates, %3u dropped\n", name,
+         result.requests, uart.bus_ms * 100.0 / DURATION_MS, result.power_updates, result.config_updates,
+         result.dropped);
+  return result;
+}
+
+int main() {
+  bool ok = true;
+  auto expect = [&ok](bool condition, const char *what) {
+    if (!condition) {
+      printf("expected %s\n", what);
+      ok = false;
+    }
+  };
+
+  Result every = run("update() every 1s", false, 0, false, 0);
+  Result scheduled = run("poll_interval 1s/1h", true, 0, false, 0);
+  Result merged = run("poll_interval 1s/1h, max gap 2", true, 2, false, 0);
+  Result fixed = run("needs 40ms rest, fixed throttle", true, 0, false, 40);
+  Result adaptive = run("needs 40ms rest, adaptive_throttle", true, 0, true, 40);
+
+  for (auto *result : {&every, &scheduled, &merged, &fixed, &adaptive})
+    expect(!result->wrong, "every item to get its own registers");
+  // The first second has no update yet
+  for (auto *result : {&every, &scheduled, &merged, &fixed, &adaptive})
+    expect(result->power_updates >= 599, "power every second");
+  for (auto *result : {&every, &scheduled, &merged})
+    expect(result->dropped == 0, "nothing dropped without a rest time");
+  expect(every.config_updates >= 599, "config every second without poll_interval");
+  expect(scheduled.config_updates == 1 && merged.config_updates == 1, "config once with poll_interval");
+  expect(scheduled.requests < every.requests * 3 / 4, "poll_interval to save requests");
+  expect(merged.requests < scheduled.requests * 3 / 4, "the ranges across the gap to be merged");
+  expect(adaptive.dropped < fixed.dropped / 4, "adaptive_throttle to drop fewer requests");
+  // Dropped requests are repeated on the next poll, so both get the power through but at a different cost
+  expect(adaptive.requests < fixed.requests * 3 / 4, "adaptive_throttle to need fewer requests");
+  puts(ok ? "poll schedule ok" : "poll schedule FAILED");
+  return ok ? 0 : 1;
+}
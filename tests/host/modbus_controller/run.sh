@@ -0,0 +1,13 @@
+#!/usr/bin/env bash
+# Check and compare the per-register poll intervals, range merging and adaptive throttle of modbus_controller with a
+# simulated slave under ASan/UBSan
+source "$(dirname "$0")/../common.sh"
+
+srcs=("$here/poll_schedule_test.cpp" "$repo"/esphome/components/modbus/{modbus,modbus_rtu}.cpp
+  "$repo"/esphome/components/modbus_controller/modbus_controller.cpp
+  "$repo"/esphome/components/uart/{uart,uart_component}.cpp
+  "$repo"/esphome/core/{application,component,helpers,scheduler,string_ref,util}.cpp)
+flags=("${host_flags[@]}" -DUSE_MODBUS_RTU)
+g++ "${flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all "${srcs[@]}" -o "$build/test_asan"
+# The items are owned by the controller for good, like in an application
+ASAN_OPTIONS=detect_leaks=0 "$build/test_asan"
@@ -0,0 +1,58 @@
+// Host app for run.sh: the OTA component with the host backend, and a component that records how often it got to
+// loop while an update was received
+
+#include "esphome/components/host/preferences.h"
+#include "esphome/components/logger/logger.h"
+#include "esphome/components/ota/ota_component.h"
+#include "esphome/core/application.h"
+#include "esphome/core/component.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace esphome;
+
+class Ticker : public Component {
+ public:
+  void loop() override {
+    uint32_t now = millis();
+    if (this->last_ != 0 && now - this->last_ > this->max_gap_)
+      this->max_gap_ = now - this->last_;
+    this->last_ = now;
+    this->loops_++;
+  }
+  uint32_t last_{0}, max_gap_{0}, loops_{0};
+};
+
+static uint32_t start_ms = 0;
+
+void setup() {
+  host::setup_preferences();
+  App.pre_setup("otatest", "otatest", "", "", __DATE__, false);
+  auto *log = new logger::Logger(115200, 512);
+  logger::global_logger = log;
+  App.register_component(log);
+  auto *ticker = new Ticker();
+  App.register_component(ticker);
+  auto *ota = new ota::OTAComponent();
+  ota->set_port(atoi(getenv("OTA_PORT")));
+  if (getenv("OTA_PASSWORD") != nullptr)
+    ota->set_auth_password(getenv("OTA_PASSWORD"));
+  App.register_component(ota);
+  ota->add_on_state_callback([ticker](ota::OTAState state, float progress, uint8_t error) {
+    if (state == ota::OTA_STARTED) {
+      start_ms = millis();
+      ticker->max_gap_ = 0;
+      ticker->loops_ = 0;
+    }
+    if (state == ota::OTA_COMPLETED || state == ota::OTA_ERROR) {
+      printf("%s after %u ms, error 0x%02X, the other component looped %u times with a max gap of %u ms\n",
+             state == ota::OTA_COMPLETED ? "completed" : "failed", millis() - start_ms, error, ticker->loops_,
+             ticker->max_gap_);
+      fflush(stdout);
+    }
+  });
+  App.setup();
+}
+
+void loop() { App.loop(); }
@@ -0,0 +1,57 @@
+#!/usr/bin/env bash
+# Build a host app with the OTA component and upload an image to it with espota2, without and with a password and
+# with a wrong one. The written image has to match and the other components have to keep looping during the upload.
+source "$(dirname "$0")/../common.sh"
+
+trap 'kill $(jobs -p) 2>/dev/null || true; rm -rf "$build"' EXIT
+
+srcs=(
+  core/application.cpp core/component.cpp core/helpers.cpp core/scheduler.cpp core/string_ref.cpp core/util.cpp
+  components/host/core.cpp components/host/preferences.cpp components/preferences/keyed_preferences.cpp
+  components/network/util.cpp components/logger/logger.cpp components/logger/logger_host.cpp components/md5/md5.cpp
+)
+# log.cpp includes the defines.h next to it, which has OTA version 1, so it's built without the OTA flags
+g++ "${host_flags[@]}" -O1 -DESPHOME_LOG_LEVEL=4 -c "$repo/esphome/core/log.cpp" -o "$build/log.o"
+g++ "${host_flags[@]}" -O1 -DESPHOME_LOG_LEVEL=4 -DUSE_OTA -DUSE_OTA_VERSION=2 -DUSE_OTA_PASSWORD \
+  -DUSE_OTA_STATE_CALLBACK "$here/main.cpp" "${srcs[@]/#/$repo/esphome/}" "$repo"/esphome/components/ota/*.cpp \
+  "$repo"/esphome/components/socket/*.cpp "$build/log.o" -o "$build/ota_test"
+head -c 1500000 /dev/urandom > "$build/image.bin"
+
+# upload <port> <app password> <client password> <expected espota2 result>
+upload() {
+  rm -f "$build/otatest.ota.bin"
+  (cd "$build" && exec env OTA_PORT="$1" ${2:+OTA_PASSWORD="$2"} ./ota_test > app.log 2>&1) &
+  local app=$!
+  sleep 0.5
+  local result=0
+  (cd "$repo" && python3 -c 'import sys
+import esphome.espota2 as espota2
+result = espota2.run_ota("127.0.0.1", int(sys.argv[1]), sys.argv[2], sys.argv[3])
+sys.exit(result if isinstance(result, int) else result[0])' "$1" "$3" "$build/image.bin") \
+    > "$build/client.log" 2>&1 || result=$?
+  if [ "$4" = 0 ]; then
+    wait $app
+  else
+    sleep 0.5
+    kill $app
+    wait $app 2>/dev/null || true
+  fi
+  if [ $result != "$4" ]; then
+    cat "$build/client.log" "$build/app.log"
+    echo "espota2 returned $result, expected $4, FAILED"
+    exit 1
+  fi
+  grep -E "^(completed|failed) after" "$build/app.log" || true
+}
+
+upload 18082 "" "" 0
+cmp "$build/image.bin" "$build/otatest.ota.bin"
+grep -Eq "^completed after .* looped [1-9][0-9]* times" "$build/app.log"
+upload 18083 secret secret 0
+cmp "$build/image.bin" "$build/otatest.ota.bin"
+upload 18084 secret wrong 1
+if [ -e "$build/otatest.ota.bin" ] || [ -e "$build/otatest.ota.bin.part" ]; then
+  echo "an image was written with a wrong password, FAILED"
+  exit 1
+fi
+echo "ota ok"
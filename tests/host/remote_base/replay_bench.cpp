@@ -0,0 +1,158 @@
+// Replays IR captures through a receiver with 40 binary sensors across 7 protocols and a dumper per protocol, once
+// with every listener decoding the capture itself like before decode_once() and once with the shared decode results.
+// Both have to press the same sensors. The captures are encoded with the protocols and get a random jitter of up
+// to 8 % per timing, like the ones recorded with a TSOP receiver.
+
+#include "esphome/components/remote_base/jvc_protocol.h"
+#include "esphome/components/remote_base/lg_protocol.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/panasonic_protocol.h"
+#include "esphome/components/remote_base/pioneer_protocol.h"
+#include "esphome/components/remote_base/pronto_protocol.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+#include "esphome/components/remote_base/sony_protocol.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <sched.h>
+#include <vector>
+
+namespace esphome {
+uint32_t millis() { return 0; }
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome::remote_base;
+
+class Replayer : public RemoteReceiverBase {
+ public:
+  Replayer() : RemoteReceiverBase(nullptr) { this->set_tolerance(25); }
+
+  /// Hand a capture to the listeners and dumpers like the receiver does once it's idle
+  void replay(const RawTimings &capture, bool decode_once) {
+    this->temp_ = capture;
+    if (decode_once) {
+      this->call_listeners_dumpers_();
+    } else {
+      // Without a capture id every listener and dumper decodes on its own
+      this->capture_id_ = 0;
+      this->call_listeners_();
+      this->call_dumpers_();
+    }
+  }
+};
+
+struct Sensor {
+  RemoteReceiverBinarySensorBase *sensor;
+  RawTimings capture;
+  uint32_t presses{0};
+};
+
+static std::mt19937 rng(31);
+static Replayer replayer;
+static std::vector<Sensor> sensors;
+
+template<typename T> static RawTimings capture(const typename T::ProtocolData &data) {
+  RemoteTransmitData dst;
+  T().encode(&dst, data);
+  RawTimings capture;
+  for (int32_t t : dst.get_data()) {
+    t = int32_t(t * (0.92 + (rng() % 1601) / 10000.0));
+    // The receiver sees two marks or spaces in a row as one
+    if (!capture.empty() && (capture.back() < 0) == (t < 0)) {
+      capture.back() += t;
+    } else {
+      capture.push_back(t);
+    }
+  }
+  // The receiver's idle time ends the capture, it's part of the last space
+  if (capture.back() < 0) {
+    capture.back() = std::min(capture.back(), -10000);
+  } else {
+    capture.push_back(-10000);
+  }
+  return capture;
+}
+
+template<typename T> static void add_sensor(const typename T::ProtocolData &data) {
+  auto *sensor = new RemoteReceiverBinarySensor<T>();
+  sensor->set_data(data);
+  replayer.register_listener(sensor);
+  sensors.push_back(Sensor{sensor, capture<T>(data)});
+}
+
+int main(int argc, char **argv) {
+  for (uint16_t i = 0; i < 10; i++)
+    add_sensor<NECProtocol>({0x00FF, uint16_t(0xEF10 + i * 0x0101), 1});
+  for (uint32_t i = 0; i < 5; i++) {
+    add_sensor<SonyProtocol>({0x0A90 + i, 12});
+    add_sensor<PioneerProtocol>({uint16_t(0xA55A + i), 0});
+    add_sensor<SamsungProtocol>({0xE0E040BF + i * 0x00010001, 32});
+    add_sensor<LGProtocol>({0x20DF10EF + i * 0x01000100, 32});
+    add_sensor<JVCProtocol>({0xC5E8 + i});
+    add_sensor<PanasonicProtocol>({0x4004, 0x100BCBD + i});
+  }
+  replayer.register_dumper(new NECDumper());
+  replayer.register_dumper(new SonyDumper());
+  replayer.register_dumper(new PioneerDumper());
+  replayer.register_dumper(new SamsungDumper());
+  replayer.register_dumper(new LGDumper());
+  replayer.register_dumper(new JVCDumper());
+  replayer.register_dumper(new PanasonicDumper());
+  replayer.register_dumper(new ProntoDumper());
+  for (auto &s : sensors) {
+    auto *presses = &s.presses;
+    s.sensor->add_on_state_callback([presses](bool state) { *presses += state; });
+  }
+
+  // The captures of all sensors in random order, plus codes no sensor listens to
+  std::vector<const RawTimings *> captures;
+  std::vector<RawTimings> others;
+  for (uint16_t i = 0; i < 20; i++)
+    others.push_back(capture<NECProtocol>({0x1234, uint16_t(0x5600 + i), 1}));
+  for (int round = 0; round < 5; round++) {
+    for (auto &s : sensors)
+      captures.push_back(&s.capture);
+    for (auto &c : others)
+      captures.push_back(&c);
+  }
+  std::shuffle(captures.begin(), captures.end(), rng);
+
+  const bool check = argc > 1 && strcmp(argv[1], "check") == 0;
+  const int rounds = check ? 1 : 200;
+  bool ok = true;
+  double us[2];
+  for (int mode = 0; mode < 2; mode++) {
+    for (auto &s : sensors)
+      s.presses = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+      for (auto *c : captures)
+        replayer.replay(*c, mode == 1);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    us[mode] = elapsed.count() / (rounds * captures.size());
+    // Every sensor is pressed by its own capture and by nothing else
+    for (size_t i = 0; i < sensors.size(); i++) {
+      if (sensors[i].presses != uint32_t(5 * rounds)) {
+        printf("%s: sensor %zu pressed %u times, expected %d\n", mode ? "decode once" : "per listener", i,
+               sensors[i].presses, 5 * rounds);
+        ok = false;
+      }
+    }
+  }
+  printf("%zu sensors, 8 dumpers, %zu captures: per listener %.2f us, decode once %.2f us per capture\n",
+         sensors.size(), captures.size(), us[0], us[1]);
+  puts(ok ? "replay ok" : "replay FAILED");
+  return ok ? 0 : 1;
+}
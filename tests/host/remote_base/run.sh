@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+# Check that sharing the decode results presses the same binary sensors under ASan/UBSan, then time the replay of
+# the captures with and without it
+source "$(dirname "$0")/../common.sh"
+
+rb="$repo/esphome/components/remote_base"
+srcs=("$here/replay_bench.cpp" "$rb/remote_base.cpp"
+  "$rb"/{nec,sony,pioneer,samsung,lg,jvc,panasonic,pronto}_protocol.cpp
+  "$repo"/esphome/components/binary_sensor/{binary_sensor,filter}.cpp
+  "$repo"/esphome/core/{application,component,entity_base,helpers,scheduler,string_ref,util}.cpp)
+g++ "${host_flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all "${srcs[@]}" -o "$build/test_asan"
+# Like in an application the components live until the end, they aren't leaked
+ASAN_OPTIONS=detect_leaks=0 "$build/test_asan" check
+g++ "${host_flags[@]}" -O2 "${srcs[@]}" -o "$build/bench"
+"$build/bench"
@@ -0,0 +1,183 @@
+// Moves audio through a RingBuffer like voice_assistant does, 1 KiB microphone chunks into a 32 KiB buffer and 1 KiB
+// packets out, with the copying write()/read() and with the in-place acquire_write()/commit() and
+// peek_read()/consume(). Once from one thread like loop() and once with the producer in its own thread, which also
+// measures the time from commit() until the consumer sees a packet. The producer and consumer only touch one word per
+// chunk, so the numbers are those of the buffer. With "check" every byte is written and verified instead.
+
+#include "esphome/core/ring_buffer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sched.h>
+#include <thread>
+#include <vector>
+
+namespace esphome {
+uint32_t millis() { return 0; }
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome;
+
+static const size_t BUFFER_SIZE = 32 * 1024;
+static const size_t CHUNK = 1024;
+// The first bytes of every chunk carry the time it was committed
+static const size_t STAMP = sizeof(uint64_t);
+
+static bool full_check = false;
+static size_t total = size_t(256) << 20;
+static bool failed = false;
+
+static uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/// The microphone, the stream is the sequence of 32 bit words counting up
+static void produce(uint8_t *data, size_t len, size_t &pos) {
+  if (full_check) {
+    for (size_t i = 0; i < len; i++, pos++)
+      data[i] = uint8_t((pos / 4) >> (8 * (pos % 4)));
+  } else {
+    if (len >= STAMP)
+      memcpy(data, &pos, sizeof(pos));
+    pos += len;
+  }
+}
+
+/// The network, checks what arrives
+static void consume(const uint8_t *data, size_t len, size_t &pos) {
+  if (full_check) {
+    for (size_t i = 0; i < len; i++, pos++) {
+      // The stamps overwrite the start of each chunk in the threaded run
+      if (pos % CHUNK >= STAMP && data[i] != uint8_t((pos / 4) >> (8 * (pos % 4))))
+        failed = true;
+    }
+  } else {
+    pos += len;
+  }
+}
+
+static void report(const char *name, double seconds, std::vector<uint64_t> *latencies) {
+  if (full_check)
+    return;
+  printf("%-22s %6.0f MB/s", name, total / seconds / 1e6);
+  if (latencies != nullptr && !latencies->empty()) {
+    std::sort(latencies->begin(), latencies->end());
+    printf(", commit to consumer p50 %5.0f ns p99 %6.0f ns", double((*latencies)[latencies->size() / 2]),
+           double((*latencies)[latencies->size() * 99 / 100]));
+  }
+  printf("\n");
+}
+
+/// The microphone is read and the packets are sent from the same loop()
+static void single_thread(bool in_place) {
+  auto rb = RingBuffer::create(BUFFER_SIZE);
+  std::vector<uint8_t> input(CHUNK), packet(CHUNK);
+  size_t produced = 0, consumed = 0;
+  auto start = now_ns();
+  while (consumed < total) {
+    if (in_place) {
+      for (size_t left = CHUNK; left > 0;) {
+        auto span = rb->acquire_write(left, true);
+        produce(span.data, span.len, produced);
+        rb->commit(span.len);
+        left -= span.len;
+      }
+      while (rb->available() >= CHUNK) {
+        auto span = rb->peek_read(CHUNK);
+        consume(span.data, span.len, consumed);
+        rb->consume(span.len);
+      }
+    } else {
+      produce(input.data(), CHUNK, produced);
+      rb->write(input.data(), CHUNK);
+      while (rb->available() >= CHUNK) {
+        size_t len = rb->read(packet.data(), CHUNK);
+        consume(packet.data(), len, consumed);
+      }
+    }
+  }
+  report(in_place ? "one thread, in place" : "one thread, copy", (now_ns() - start) / 1e9, nullptr);
+}
+
+/// The microphone is read in its own task, which waits for room instead of dropping audio
+static void two_threads(bool in_place) {
+  auto rb = RingBuffer::create(BUFFER_SIZE);
+  std::vector<uint64_t> latencies;
+  latencies.reserve(total / CHUNK);
+  auto start = now_ns();
+  std::thread producer([&rb, in_place] {
+    std::vector<uint8_t> input(CHUNK);
+    size_t produced = 0;
+    while (produced < total) {
+      while (rb->free() < CHUNK)
+        std::this_thread::yield();
+      if (in_place) {
+        for (size_t left = CHUNK; left > 0;) {
+          auto span = rb->acquire_write(left);
+          produce(span.data, span.len, produced);
+          if (left == CHUNK && span.len >= STAMP) {
+            uint64_t stamp = now_ns();
+            memcpy(span.data, &stamp, STAMP);
+          }
+          rb->commit(span.len);
+          left -= span.len;
+        }
+      } else {
+        produce(input.data(), CHUNK, produced);
+        uint64_t stamp = now_ns();
+        memcpy(input.data(), &stamp, STAMP);
+        rb->write(input.data(), CHUNK);
+      }
+    }
+  });
+  std::vector<uint8_t> packet(CHUNK);
+  size_t consumed = 0;
+  while (consumed < total) {
+    if (rb->available() < CHUNK) {
+      std::this_thread::yield();
+      continue;
+    }
+    uint64_t now = now_ns();
+    RingBuffer::Span span{packet.data(), 0};
+    if (in_place) {
+      span = rb->peek_read(CHUNK);
+    } else {
+      span.len = rb->read(packet.data(), CHUNK);
+    }
+    // A packet split where the buffer wraps may not start with a stamp
+    if (consumed % CHUNK == 0 && span.len >= STAMP) {
+      uint64_t stamp;
+      memcpy(&stamp, span.data, STAMP);
+      if (stamp <= now)
+        latencies.push_back(now - stamp);
+    }
+    consume(span.data, span.len, consumed);
+    if (in_place)
+      rb->consume(span.len);
+  }
+  producer.join();
+  report(in_place ? "two threads, in place" : "two threads, copy", (now_ns() - start) / 1e9, &latencies);
+}
+
+int main(int argc, char **argv) {
+  full_check = argc > 1 && strcmp(argv[1], "check") == 0;
+  if (full_check)
+    total = size_t(4) << 20;
+  for (bool in_place : {false, true})
+    single_thread(in_place);
+  for (bool in_place : {false, true})
+    two_threads(in_place);
+  if (full_check)
+    puts(failed ? "ring buffer threads FAILED" : "ring buffer threads ok");
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,106 @@
+// Runs random sequences of the copying and in-place calls of RingBuffer, including writes that drop the oldest data
+// and reset(), against a std::deque for several capacities.
+
+#include "esphome/core/ring_buffer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <sched.h>
+
+namespace esphome {
+uint32_t millis() { return 0; }
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+}  // namespace esphome
+
+using namespace esphome;
+
+static bool check(size_t capacity, std::mt19937 &rng) {
+  auto rb = RingBuffer::create(capacity);
+  std::deque<uint8_t> expected;
+  uint8_t next = 0;
+  uint8_t buf[2048];
+  auto fail = [capacity](int step, const char *what) {
+    printf("capacity %zu, step %d: %s FAILED\n", capacity, step, what);
+    return false;
+  };
+  for (int step = 0; step < 200000; step++) {
+    size_t len = rng() % (capacity * 2 + 2);
+    switch (rng() % 6) {
+      case 0: {
+        for (size_t i = 0; i < len; i++)
+          buf[i] = next++;
+        rb->write(buf, len);
+        expected.insert(expected.end(), buf, buf + len);
+        while (expected.size() > capacity)
+          expected.pop_front();
+        break;
+      }
+      case 1: {
+        bool discard_oldest = rng() % 2;
+        auto span = rb->acquire_write(len, discard_oldest);
+        if (discard_oldest) {
+          while (expected.size() + std::min(len, capacity) > capacity)
+            expected.pop_front();
+        }
+        if (span.len > len || span.len > capacity - expected.size())
+          return fail(step, "acquire_write length");
+        size_t written = rng() % (span.len + 1);
+        for (size_t i = 0; i < written; i++) {
+          span.data[i] = next;
+          expected.push_back(next++);
+        }
+        rb->commit(written);
+        break;
+      }
+      case 2: {
+        size_t read = rb->read(buf, len);
+        if (read != std::min(len, expected.size()) || !std::equal(buf, buf + read, expected.begin()))
+          return fail(step, "read");
+        expected.erase(expected.begin(), expected.begin() + read);
+        break;
+      }
+      case 3: {
+        auto span = rb->peek_read(len);
+        if (span.len > len || span.len > expected.size() || (span.len == 0 && len != 0 && !expected.empty()) ||
+            !std::equal(span.data, span.data + span.len, expected.begin()))
+          return fail(step, "peek_read");
+        size_t consumed = rng() % (span.len + 1);
+        rb->consume(consumed);
+        expected.erase(expected.begin(), expected.begin() + consumed);
+        break;
+      }
+      case 4: {
+        size_t peeked = rb->peek(buf, len);
+        if (peeked != std::min(len, expected.size()) || !std::equal(buf, buf + peeked, expected.begin()))
+          return fail(step, "peek");
+        break;
+      }
+      default:
+        if (rng() % 50 == 0) {
+          rb->reset();
+          expected.clear();
+        }
+        break;
+    }
+    if (rb->available() != expected.size() || rb->free() != capacity - expected.size())
+      return fail(step, "available");
+  }
+  return true;
+}
+
+int main() {
+  std::mt19937 rng(41);
+  bool ok = true;
+  for (size_t capacity : {1, 2, 7, 64, 1000})
+    ok &= check(capacity, rng);
+  puts(ok ? "ring buffer ok" : "ring buffer FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+#!/usr/bin/env bash
+# Check RingBuffer against a reference under ASan/UBSan and with a producer thread under TSan, then measure its
+# throughput and latency copying and in place
+source "$(dirname "$0")/../common.sh"
+
+srcs=("$repo"/esphome/core/{helpers,ring_buffer}.cpp)
+g++ "${host_flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all "$here/ring_buffer_test.cpp" \
+  "${srcs[@]}" -o "$build/test_asan"
+"$build/test_asan"
+g++ "${host_flags[@]}" -O1 -g -fsanitize=thread -pthread "$here/ring_buffer_bench.cpp" "${srcs[@]}" \
+  -o "$build/bench_tsan"
+"$build/bench_tsan" check
+g++ "${host_flags[@]}" -O2 -pthread "$here/ring_buffer_bench.cpp" "${srcs[@]}" -o "$build/bench"
+"$build/bench"
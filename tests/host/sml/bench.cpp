@@ -0,0 +1,49 @@
+// Parses the telegrams and dispatches them to 8 listeners like a typical configuration has.
+// With an argument, prints every entry instead, for the comparison with expected.txt.
+
+#include "esphome/components/sml/sml.h"
+#include "common.h"
+
+#include <cstdio>
+
+using namespace esphome::sml;
+
+static const char *const CODES[] = {"1-0:1.8.0",  "1-0:2.8.0",  "1-0:16.7.0", "1-0:36.7.0",
+                                    "1-0:56.7.0", "1-0:76.7.0", "1-0:32.7.0", "1-0:1.8.1"};
+static const int ITERATIONS = 2000;
+
+int main(int argc, char **argv) {
+  auto telegrams = load_telegrams("telegrams.txt");
+  if (argc > 1) {
+    for (auto &t : telegrams) {
+      SmlFile f(t);
+      bool ok = f.parse([](const ObisInfo &o) {
+        printf("(%s) %s %d %d %u [%s]\n", bytes_repr(o.server_id).c_str(), o.code_repr().c_str(), o.unit, o.scaler,
+               o.value_type, bytes_repr(o.value).c_str());
+      });
+      if (!ok)
+        printf("PARSE ERROR\n");
+    }
+    return 0;
+  }
+
+  std::vector<SmlListener *> listeners;
+  for (size_t i = 0; i < 8; i++)
+    listeners.push_back(new SmlListener(i == 0 ? "0a0149534b00047a550001" : "", CODES[i]));
+  unsigned matched = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; i++) {
+    for (auto &t : telegrams) {
+      SmlFile f(t);
+      f.parse([&](const ObisInfo &o) {
+        for (auto *l : listeners) {
+          if (l->matches(o))
+            matched++;
+        }
+      });
+    }
+  }
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  printf("%.2f us per telegram, %u entries matched\n", elapsed.count() / (ITERATIONS * telegrams.size()), matched);
+  return 0;
+}
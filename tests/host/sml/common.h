@@ -0,0 +1,32 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace esphome {
+uint32_t millis() { return 0; }
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() {}
+}  // namespace esphome
+
+/// The telegrams made by gen.py, one hex encoded SML file per line
+static std::vector<std::vector<uint8_t>> load_telegrams(const char *path) {
+  std::vector<std::vector<uint8_t>> out;
+  std::ifstream f(path);
+  std::string line;
+  while (std::getline(f, line)) {
+    std::vector<uint8_t> telegram;
+    for (size_t i = 0; i + 1 < line.size(); i += 2)
+      telegram.push_back(std::stoi(line.substr(i, 2), nullptr, 16));
+    out.push_back(telegram);
+  }
+  return out;
+}
@@ -0,0 +1,31 @@
+// Parses every truncation of every telegram, as is and with random bit flips. Meant to run under ASan/UBSan.
+
+#include "esphome/components/sml/sml_parser.h"
+#include "common.h"
+
+#include <cstdio>
+#include <random>
+
+using namespace esphome::sml;
+
+int main() {
+  auto telegrams = load_telegrams("telegrams.txt");
+  std::mt19937 rng(1);
+  unsigned ok = 0, rejected = 0;
+  for (auto &t : telegrams) {
+    for (size_t cut = 0; cut < t.size(); cut++) {
+      for (int flip = 0; flip < 4; flip++) {
+        std::vector<uint8_t> data(t.begin(), t.begin() + cut);
+        if (flip != 0 && !data.empty())
+          data[rng() % data.size()] ^= 1 << (rng() % 8);
+        SmlFile f(data);
+        if (f.parse([](const ObisInfo &o) { volatile auto code = o.code_repr(); }))
+          ok++;
+        else
+          rejected++;
+      }
+    }
+  }
+  printf("ok=%u rejected=%u\n", ok, rejected);
+  return 0;
+}
@@ -0,0 +1,131 @@
+"""Generate the SML files in telegrams.txt.
+
+They are laid out like the telegrams of common household meters (ISKRA MT175/MT681,
+EMH eHZ, EasyMeter Q3A): OpenResponse, GetListResponse with the usual OBIS entries,
+CloseResponse. Run it from this directory.
+"""
+
+import random
+
+
+def tl(type_, length):
+    """Type-length field, the length of a value includes its type-length bytes."""
+    if length < 16:
+        return bytes([(type_ << 4) | length])
+    total = length + 1
+    return bytes([0x80 | (type_ << 4) | (total >> 4), total & 0x0F])
+
+
+def octet(b):
+    return tl(0, len(b) + 1) + b
+
+
+def uint(v, n):
+    return tl(6, n + 1) + v.to_bytes(n, "big")
+
+
+def sint(v, n):
+    return tl(5, n + 1) + v.to_bytes(n, "big", signed=True)
+
+
+def lst(*items):
+    return bytes([0x70 | len(items)]) + b"".join(items)
+
+
+def message(tid, body_type, body, group=0):
+    crc = uint(random.randrange(65536), 2)
+    body = lst(uint(body_type, 2), body)
+    return lst(octet(tid), uint(group, 1), uint(0, 1), body, crc, b"\x00")
+
+
+def entry(code, status, unit, scaler, value):
+    return lst(octet(bytes(code)), status, b"\x01", unit, scaler, value, b"\x01")
+
+
+def random_bytes(n):
+    return bytes(random.randrange(256) for _ in range(n))
+
+
+def telegram(seed, server_id, kind):
+    random.seed(seed)
+    tid = random_bytes(7)
+    open_res = lst(
+        b"\x01", b"\x01", octet(random_bytes(6)), octet(server_id), b"\x01", b"\x01"
+    )
+    wh = (uint(30, 1), sint(-1, 1))
+    entries = [
+        entry([129, 129, 199, 130, 3, 255], b"\x01", b"\x01", b"\x01", octet(b"ISK")),
+        entry([1, 0, 0, 0, 9, 255], b"\x01", b"\x01", b"\x01", octet(server_id)),
+        entry(
+            [1, 0, 1, 8, 0, 255],
+            uint(0x1C0104, 4),
+            *wh,
+            uint(random.randrange(1 << 40), 8),
+        ),
+        entry([1, 0, 1, 8, 1, 255], b"\x01", *wh, uint(random.randrange(1 << 32), 5)),
+        entry([1, 0, 2, 8, 0, 255], b"\x01", *wh, uint(random.randrange(1 << 24), 8)),
+        entry(
+            [1, 0, 16, 7, 0, 255],
+            b"\x01",
+            uint(27, 1),
+            sint(0, 1),
+            sint(random.randrange(-30000, 30000), 4),
+        ),
+    ]
+    if kind > 0:
+        entries += [
+            entry(
+                [1, 0, 36 + 20 * p, 7, 0, 255],
+                b"\x01",
+                uint(27, 1),
+                sint(-2, 1),
+                sint(random.randrange(-500000, 500000), 3),
+            )
+            for p in range(3)
+        ]
+        entries += [
+            entry(
+                [1, 0, 32 + 20 * p, 7, 0, 255],
+                b"\x01",
+                uint(35, 1),
+                sint(-1, 1),
+                uint(random.randrange(2200, 2400), 2),
+            )
+            for p in range(3)
+        ]
+    if kind > 1:
+        # Public key, a long octet string with a two byte type-length field
+        entries.append(
+            entry(
+                [129, 129, 199, 130, 5, 255],
+                b"\x01",
+                b"\x01",
+                b"\x01",
+                octet(random_bytes(48)),
+            )
+        )
+    act_sensor_time = lst(uint(1, 1), uint(random.randrange(1 << 32), 4))
+    getlist = lst(
+        b"\x01",
+        octet(server_id),
+        b"\x01",
+        act_sensor_time,
+        lst(*entries),
+        b"\x01",
+        b"\x01",
+    )
+    close_res = lst(b"\x01")
+    data = (
+        message(tid, 0x0101, open_res)
+        + message(tid, 0x0701, getlist, 0)
+        + message(tid, 0x0201, close_res)
+    )
+    # Padded to a multiple of 4 with fill bytes like the meters do
+    data += b"\x00" * ((4 - len(data) % 4) % 4)
+    return data
+
+
+with open("telegrams.txt", "w") as f:
+    for i in range(30):
+        sid = bytes([0x0A, 0x01]) + b"ISK" + bytes([0, 4, 0x7A, 0x55, i])
+        f.write(telegram(i, sid, i % 3).hex() + "\n")
@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+# Check the SML parser against the expected entries of the telegrams made by gen.py, time it and fuzz it
+source "$(dirname "$0")/../common.sh"
+
+sml="$repo/esphome/components/sml"
+# Only SmlListener is used from sml.cpp, drop the component around it
+g++ "${host_flags[@]}" -O2 -ffunction-sections -fdata-sections -Wl,--gc-sections "$here/bench.cpp" "$sml/sml.cpp" \
+  "$sml/sml_parser.cpp" "$repo/esphome/core/helpers.cpp" -o "$build/bench"
+g++ "${host_flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all "$here/fuzz.cpp" \
+  "$sml/sml_parser.cpp" "$repo/esphome/core/helpers.cpp" -o "$build/fuzz"
+
+cd "$here"
+"$build/bench" print | diff -u expected.txt -
+echo "entries match expected.txt"
+"$build/bench"
+"$build/fuzz"
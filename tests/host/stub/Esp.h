@@ -0,0 +1,7 @@
+#pragma once
+#include <cstdint>
+extern uint32_t sim_sketch_size;
+struct EspClass {
+  uint32_t getSketchSize() { return sim_sketch_size; }
+};
+extern EspClass ESP;
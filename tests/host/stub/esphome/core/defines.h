@@ -0,0 +1,8 @@
+#pragma once
+// Stands in for the defines.h generated for a configuration, with what the host tests build
+#include "esphome/core/macros.h"
+#define USE_ESP8266_PREFERENCES_FLASH
+#define USE_HTTP_REQUEST_ASYNC
+#define USE_SENSOR
+#define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_TIME
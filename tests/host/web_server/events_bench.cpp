@@ -0,0 +1,154 @@
+// Feeds high-rate sensors into web_server with one connected browser and compares sending every state change with
+// coalescing them per event_interval: JSON builds and events per second, bytes and CPU time per simulated second.
+// The clock is simulated, a minute of sensor activity runs in a fraction of a second.
+
+#include "esphome/components/web_server/web_server.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/application.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <sched.h>
+#include <string>
+#include <vector>
+
+namespace esphome {
+static uint32_t now_ms = 1;
+uint32_t millis() { return now_ms; }
+uint32_t micros() { return now_ms * 1000; }
+void delay(uint32_t) {}
+void arch_init() {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+
+// The parts of web_server_base the test needs, the rest is OTA over the Arduino Update library
+namespace web_server_base {
+void WebServerBase::add_handler(AsyncWebHandler *handler) { this->handlers_.push_back(handler); }
+void WebServerBase::add_ota_handler() {}
+float WebServerBase::get_setup_priority() const { return setup_priority::WIFI + 2.0f; }
+}  // namespace web_server_base
+}  // namespace esphome
+
+// The index page isn't served here
+const uint8_t ESPHOME_WEBSERVER_INDEX_GZ[] PROGMEM = {0};
+const size_t ESPHOME_WEBSERVER_INDEX_GZ_SIZE = 0;
+const char ESPHOME_WEBSERVER_INDEX_HASH[] = "";
+
+using namespace esphome;
+
+class Server : public web_server::WebServer {
+ public:
+  using WebServer::WebServer;
+  AsyncEventSource &events() { return this->events_; }
+};
+
+static double cpu_seconds() {
+  timespec t;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static const int SENSOR_COUNT = 10;
+static const uint32_t SENSOR_PERIOD_MS = 100;  // 10 Hz
+static const uint32_t SECONDS = 60;
+static const uint32_t LOOP_MS = 16;
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <event interval ms>\n", argv[0]);
+    return 2;
+  }
+  const uint32_t event_interval = atoi(argv[1]);
+  const int rounds = 20;
+
+  App.pre_setup("bench", "bench", "", "", __DATE__, false);
+  std::vector<sensor::Sensor *> sensors;
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    auto *s = new sensor::Sensor();
+    s->set_name(strdup(("Sensor " + std::to_string(i)).c_str()));
+    s->set_object_id(strdup(("sensor_" + std::to_string(i)).c_str()));
+    s->set_unit_of_measurement("W");
+    s->set_accuracy_decimals(1);
+    App.register_sensor(s);
+    sensors.push_back(s);
+  }
+  web_server_base::WebServerBase base;
+  Server server(&base);
+  server.set_event_interval(event_interval);
+  server.setup();
+  server.events().connect();
+  // The browser gets every entity with its configuration first
+  for (int i = 0; i < 2 * SENSOR_COUNT + 10; i++)
+    server.loop();
+  auto &client = server.events().client;
+
+  bool ok = true;
+  uint32_t messages = 0;
+  uint64_t bytes = 0;
+  double start = cpu_seconds();
+  for (int r = 0; r < rounds; r++) {
+    client.messages = 0;
+    client.bytes = 0;
+    // The sensors publish at their rate, spread over the 16 ms loop iterations
+    std::vector<uint32_t> next(SENSOR_COUNT);
+    for (int i = 0; i < SENSOR_COUNT; i++)
+      next[i] = now_ms + i * SENSOR_PERIOD_MS / SENSOR_COUNT;
+    const uint32_t end = now_ms + SECONDS * 1000;
+    for (; now_ms < end; now_ms += LOOP_MS) {
+      for (int i = 0; i < SENSOR_COUNT; i++) {
+        if (int32_t(now_ms - next[i]) >= 0) {
+          sensors[i]->publish_state(i * 100 + (now_ms / SENSOR_PERIOD_MS) % 1000 * 0.1f);
+          next[i] += SENSOR_PERIOD_MS;
+        }
+      }
+      // Without coalescing the events go out from publish_state(), loop() has nothing to send
+      uint32_t before = client.messages;
+      server.loop();
+      if (event_interval == 0 && client.messages != before)
+        ok = false;
+    }
+    messages = client.messages;
+    bytes = client.bytes;
+  }
+  double cpu = cpu_seconds() - start;
+
+  // Publish without a loop in between, the browser ends up with the newest state of every sensor
+  client.keep = true;
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    sensors[i]->publish_state(-1.0f - i);
+    sensors[i]->publish_state(-100.0f - i);
+  }
+  now_ms += event_interval;
+  server.loop();
+  if (client.kept.size() != (event_interval == 0 ? 2 : 1) * SENSOR_COUNT)
+    ok = false;
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    std::string expected = "\"value\":" + to_string(-100.0f - i);
+    bool found = false;
+    for (auto &message : client.kept) {
+      found |= message.find("\"sensor-sensor_" + to_string(i) + "\"") != std::string::npos &&
+               message.find(expected) != std::string::npos;
+    }
+    if (!found) {
+      printf("no event with %s for sensor %d\n", expected.c_str(), i);
+      ok = false;
+    }
+  }
+
+  uint32_t expected = SENSOR_COUNT * SECONDS * 1000 / std::max(SENSOR_PERIOD_MS, event_interval);
+  // Flushes fall on the 16 ms loop, allow for the rounding
+  if (messages < expected * 90 / 100 || messages > expected * 101 / 100) {
+    printf("%u events, expected about %u\n", messages, expected);
+    ok = false;
+  }
+  printf("%d sensors at %u Hz, event_interval %4u ms: %6.1f events/s, %7.0f bytes/s, %6.1f us CPU per second\n",
+         SENSOR_COUNT, 1000 / SENSOR_PERIOD_MS, event_interval, messages / double(SECONDS), bytes / double(SECONDS),
+         cpu / rounds / SECONDS * 1e6);
+  if (!ok)
+    puts("events FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+#pragma once
+// Stand-in for ESPAsyncWebServer with what web_server uses. Requests are filled in by the test, responses and event
+// messages are kept so the test can look at them.
+#include "esphome/core/optional.h"
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using String = std::string;
+
+#define PROGMEM
+
+#define F(string_literal) (string_literal)
+
+enum WebRequestMethod : uint8_t { HTTP_GET = 1, HTTP_POST = 2, HTTP_OPTIONS = 4 };
+
+class AsyncWebHeader {
+ public:
+  AsyncWebHeader(std::string value) : value_(std::move(value)) {}
+  const String &value() const { return this->value_; }
+
+ protected:
+  std::string value_;
+};
+using AsyncWebParameter = AsyncWebHeader;
+
+class AsyncWebServerResponse {
+ public:
+  virtual ~AsyncWebServerResponse() = default;
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void addHeader(const char *name, const char *value) { this->headers[name] = value; }
+
+  int code{0};
+  std::string content_type;
+  std::string content;
+  std::map<std::string, std::string> headers;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse {
+ public:
+  void print(const char *str) { this->content += str; }
+  void print(const std::string &str) { this->content += str; }
+  void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    this->content += buf;
+  }
+};
+
+class AsyncWebServerRequest {
+ public:
+  WebRequestMethod method() const { return this->method_; }
+  const String &url() const { return this->url_; }
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  bool hasHeader(const char *name) const { return this->headers_.count(name) != 0; }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncWebHeader *getHeader(const char *name) {
+    auto it = this->headers_.find(name);
+    return it == this->headers_.end() ? nullptr : &it->second;
+  }
+  esphome::optional<std::string> get_header(const char *name) {
+    auto *header = this->getHeader(name);
+    if (header == nullptr)
+      return {};
+    return header->value();
+  }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void addInterestingHeader(const char *name) {}
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  bool hasParam(const char *name) { return this->params_.count(name) != 0; }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncWebParameter *getParam(const char *name) {
+    auto it = this->params_.find(name);
+    return it == this->params_.end() ? nullptr : &it->second;
+  }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  bool hasArg(const char *name) { return this->hasParam(name); }
+  String arg(const char *name) { return this->hasParam(name) ? this->params_.at(name).value() : String(); }
+
+  bool authenticate(const char *username, const char *password) { return true; }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void requestAuthentication() {}
+  void redirect(const String &url) { this->send(302); }
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncWebServerResponse *beginResponse(int code, const String &content_type, const String &content = String()) {
+    auto *response = new AsyncWebServerResponse();  // NOLINT(cppcoreguidelines-owning-memory)
+    response->code = code;
+    response->content_type = content_type;
+    response->content = content;
+    return response;
+  }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncWebServerResponse *beginResponse_P(int code, const String &content_type, const uint8_t *data, size_t len) {
+    return this->beginResponse(code, content_type, std::string(reinterpret_cast<const char *>(data), len));
+  }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncResponseStream *beginResponseStream(const String &content_type) {
+    auto *response = new AsyncResponseStream();  // NOLINT(cppcoreguidelines-owning-memory)
+    response->code = 200;
+    response->content_type = content_type;
+    return response;
+  }
+  void send(AsyncWebServerResponse *response) { this->response_.reset(response); }
+  void send(int code, const String &content_type = String(), const String &content = String()) {
+    this->send(this->beginResponse(code, content_type, content));
+  }
+
+  // Set up by the test
+  WebRequestMethod method_{HTTP_GET};
+  std::string url_;
+  std::map<std::string, AsyncWebHeader> headers_;
+  std::map<std::string, AsyncWebParameter> params_;
+  // What the handler sent
+  std::unique_ptr<AsyncWebServerResponse> response_;
+};
+
+class AsyncWebHandler {
+ public:
+  virtual ~AsyncWebHandler() = default;
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  virtual bool canHandle(AsyncWebServerRequest *request) { return false; }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  virtual void handleRequest(AsyncWebServerRequest *request) {}
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  virtual void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data,
+                            size_t len, bool final) {}
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  virtual void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {}
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  virtual bool isRequestHandlerTrivial() { return true; }
+};
+
+class AsyncWebServer {
+ public:
+  AsyncWebServer(uint16_t port) {}
+  void begin() {}
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  AsyncWebHandler &addHandler(AsyncWebHandler *handler) {
+    this->handlers.push_back(handler);
+    return *handler;
+  }
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void onNotFound(std::function<void(AsyncWebServerRequest *)> fn) {}
+
+  std::vector<AsyncWebHandler *> handlers;
+};
+
+/// Formats every message like the library does and counts them, there's one connected browser
+class AsyncEventSourceClient {
+ public:
+  void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+    std::string ev;
+    if (reconnect != 0)
+      ev += "retry: " + std::to_string(reconnect) + "\r\n";
+    if (id != 0)
+      ev += "id: " + std::to_string(id) + "\r\n";
+    if (event != nullptr)
+      ev += std::string("event: ") + event + "\r\n";
+    if (message != nullptr)
+      ev += std::string("data: ") + message + "\r\n";
+    ev += "\r\n";
+    this->messages++;
+    this->bytes += ev.size();
+    if (this->keep)
+      this->kept.push_back(std::move(ev));
+  }
+
+  uint32_t messages{0};
+  uint64_t bytes{0};
+  bool keep{false};
+  std::vector<std::string> kept;
+};
+
+class AsyncEventSource : public AsyncWebHandler {
+ public:
+  AsyncEventSource(const String &url) {}
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void onConnect(std::function<void(AsyncEventSourceClient *)> cb) { this->on_connect_ = std::move(cb); }
+  void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+    this->client.send(message, event, id, reconnect);
+  }
+  void connect() { this->on_connect_(&this->client); }
+
+  AsyncEventSourceClient client;
+
+ protected:
+  std::function<void(AsyncEventSourceClient *)> on_connect_;
+};
+
+class DefaultHeaders {
+ public:
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void addHeader(const char *name, const char *value) {}
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  static DefaultHeaders &Instance() {
+    static DefaultHeaders instance;
+    return instance;
+  }
+};
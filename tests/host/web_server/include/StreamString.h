@@ -0,0 +1,2 @@
+#pragma once
+// Stand-in for the Arduino header, web_server only includes it
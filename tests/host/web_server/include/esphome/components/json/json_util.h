@@ -0,0 +1,66 @@
+#pragma once
+// Stand-in for the ArduinoJson based helpers that writes flat objects, enough for the entities web_server is built
+// with here. Shadows the one of the shared stub, so the JSON costs about what it costs with ArduinoJson.
+#include "esphome/core/helpers.h"
+
+#include <cmath>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+namespace esphome {
+
+class JsonObject {
+ public:
+  class Ref {
+   public:
+    Ref(std::string *out, const char *key) : out_(out), key_(key) {}
+    template<typename T> Ref &operator=(const T &value) {
+      if (this->out_->size() > 1)
+        *this->out_ += ',';
+      *this->out_ += '"';
+      *this->out_ += this->key_;
+      *this->out_ += "\":";
+      this->write_(value);
+      return *this;
+    }
+
+   protected:
+    void write_(const std::string &value) {
+      *this->out_ += '"';
+      *this->out_ += value;
+      *this->out_ += '"';
+    }
+    void write_(const char *value) { this->write_(std::string(value)); }
+    void write_(bool value) { *this->out_ += value ? "true" : "false"; }
+    void write_(float value) { *this->out_ += std::isnan(value) ? "null" : to_string(value); }
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type write_(T value) {
+      *this->out_ += to_string(static_cast<int64_t>(value));
+    }
+    template<size_t N> void write_(const char (&value)[N]) { this->write_(std::string(value)); }
+
+    std::string *out_;
+    const char *key_;
+  };
+
+  JsonObject(std::string *out) : out_(out) {}
+  Ref operator[](const char *key) { return Ref(this->out_, key); }
+
+ protected:
+  std::string *out_;
+};
+
+namespace json {
+
+using json_build_t = std::function<void(JsonObject)>;
+
+inline std::string build_json(const json_build_t &f) {
+  std::string out = "{";
+  f(JsonObject(&out));
+  out += '}';
+  return out;
+}
+
+}  // namespace json
+}  // namespace esphome
@@ -0,0 +1,24 @@
+#!/usr/bin/env bash
+# Build web_server against a stand-in for ESPAsyncWebServer, check the caching and encodings of the static resources
+# and compare sending state events right away with coalescing them
+source "$(dirname "$0")/../common.sh"
+
+# The include directory comes first, its json_util.h writes the JSON the shared stub leaves out. USE_ARDUINO would
+# pull in the Arduino core, the stand-in is included up front instead.
+flags=(-I"$here/include" "${host_flags[@]}" -include ESPAsyncWebServer.h -DUSE_WEBSERVER -DUSE_WEBSERVER_VERSION=2
+  -DUSE_WEBSERVER_LOCAL -DUSE_WEBSERVER_PORT=80)
+srcs=(
+  core/application.cpp core/component.cpp core/component_iterator.cpp core/controller.cpp core/entity_base.cpp
+  core/helpers.cpp core/scheduler.cpp core/string_ref.cpp core/util.cpp components/network/util.cpp
+  components/sensor/sensor.cpp components/sensor/filter.cpp components/web_server/web_server.cpp
+  components/web_server/list_entities.cpp
+)
+g++ "${flags[@]}" -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all -DUSE_WEBSERVER_BROTLI \
+  -DUSE_WEBSERVER_CSS_INCLUDE "$here/static_resources_test.cpp" "${srcs[@]/#/$repo/esphome/}" -o "$build/static_test"
+"$build/static_test"
+
+g++ "${flags[@]}" -O2 "$here/events_bench.cpp" "${srcs[@]/#/$repo/esphome/}" -o "$build/events_bench"
+# 10 sensors at 10 Hz with one browser, sent right away and coalesced to 4 and 1 events per second and sensor
+for interval in 0 250 1000; do
+  "$build/events_bench" "$interval"
+done
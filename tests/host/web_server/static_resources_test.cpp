@@ -0,0 +1,139 @@
+// Requests the index page and the CSS include from web_server with different Accept-Encoding and If-None-Match
+// headers and checks the representation, the status and the caching headers of the responses.
+
+#include "esphome/components/web_server/web_server.h"
+#include "esphome/core/application.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sched.h>
+#include <string>
+
+namespace esphome {
+uint32_t millis() { return 0; }
+uint32_t micros() { return 0; }
+void delay(uint32_t) {}
+void arch_init() {}
+void arch_feed_wdt() {}
+void arch_restart() { abort(); }
+void yield() { sched_yield(); }
+void esp_log_printf_(int, const char *, int, const char *, ...) {}
+
+namespace web_server_base {
+void WebServerBase::add_handler(AsyncWebHandler *handler) { this->handlers_.push_back(handler); }
+void WebServerBase::add_ota_handler() {}
+float WebServerBase::get_setup_priority() const { return setup_priority::WIFI + 2.0f; }
+}  // namespace web_server_base
+}  // namespace esphome
+
+// What the code generator adds for the assets, the content only has to tell the representations apart
+const uint8_t ESPHOME_WEBSERVER_INDEX_GZ[] PROGMEM = {'i', 'n', 'd', 'e', 'x', '.', 'g', 'z'};
+const size_t ESPHOME_WEBSERVER_INDEX_GZ_SIZE = sizeof(ESPHOME_WEBSERVER_INDEX_GZ);
+const uint8_t ESPHOME_WEBSERVER_INDEX_BR[] PROGMEM = {'i', 'n', 'd', 'e', 'x', '.', 'b', 'r'};
+const size_t ESPHOME_WEBSERVER_INDEX_BR_SIZE = sizeof(ESPHOME_WEBSERVER_INDEX_BR);
+const char ESPHOME_WEBSERVER_INDEX_HASH[] = "0123456789abcdef";
+const uint8_t ESPHOME_WEBSERVER_CSS_INCLUDE[] PROGMEM = {'c', 's', 's', '.', 'g', 'z'};
+const size_t ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE = sizeof(ESPHOME_WEBSERVER_CSS_INCLUDE);
+const uint8_t ESPHOME_WEBSERVER_CSS_INCLUDE_BR[] PROGMEM = {'c', 's', 's', '.', 'b', 'r'};
+const size_t ESPHOME_WEBSERVER_CSS_INCLUDE_BR_SIZE = sizeof(ESPHOME_WEBSERVER_CSS_INCLUDE_BR);
+const char ESPHOME_WEBSERVER_CSS_INCLUDE_HASH[] = "fedcba9876543210";
+
+using namespace esphome;
+
+static bool failed = false;
+
+struct Expected {
+  int code;
+  const char *content;
+  const char *encoding;
+  const char *etag;
+  const char *cache_control;
+};
+
+static void get(web_server::WebServer &server, const char *url, const char *accept_encoding, const char *if_none_match,
+                const Expected &expected) {
+  AsyncWebServerRequest request;
+  request.url_ = url;
+  if (accept_encoding != nullptr)
+    request.headers_.emplace("Accept-Encoding", accept_encoding);
+  if (if_none_match != nullptr)
+    request.headers_.emplace("If-None-Match", if_none_match);
+  if (!server.canHandle(&request)) {
+    printf("%s not handled FAILED\n", url);
+    failed = true;
+    return;
+  }
+  server.handleRequest(&request);
+  auto *response = request.response_.get();
+  auto header = [response](const char *name) {
+    auto it = response->headers.find(name);
+    return it == response->headers.end() ? std::string("-") : it->second;
+  };
+  bool ok = response->code == expected.code && response->content == expected.content &&
+            header("Content-Encoding") == expected.encoding && header("ETag") == expected.etag &&
+            header("Cache-Control") == expected.cache_control && header("Vary") == "Accept-Encoding";
+  if (!ok) {
+    printf("GET %s Accept-Encoding: %s If-None-Match: %s FAILED\n", url, accept_encoding ? accept_encoding : "-",
+           if_none_match ? if_none_match : "-");
+    printf("  got %d '%s' encoding %s etag %s cache %s\n", response->code, response->content.c_str(),
+           header("Content-Encoding").c_str(), header("ETag").c_str(), header("Cache-Control").c_str());
+    failed = true;
+  }
+}
+
+int main() {
+  App.pre_setup("test", "test", "", "", __DATE__, false);
+  web_server_base::WebServerBase base;
+  web_server::WebServer server(&base);
+  server.setup();
+
+  const char *index_gz = "\"0123456789abcdef-gzip\"";
+  const char *index_br = "\"0123456789abcdef-br\"";
+  const Expected gzip{200, "index.gz", "gzip", index_gz, "no-cache"};
+  const Expected br{200, "index.br", "br", index_br, "no-cache"};
+
+  // Brotli only when it's acceptable, the weights and "*" are taken into account
+  struct {
+    const char *accept_encoding;
+    bool br;
+  } encodings[] = {
+      {nullptr, false},
+      {"", false},
+      {"gzip", false},
+      {"br", true},
+      {"gzip, deflate, br", true},
+      {"BR;q=0.5", true},
+      {"br;q=0", false},
+      {"br; q=0.0, gzip", false},
+      {"br ;q=0", false},
+      {"*", true},
+      {"*;q=0", false},
+      {"gzip;q=1, *;q=0.1", true},
+      {"br;q=0, *", false},
+      {"brotli", false},
+      {"gzip, x-br", false},
+      {" , br ", true},
+      {"gzip;q=0.5,br", true},
+  };
+  for (auto &e : encodings)
+    get(server, "/", e.accept_encoding, nullptr, e.br ? br : gzip);
+
+  // A matching ETag gets a 304 without a body, each encoding has its own ETag
+  get(server, "/", "gzip", index_gz, {304, "", "-", index_gz, "no-cache"});
+  get(server, "/", "gzip, br", index_br, {304, "", "-", index_br, "no-cache"});
+  get(server, "/", "gzip, br", index_gz, br);
+  get(server, "/", "gzip", index_br, gzip);
+  get(server, "/", "gzip", "\"other\", \"0123456789abcdef-gzip\"", {304, "", "-", index_gz, "no-cache"});
+  get(server, "/", "gzip", "\"0123456789abcdef\"", gzip);
+
+  // The includes are referenced with their hash in the URL, so they can be cached for good
+  const char *immutable = "public, max-age=31536000, immutable";
+  const char *css_gz = "\"fedcba9876543210-gzip\"";
+  get(server, "/0.css", "gzip", nullptr, {200, "css.gz", "gzip", css_gz, immutable});
+  get(server, "/0.css", "gzip, br", nullptr, {200, "css.br", "br", "\"fedcba9876543210-br\"", immutable});
+  get(server, "/0.css", "gzip", css_gz, {304, "", "-", css_gz, immutable});
+
+  puts(failed ? "static resources FAILED" : "static resources ok");
+  return failed ? 1 : 0;
+}